@@ -941,3 +941,54 @@ std::vector<std::pair<QString, QString>> Aux::parseDocumentListString(const QStr
 
     return docs;
 }
+
+//
+
+/*!
+ * \brief Check, if all properties are equal.
+ *
+ * \param pOther Station to compare with.
+ * \return If all properties of this and \p pOther are equal.
+ */
+bool Aux::Station::operator==(const Station& pOther) const
+{
+    return location == pOther.location && name == pOther.name && localGroup == pOther.localGroup &&
+           districtAssociation == pOther.districtAssociation && radioCallName == pOther.radioCallName &&
+           radioCallNameAlt == pOther.radioCallNameAlt;
+}
+
+/*!
+ * \brief Check, if any property differs.
+ *
+ * \param pOther Station to compare with.
+ * \return If any property of this and \p pOther differs.
+ */
+bool Aux::Station::operator!=(const Station& pOther) const
+{
+    return !operator==(pOther);
+}
+
+//
+
+/*!
+ * \brief Check, if all properties are equal.
+ *
+ * \param pOther Boat to compare with.
+ * \return If all properties of this and \p pOther are equal.
+ */
+bool Aux::Boat::operator==(const Boat& pOther) const
+{
+    return name == pOther.name && acronym == pOther.acronym && type == pOther.type && fuelType == pOther.fuelType &&
+           radioCallName == pOther.radioCallName && radioCallNameAlt == pOther.radioCallNameAlt && homeStation == pOther.homeStation;
+}
+
+/*!
+ * \brief Check, if any property differs.
+ *
+ * \param pOther Boat to compare with.
+ * \return If any property of this and \p pOther differs.
+ */
+bool Aux::Boat::operator!=(const Boat& pOther) const
+{
+    return !operator==(pOther);
+}
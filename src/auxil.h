@@ -145,6 +145,9 @@ public:
         QString districtAssociation;    ///< District association of the local group.
         QString radioCallName;          ///< %Station's radio call name.
         QString radioCallNameAlt;       ///< %Station's alternative radio call name.
+        //
+        bool operator==(const Station& pOther) const;   ///< Check, if all properties are equal.
+        bool operator!=(const Station& pOther) const;   ///< Check, if any property differs.
     };
     /*!
      * \brief Properties of a boat.
@@ -161,6 +164,9 @@ public:
         QString radioCallName;      ///< %Boat's radio call name.
         QString radioCallNameAlt;   ///< %Boat's alternative radio call name.
         QString homeStation;        ///< The station that the boat is associated with.
+        //
+        bool operator==(const Boat& pOther) const;  ///< Check, if all properties are equal.
+        bool operator!=(const Boat& pOther) const;  ///< Check, if any property differs.
     };
     //
     /*!
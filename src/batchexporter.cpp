@@ -0,0 +1,135 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "batchexporter.h"
+
+#include "paralleljobs.h"
+#include "pdfexporter.h"
+#include "qualificationchecker.h"
+#include "report.h"
+
+#include <QFileInfo>
+
+#include <iostream>
+#include <vector>
+
+//Public
+
+/*!
+ * \brief Get the PDF file name used for exporting a report file.
+ *
+ * \param pReportFileName File name of the report.
+ * \return \p pReportFileName with its extension replaced by ".pdf".
+ */
+QString BatchExporter::pdfFileName(const QString& pReportFileName)
+{
+    QFileInfo fileInfo(pReportFileName);
+
+    return fileInfo.path() + "/" + fileInfo.completeBaseName() + ".pdf";
+}
+
+//
+
+/*!
+ * \brief Load and export many reports to PDF files in parallel.
+ *
+ * Loads each report from \p pFileNames and exports it to a PDF file named like the report file
+ * but with ".pdf" extension (see pdfFileName()). Existing files are overwritten.
+ *
+ * The reports are processed by \p pJobs parallel jobs (or ParallelJobs::defaultJobCount() jobs, if \p pJobs is smaller than 1),
+ * each in its own thread (see ParallelJobs::run()). The export settings are captured only once (see PDFExporter::currentExportSettings())
+ * and shared by all jobs. Every export compiles its document in its own temporary directory (see PDFExporter::exportPDF()).
+ *
+ * A report that cannot be loaded or exported does not stop the remaining exports. Instead, a message
+ * is appended to \p pErrors for each such report (in the order of \p pFileNames).
+ *
+ * If \p pProgress is set, it is repeatedly called (from the calling thread) with the number of reports processed so far
+ * and the total number of reports. No further reports are started (and false is returned), if \p pProgress returns false.
+ * Reports that are already being exported are finished, though.
+ *
+ * Note: Must be called from the main thread (see PDFExporter::currentExportSettings() and
+ * QualificationChecker::boatmanRequiredLicense()).
+ *
+ * \param pFileNames File names of the reports to export.
+ * \param pJobs Number of parallel export jobs.
+ * \param pErrors Messages for reports that could not be loaded or exported.
+ * \param pProgress Optional function to report the progress and to request an abort.
+ * \return If all reports were exported successfully.
+ */
+bool BatchExporter::exportReports(const QStringList& pFileNames, int pJobs, QStringList& pErrors,
+                                  const std::function<bool(int, int)>& pProgress)
+{
+    if (pFileNames.isEmpty())
+        return true;
+
+    //Capture the settings once here such that the jobs do not need to access the settings and database caches
+    const PDFExporter::ExportSettings tSettings = PDFExporter::currentExportSettings();
+    const QString tBoatmanRequiredLicense = QualificationChecker::boatmanRequiredLicense();
+
+    auto tTask = [&pFileNames, &tSettings, &tBoatmanRequiredLicense](int pIndex) -> QString
+    {
+        const QString tFileName = pFileNames[pIndex];
+
+        Report tReport;
+
+        if (!tReport.open(tFileName, tBoatmanRequiredLicense))
+        {
+            std::cerr<<"ERROR: Could not load report \""<<tFileName.toStdString()<<"\"!"<<std::endl;
+            return "Konnte Wachbericht \"" + tFileName + "\" nicht laden!";
+        }
+
+        const QString tPDFFileName = pdfFileName(tFileName);
+
+        if (!PDFExporter::exportPDF(std::move(tReport), tPDFFileName, tSettings))
+        {
+            std::cerr<<"ERROR: Could not export report to \""<<tPDFFileName.toStdString()<<"\"!"<<std::endl;
+            return "Konnte Wachbericht nicht nach \"" + tPDFFileName + "\" exportieren!";
+        }
+
+        return "";
+    };
+
+    std::vector<QString> tJobErrors;
+
+    const bool tCompleted = ParallelJobs::run(pFileNames.size(), pJobs, tTask, tJobErrors, pProgress);
+
+    //Collect error messages in the order of the reports
+
+    bool tSuccess = true;
+
+    for (QString& tError : tJobErrors)
+    {
+        if (tError != "")
+        {
+            pErrors.push_back(std::move(tError));
+            tSuccess = false;
+        }
+    }
+
+    if (!tCompleted)
+    {
+        pErrors.push_back("Export abgebrochen.");
+        tSuccess = false;
+    }
+
+    return tSuccess;
+}
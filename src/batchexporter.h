@@ -0,0 +1,51 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef BATCHEXPORTER_H
+#define BATCHEXPORTER_H
+
+#include <QString>
+#include <QStringList>
+
+#include <functional>
+
+/*!
+ * \brief Load many reports from files and export them to PDF files in parallel.
+ *
+ * Runs a number of export jobs in parallel (see exportReports()), each of which repeatedly takes the next report
+ * from the list, loads it and exports it using PDFExporter. Since each export mostly waits for its own XeLaTeX process,
+ * this scales with the number of processor cores. A report that cannot be loaded or exported does not abort
+ * the other exports but is only reported at the end. The jobs are run by ParallelJobs.
+ */
+class BatchExporter
+{
+public:
+    BatchExporter() = delete;   ///< Deleted constructor.
+    //
+    static QString pdfFileName(const QString& pReportFileName);     ///< Get the PDF file name used for exporting a report file.
+    //
+    static bool exportReports(const QStringList& pFileNames, int pJobs, QStringList& pErrors,
+                              const std::function<bool(int, int)>& pProgress = nullptr);
+                                                                    ///< Load and export many reports to PDF files in parallel.
+};
+
+#endif // BATCHEXPORTER_H
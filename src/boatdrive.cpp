@@ -35,7 +35,7 @@ BoatDrive::BoatDrive() :
     begin(QTime::currentTime()),
     end(QTime::currentTime()),
     fuel(0),
-    boatman(""),
+    boatman(PersonIdentPool::intern("")),
     noCrewConfirmed(false)
 {
 }
@@ -155,7 +155,7 @@ void BoatDrive::setFuel(const int pLiters)
  */
 QString BoatDrive::getBoatman() const
 {
-    return boatman;
+    return PersonIdentPool::ident(boatman);
 }
 
 /*!
@@ -165,7 +165,18 @@ QString BoatDrive::getBoatman() const
  */
 void BoatDrive::setBoatman(QString pIdent)
 {
-    boatman = std::move(pIdent);
+    boatman = PersonIdentPool::intern(pIdent);
+}
+
+/*!
+ * \brief Check if a person is the boatman.
+ *
+ * \param pHandle Person's interned identifier handle (see PersonIdentPool).
+ * \return If the person is the boatman.
+ */
+bool BoatDrive::isBoatman(const PersonIdentPool::Handle pHandle) const
+{
+    return boatman == pHandle;
 }
 
 //
@@ -173,13 +184,41 @@ void BoatDrive::setBoatman(QString pIdent)
 /*!
  * \brief Get all crew members' functions.
  *
+ * The map is kept up to date by the crew modifying functions, such that no identifier handles
+ * of the crew (see crewHandles()) need to be converted here.
+ *
+ * Note: The returned reference is invalidated by any crew modifying function.
+ *
  * \return Map with person identifiers as keys and their boat functions as values.
  */
-std::map<QString, Person::BoatFunction> BoatDrive::crew() const
+const std::map<QString, Person::BoatFunction>& BoatDrive::crew() const
+{
+    return crewIdentsMap;
+}
+
+/*!
+ * \brief Get all crew members' functions by identifier handles.
+ *
+ * Other than crew() this does not copy or convert anything.
+ *
+ * \return Map with interned person identifier handles (see PersonIdentPool) as keys and their boat functions as values.
+ */
+const std::map<PersonIdentPool::Handle, Person::BoatFunction>& BoatDrive::crewHandles() const
 {
     return crewMap;
 }
 
+/*!
+ * \brief Check if a person is a crew member.
+ *
+ * \param pHandle Person's interned identifier handle (see PersonIdentPool).
+ * \return If the person is a crew member.
+ */
+bool BoatDrive::hasCrewMember(const PersonIdentPool::Handle pHandle) const
+{
+    return crewMap.find(pHandle) != crewMap.end();
+}
+
 /*!
  * \brief Get the number of crew members.
  *
@@ -201,9 +240,14 @@ int BoatDrive::crewSize() const
  */
 bool BoatDrive::getCrewMember(const QString& pIdent, Person::BoatFunction& pFunction) const
 {
-    if (crewMap.find(pIdent) != crewMap.end())
+    PersonIdentPool::Handle tHandle;
+    if (!PersonIdentPool::lookup(pIdent, tHandle))
+        return false;
+
+    auto it = crewMap.find(tHandle);
+    if (it != crewMap.end())
     {
-        pFunction = crewMap.at(pIdent);
+        pFunction = it->second;
         return true;
     }
 
@@ -222,10 +266,15 @@ bool BoatDrive::getCrewMember(const QString& pIdent, Person::BoatFunction& pFunc
  */
 bool BoatDrive::getExtCrewMemberName(const QString& pIdent, QString& pLastName, QString& pFirstName) const
 {
-    if (crewExtNames.find(pIdent) != crewExtNames.end())
+    PersonIdentPool::Handle tHandle;
+    if (!PersonIdentPool::lookup(pIdent, tHandle))
+        return false;
+
+    auto it = crewExtNames.find(tHandle);
+    if (it != crewExtNames.end())
     {
-        pLastName = crewExtNames.at(pIdent).first;
-        pFirstName = crewExtNames.at(pIdent).second;
+        pLastName = it->second.first;
+        pFirstName = it->second.second;
         return true;
     }
 
@@ -245,7 +294,8 @@ bool BoatDrive::getExtCrewMemberName(const QString& pIdent, QString& pLastName,
  */
 void BoatDrive::addCrewMember(const QString& pIdent, const Person::BoatFunction pFunction)
 {
-    crewMap[pIdent] = pFunction;
+    crewMap[PersonIdentPool::intern(pIdent)] = pFunction;
+    crewIdentsMap[pIdent] = pFunction;
     noCrewConfirmed = false;
 }
 
@@ -266,7 +316,7 @@ void BoatDrive::addExtCrewMember(const QString& pIdent, const Person::BoatFuncti
 {
     addCrewMember(pIdent, pFunction);
 
-    crewExtNames[pIdent] = {pLastName, pFirstName};
+    crewExtNames[PersonIdentPool::intern(pIdent)] = {pLastName, pFirstName};
 }
 
 /*!
@@ -278,8 +328,13 @@ void BoatDrive::addExtCrewMember(const QString& pIdent, const Person::BoatFuncti
  */
 void BoatDrive::removeCrewMember(const QString& pIdent)
 {
-    crewMap.erase(pIdent);
-    crewExtNames.erase(pIdent);
+    PersonIdentPool::Handle tHandle;
+    if (!PersonIdentPool::lookup(pIdent, tHandle))
+        return;
+
+    crewMap.erase(tHandle);
+    crewExtNames.erase(tHandle);
+    crewIdentsMap.erase(pIdent);
 }
 
 /*!
@@ -291,6 +346,7 @@ void BoatDrive::clearCrew()
 {
     crewMap.clear();
     crewExtNames.clear();
+    crewIdentsMap.clear();
 }
 
 //
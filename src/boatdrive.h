@@ -24,6 +24,7 @@
 #define BOATDRIVE_H
 
 #include "person.h"
+#include "personidentpool.h"
 
 #include <QString>
 #include <QTime>
@@ -36,6 +37,9 @@
  *
  * Describes a single boat drive by defining purpose of the drive, begin and end times,
  * the boatman, all crew members, amount of added fuel and any further comments.
+ *
+ * Persons are stored by their interned identifier handles (see PersonIdentPool). Besides the identifier based
+ * interface, isBoatman(), hasCrewMember() and crewHandles() allow for cheap handle based lookups.
  */
 class BoatDrive
 {
@@ -58,7 +62,12 @@ public:
     QString getBoatman() const;             ///< Get the boatman.
     void setBoatman(QString pIdent);        ///< Set the boatman.
     //
-    std::map<QString, Person::BoatFunction> crew() const;                               ///< Get all crew members' functions.
+    bool isBoatman(PersonIdentPool::Handle pHandle) const;  ///< Check if a person is the boatman.
+    //
+    const std::map<QString, Person::BoatFunction>& crew() const;                        ///< Get all crew members' functions.
+    const std::map<PersonIdentPool::Handle, Person::BoatFunction>& crewHandles() const; ///< \brief Get all crew members' functions
+                                                                                        ///  by identifier handles.
+    bool hasCrewMember(PersonIdentPool::Handle pHandle) const;                          ///< Check if a person is a crew member.
     int crewSize() const;                                                               ///< Get the number of crew members.
     bool getCrewMember(const QString& pIdent, Person::BoatFunction& pFunction) const;   ///< Get the function of a crew member.
     bool getExtCrewMemberName(const QString& pIdent,
@@ -80,11 +89,13 @@ private:
     //
     int fuel;               //Added fuel (during/after this drive) in liters
     //
-    QString boatman;        //The boatman
+    PersonIdentPool::Handle boatman;    //The boatman
     //
     bool noCrewConfirmed;   //Explicit confirmation that boat crew was left empty intentionally (only boatman aboard)
-    std::map<QString, Person::BoatFunction> crewMap;                //The boat crew for this drive (excluding the boatman)
-    std::map<QString, std::pair<QString, QString>> crewExtNames;    //Last and first names of external crew members
+    std::map<PersonIdentPool::Handle, Person::BoatFunction> crewMap;                //The boat crew for this drive (excluding the boatman)
+    std::map<PersonIdentPool::Handle, std::pair<QString, QString>> crewExtNames;    //Last and first names of external crew members
+    //
+    std::map<QString, Person::BoatFunction> crewIdentsMap;                          //'crewMap' with converted identifiers (see crew())
 };
 
 #endif // BOATDRIVE_H
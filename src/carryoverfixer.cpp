@@ -0,0 +1,231 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "carryoverfixer.h"
+
+#include "paralleljobs.h"
+#include "qualificationchecker.h"
+
+#include <algorithm>
+#include <iostream>
+
+//Public
+
+/*!
+ * \brief Correct the carryovers of a chain of reports.
+ *
+ * Loads all reports from \p pFileNames in parallel (using \p pJobs parallel jobs, see ParallelJobs::run())
+ * and keeps only their carryover summaries (see Report::getCarryoverSummary()). Then calculates the correct
+ * carryovers of each report from the corrected summary of the respective previous report in the order
+ * of \p pFileNames (see Report::calculateCarryovers()). The first report is not changed.
+ *
+ * Each report whose carryovers change is appended to \p pChanges (in the order of \p pFileNames) and the number of
+ * checked reports whose carryovers are already correct is written to \p pUnchanged. Unless \p pDryRun is true,
+ * exactly these reports are then loaded again, corrected and saved under the same file name (also in parallel).
+ * Reports without changes are never written.
+ *
+ * If a report cannot be loaded, the carryovers of all following reports cannot be calculated. Only the
+ * reports before it are corrected then. For each failed report a message is appended to \p pErrors.
+ *
+ * If \p pProgress is set, it is repeatedly called with the number of reports processed so far and the total number
+ * of reports, first for loading all reports and then again for saving the changed reports. The operation is aborted,
+ * if \p pProgress returns false. Nothing is saved, if aborted while loading.
+ *
+ * Note: Must be called from the main thread (see QualificationChecker::boatmanRequiredLicense()).
+ *
+ * \param pFileNames Report file names in chronological order.
+ * \param pJobs Number of parallel jobs.
+ * \param pDryRun Only determine the changes without saving any report?
+ * \param pChanges Reports with changed carryovers.
+ * \param pUnchanged Number of checked reports without changes.
+ * \param pErrors Messages for reports that could not be loaded or saved.
+ * \param pProgress Optional function to report the progress and to request an abort.
+ * \return If all reports were loaded and (if not \p pDryRun) all changed reports were saved successfully.
+ */
+bool CarryoverFixer::fixCarryovers(const QStringList& pFileNames, const int pJobs, const bool pDryRun,
+                                   std::vector<Change>& pChanges, int& pUnchanged, QStringList& pErrors,
+                                   const std::function<bool(int, int)>& pProgress)
+{
+    pUnchanged = 0;
+
+    const int tTotal = pFileNames.size();
+
+    if (tTotal < 2)
+        return true;
+
+    //Load all reports in parallel and only keep their carryover summaries
+
+    std::vector<Report::CarryoverSummary> summaries(static_cast<std::size_t>(tTotal));
+
+    //Read the setting once here such that the jobs do not need to access the settings cache
+    const QString tBoatmanRequiredLicense = QualificationChecker::boatmanRequiredLicense();
+
+    auto tLoadTask = [&pFileNames, &summaries, &tBoatmanRequiredLicense](int pIndex) -> QString
+    {
+        const QString& tFileName = pFileNames[pIndex];
+
+        Report tReport;
+
+        if (!tReport.open(tFileName, tBoatmanRequiredLicense))
+        {
+            std::cerr<<"ERROR: Could not load report \""<<tFileName.toStdString()<<"\"!"<<std::endl;
+            return "Konnte Wachbericht \"" + tFileName + "\" nicht laden!";
+        }
+
+        summaries[static_cast<std::size_t>(pIndex)] = tReport.getCarryoverSummary();
+
+        return "";
+    };
+
+    std::vector<QString> tLoadErrors;
+
+    if (!ParallelJobs::run(tTotal, pJobs, tLoadTask, tLoadErrors, pProgress))
+    {
+        pErrors.push_back("Korrektur abgebrochen.");
+        return false;
+    }
+
+    bool tSuccess = true;
+
+    //Calculate the chain serially from the summaries, up to the first report that could not be loaded
+
+    int tChainLength = tTotal;
+
+    for (int i = 0; i < tTotal; ++i)
+    {
+        if (tLoadErrors[static_cast<std::size_t>(i)] != "")
+        {
+            pErrors.push_back(tLoadErrors[static_cast<std::size_t>(i)]);
+            tSuccess = false;
+
+            if (tChainLength == tTotal)
+                tChainLength = i;
+        }
+    }
+
+    std::vector<Change> tChanges;
+
+    for (int i = 1; i < tChainLength; ++i)
+    {
+        const Report::CarryoverSummary& tLastSummary = summaries[static_cast<std::size_t>(i - 1)];
+        Report::CarryoverSummary& tSummary = summaries[static_cast<std::size_t>(i)];
+
+        const Report::CarryoverSummary tOldSummary = tSummary;
+
+        //Corrected summary is used for the next report
+        if (Report::calculateCarryovers(tLastSummary, tSummary))
+            tChanges.push_back({pFileNames[i], tOldSummary, tSummary});
+    }
+
+    //Only reports actually checked against their previous report are unchanged (not the first one and not any failed one)
+    pUnchanged = std::max(tChainLength - 1, 0) - static_cast<int>(tChanges.size());
+
+    if (!pDryRun && !tChanges.empty())
+    {
+        //Load, correct and save only the changed reports
+
+        auto tSaveTask = [&tChanges, &tBoatmanRequiredLicense](int pIndex) -> QString
+        {
+            const Change& tChange = tChanges[static_cast<std::size_t>(pIndex)];
+
+            Report tReport;
+
+            if (!tReport.open(tChange.fileName, tBoatmanRequiredLicense))
+            {
+                std::cerr<<"ERROR: Could not load report \""<<tChange.fileName.toStdString()<<"\"!"<<std::endl;
+                return "Konnte Wachbericht \"" + tChange.fileName + "\" nicht laden!";
+            }
+
+            tReport.setCarryovers(tChange.newSummary);
+
+            if (!tReport.save(tReport.getFileName()))
+            {
+                std::cerr<<"ERROR: Could not save report \""<<tReport.getFileName().toStdString()<<"\"!"<<std::endl;
+                return "Konnte Wachbericht \"" + tReport.getFileName() + "\" nicht speichern!";
+            }
+
+            return "";
+        };
+
+        std::vector<QString> tSaveErrors;
+
+        if (!ParallelJobs::run(static_cast<int>(tChanges.size()), pJobs, tSaveTask, tSaveErrors, pProgress))
+        {
+            pErrors.push_back("Korrektur abgebrochen.");
+            tSuccess = false;
+        }
+
+        for (QString& tError : tSaveErrors)
+        {
+            if (tError != "")
+            {
+                pErrors.push_back(std::move(tError));
+                tSuccess = false;
+            }
+        }
+    }
+
+    pChanges.insert(pChanges.end(), tChanges.begin(), tChanges.end());
+
+    return tSuccess;
+}
+
+//
+
+/*!
+ * \brief List the changed values of a report in readable form.
+ *
+ * Creates one line per changed value of the form "<Wert>: <alt> -> <neu>".
+ * Hours carries are shown as "hh:mm".
+ *
+ * \param pChange Carryover change of a report.
+ * \return Lines describing the changed values.
+ */
+QStringList CarryoverFixer::describeChange(const Change& pChange)
+{
+    auto tMinutesToString = [](int pMinutes) -> QString
+    {
+        return QString("%1:%2").arg(pMinutes / 60).arg(pMinutes % 60, 2, 10, QChar('0'));
+    };
+
+    const Report::CarryoverSummary& tOld = pChange.oldSummary;
+    const Report::CarryoverSummary& tNew = pChange.newSummary;
+
+    QStringList tLines;
+
+    if (tOld.number != tNew.number)
+        tLines.append("Nummer: " + QString::number(tOld.number) + " -> " + QString::number(tNew.number));
+    if (tOld.personnelMinutesCarry != tNew.personnelMinutesCarry)
+        tLines.append("Übertrag Personalstunden: " + tMinutesToString(tOld.personnelMinutesCarry) + " -> " +
+                      tMinutesToString(tNew.personnelMinutesCarry));
+    if (tOld.boatMinutesCarry != tNew.boatMinutesCarry)
+        tLines.append("Übertrag Bootsstunden: " + tMinutesToString(tOld.boatMinutesCarry) + " -> " +
+                      tMinutesToString(tNew.boatMinutesCarry));
+    if (tOld.engineHoursInitial != tNew.engineHoursInitial)
+        tLines.append("Motorstunden Beginn: " + QString::number(tOld.engineHoursInitial, 'f', 1) + " -> " +
+                      QString::number(tNew.engineHoursInitial, 'f', 1));
+    if (tOld.engineHoursFinal != tNew.engineHoursFinal)
+        tLines.append("Motorstunden Ende: " + QString::number(tOld.engineHoursFinal, 'f', 1) + " -> " +
+                      QString::number(tNew.engineHoursFinal, 'f', 1));
+
+    return tLines;
+}
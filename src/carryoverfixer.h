@@ -0,0 +1,68 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CARRYOVERFIXER_H
+#define CARRYOVERFIXER_H
+
+#include "report.h"
+
+#include <QString>
+#include <QStringList>
+
+#include <functional>
+#include <vector>
+
+/*!
+ * \brief Correct the carryovers of a chronological chain of reports.
+ *
+ * Each report's carryovers (and serial number) follow from the previous report (see Report::loadCarryovers()),
+ * which makes the chain inherently serial. Only the cheap calculation step is serial here, though: All reports
+ * are loaded in parallel (see ParallelJobs::run()) and reduced to their Report::CarryoverSummary, the chain is then
+ * calculated from these summaries alone (see Report::calculateCarryovers()) and finally only the reports whose
+ * carryovers actually change are loaded again, corrected and saved (again in parallel).
+ *
+ * With a dry run, the changes are only determined but no file is written (see fixCarryovers()).
+ */
+class CarryoverFixer
+{
+public:
+    /*!
+     * \brief Carryover change of a single report.
+     */
+    struct Change
+    {
+        QString fileName;                       ///< File name of the report.
+        Report::CarryoverSummary oldSummary;    ///< Carryovers saved in the report file.
+        Report::CarryoverSummary newSummary;    ///< Corrected carryovers.
+    };
+
+public:
+    CarryoverFixer() = delete;  ///< Deleted constructor.
+    //
+    static bool fixCarryovers(const QStringList& pFileNames, int pJobs, bool pDryRun,
+                              std::vector<Change>& pChanges, int& pUnchanged, QStringList& pErrors,
+                              const std::function<bool(int, int)>& pProgress = nullptr);   ///< Correct the carryovers of a chain of reports.
+    //
+    static QStringList describeChange(const Change& pChange);   ///< List the changed values of a report in readable form.
+};
+
+#endif // CARRYOVERFIXER_H
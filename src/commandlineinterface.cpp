@@ -0,0 +1,650 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "commandlineinterface.h"
+
+#include "batchexporter.h"
+#include "carryoverfixer.h"
+#include "databasecache.h"
+#include "databasecreator.h"
+#include "paralleljobs.h"
+#include "reportarchiveindex.h"
+#include "report.h"
+#include "settingscache.h"
+#include "version.h"
+
+#include <QCommandLineOption>
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDate>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QIODevice>
+#include <QStandardPaths>
+#include <QtSql/QSqlDatabase>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//Public
+
+/*!
+ * \brief Check, if the program shall run without graphical user interface.
+ *
+ * \param pArgc Number of command line arguments (as passed to main()).
+ * \param pArgv Command line arguments (as passed to main()).
+ * \return If the first command line argument is "--cli".
+ */
+bool CommandLineInterface::isRequested(const int pArgc, char* pArgv[])
+{
+    return pArgc > 1 && std::strcmp(pArgv[1], "--cli") == 0;
+}
+
+/*!
+ * \brief Run a batch operation without graphical user interface.
+ *
+ * Creates a QCoreApplication, parses the command line (see class description for the available commands),
+ * opens the databases (see openDatabases()) and executes the requested command.
+ *
+ * Warning message boxes of the settings are suppressed (see SettingsCache::setMessageBoxesDisabled()).
+ *
+ * \param pArgc Number of command line arguments (as passed to main()).
+ * \param pArgv Command line arguments (as passed to main()).
+ * \return Process exit code (see ExitCode).
+ */
+int CommandLineInterface::run(int pArgc, char* pArgv[])
+{
+    QCoreApplication a(pArgc, pArgv);
+
+    //There is no QApplication and hence message boxes cannot be used (settings are read e.g. when loading reports)
+    SettingsCache::setMessageBoxesDisabled(true);
+    QCoreApplication::setApplicationVersion(QString(Version::ProgramVersionMajor) + "." + Version::ProgramVersionMinor + "." +
+                                            Version::ProgramVersionPatch);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Batch operations on reports without graphical user interface.\n\n"
+                                     "Commands:\n"
+                                     "  export           Export reports to PDF files (extension replaced by .pdf).\n"
+                                     "  fix-carryovers   Correct carryovers of each report using the previous report (see --dry-run).\n"
+                                     "  validate         Check that reports can be loaded.\n"
+                                     "  statistics       Print a summary of each report and of all reports.\n"
+                                     "  index            Add reports or directories (recursively) to the report archive index.\n"
+                                     "  list             List indexed reports (see --station, --from, --to, --latest).");
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    const QCommandLineOption cliOption("cli", "Run without graphical user interface (required as first argument).");
+    const QCommandLineOption jobsOption({"j", "jobs"}, "Number of parallel jobs (default: number of cores).", "n");
+    const QCommandLineOption carryoversOption("check-carryovers", "Also check carryovers of each report against the previous report.");
+    const QCommandLineOption dryRunOption("dry-run", "Only print carryover changes without saving any report.");
+    const QCommandLineOption stationOption("station", "Only list reports of this station identifier.", "ident");
+    const QCommandLineOption fromOption("from", "Only list reports from this date on (YYYY-MM-DD).", "date");
+    const QCommandLineOption toOption("to", "Only list reports up to this date (YYYY-MM-DD).", "date");
+    const QCommandLineOption latestOption("latest", "Only list the latest report of the station (requires --station).");
+
+    parser.addOption(cliOption);
+    parser.addOption(jobsOption);
+    parser.addOption(carryoversOption);
+    parser.addOption(dryRunOption);
+    parser.addOption(stationOption);
+    parser.addOption(fromOption);
+    parser.addOption(toOption);
+    parser.addOption(latestOption);
+
+    parser.addPositionalArgument("command", "Command to execute (see above).");
+    parser.addPositionalArgument("files", "Report files, in chronological order for carryovers (or directories for index).",
+                                 "<files...>");
+
+    //Only print errors instead of calling exit() like QCommandLineParser::process() does
+    if (!parser.parse(a.arguments()))
+    {
+        std::cerr<<"ERROR: "<<parser.errorText().toStdString()<<std::endl;
+        return static_cast<int>(ExitCode::_USAGE_ERROR);
+    }
+
+    if (parser.isSet("help"))
+    {
+        std::cout<<parser.helpText().toStdString();
+        return static_cast<int>(ExitCode::_SUCCESS);
+    }
+    if (parser.isSet("version"))
+    {
+        std::cout<<QCoreApplication::applicationVersion().toStdString()<<std::endl;
+        return static_cast<int>(ExitCode::_SUCCESS);
+    }
+
+    QStringList positionalArgs = parser.positionalArguments();
+
+    if (positionalArgs.isEmpty())
+    {
+        std::cerr<<"ERROR: No command specified!"<<std::endl;
+        std::cerr<<parser.helpText().toStdString();
+        return static_cast<int>(ExitCode::_USAGE_ERROR);
+    }
+
+    const QString command = positionalArgs.takeFirst();
+
+    if (command != "export" && command != "fix-carryovers" && command != "validate" && command != "statistics" &&
+        command != "index" && command != "list")
+    {
+        std::cerr<<"ERROR: Invalid command \""<<command.toStdString()<<"\"!"<<std::endl;
+        return static_cast<int>(ExitCode::_USAGE_ERROR);
+    }
+
+    int jobs = ParallelJobs::defaultJobCount();
+
+    if (parser.isSet(jobsOption))
+    {
+        bool tOk = false;
+        jobs = parser.value(jobsOption).toInt(&tOk);
+
+        if (!tOk || jobs < 1)
+        {
+            std::cerr<<"ERROR: Invalid number of jobs!"<<std::endl;
+            return static_cast<int>(ExitCode::_USAGE_ERROR);
+        }
+    }
+
+    QDate fromDate(1, 1, 1);
+    QDate toDate(9999, 12, 31);
+
+    if (parser.isSet(fromOption))
+        fromDate = QDate::fromString(parser.value(fromOption), Qt::ISODate);
+    if (parser.isSet(toOption))
+        toDate = QDate::fromString(parser.value(toOption), Qt::ISODate);
+
+    if (!fromDate.isValid() || !toDate.isValid())
+    {
+        std::cerr<<"ERROR: Invalid date!"<<std::endl;
+        return static_cast<int>(ExitCode::_USAGE_ERROR);
+    }
+
+    if (parser.isSet(latestOption) && !parser.isSet(stationOption))
+    {
+        std::cerr<<"ERROR: Option \"--latest\" requires option \"--station\"!"<<std::endl;
+        return static_cast<int>(ExitCode::_USAGE_ERROR);
+    }
+
+    if (positionalArgs.isEmpty() && command != "list")
+    {
+        std::cerr<<"WARNING: Nothing to be done!"<<std::endl;
+        return static_cast<int>(ExitCode::_SUCCESS);
+    }
+
+    std::shared_ptr<QLockFile> confLockFilePtr, persLockFilePtr;
+
+    if (!openDatabases(confLockFilePtr, persLockFilePtr))
+        return static_cast<int>(ExitCode::_SETUP_ERROR);
+
+    if ((command == "index" || command == "list") && !ReportArchiveIndex::isOpen())
+    {
+        std::cerr<<"ERROR: Report archive index is not available!"<<std::endl;
+        return static_cast<int>(ExitCode::_SETUP_ERROR);
+    }
+
+    ExitCode exitCode = ExitCode::_SUCCESS;
+
+    if (command == "export")
+        exitCode = exportReports(positionalArgs, jobs);
+    else if (command == "fix-carryovers")
+        exitCode = fixCarryovers(positionalArgs, jobs, parser.isSet(dryRunOption));
+    else if (command == "validate")
+        exitCode = validateReports(positionalArgs, parser.isSet(carryoversOption));
+    else if (command == "statistics")
+        exitCode = printStatistics(positionalArgs);
+    else if (command == "index")
+        exitCode = indexReports(positionalArgs, jobs);
+    else
+        exitCode = listReports(parser.value(stationOption), fromDate, toDate, parser.isSet(latestOption));
+
+    return static_cast<int>(exitCode);
+}
+
+//Private
+
+/*!
+ * \brief Open and cache the databases for reading.
+ *
+ * Locates the configuration and personnel databases like the graphical user interface does (including
+ * an alternative database directory configured in "dbPath.conf"), opens them, checks their versions
+ * and populates the DatabaseCache. Nothing is created or upgraded and no dialogs are shown.
+ * Also opens the report archive index (see ReportArchiveIndex), which is only a cache and hence may be written.
+ *
+ * The database lock files are assigned to \p pConfLockFile and \p pPersLockFile but not locked,
+ * such that the databases remain read-only (see DatabaseCache::isConfigReadOnly()).
+ *
+ * \param pConfLockFile Destination for the configuration database lock file.
+ * \param pPersLockFile Destination for the personnel database lock file.
+ * \return If successful.
+ */
+bool CommandLineInterface::openDatabases(std::shared_ptr<QLockFile>& pConfLockFile, std::shared_ptr<QLockFile>& pPersLockFile)
+{
+    QStringList standardPaths = QStandardPaths::standardLocations(QStandardPaths::AppConfigLocation);
+    if (standardPaths.size() == 0)
+    {
+        std::cerr<<"ERROR: Could not obtain standard configuration location!"<<std::endl;
+        return false;
+    }
+
+    QDir configDir(standardPaths[0]);
+    if (!configDir.cd("Wachdienst-Manager"))
+    {
+        std::cerr<<"ERROR: Configuration directory does not exist! Start the program once with graphical user interface."<<std::endl;
+        return false;
+    }
+
+    QDir personnelDir = configDir;
+
+    //Use alternative database directories from 'dbPath.conf', if it exists (see main())
+
+    QFile dbPathConfFile(configDir.filePath("dbPath.conf"));
+
+    if (dbPathConfFile.exists())
+    {
+        if (!dbPathConfFile.open(QIODevice::ReadOnly))
+        {
+            std::cerr<<"ERROR: Could not read alternative configuration directory path from \"dbPath.conf\"!"<<std::endl;
+            return false;
+        }
+
+        QString alternativeDbPath = dbPathConfFile.readLine().trimmed();
+        QString alternativeDbPath2 = dbPathConfFile.readLine().trimmed();
+
+        dbPathConfFile.close();
+
+        if (alternativeDbPath != "" && !configDir.cd(QDir(alternativeDbPath).absolutePath()))
+        {
+            std::cerr<<"ERROR: Could not change into the alternative configuration directory!"<<std::endl;
+            return false;
+        }
+
+        if (alternativeDbPath2 == "")
+            personnelDir = configDir;
+        else if (!personnelDir.cd(QDir(alternativeDbPath2).absolutePath()))
+        {
+            std::cerr<<"ERROR: Could not change into the alternative personnel directory!"<<std::endl;
+            return false;
+        }
+    }
+
+    QString confDbFileName = configDir.filePath("configuration.sqlite3");
+    QString personnelDbFileName = personnelDir.filePath("personnel.sqlite3");
+
+    if (!QFileInfo::exists(confDbFileName) || !QFileInfo::exists(personnelDbFileName))
+    {
+        std::cerr<<"ERROR: Databases do not exist! Start the program once with graphical user interface."<<std::endl;
+        return false;
+    }
+
+    QSqlDatabase confDatabase = QSqlDatabase::addDatabase("QSQLITE", "configDb");
+    confDatabase.setDatabaseName(confDbFileName);
+
+    QSqlDatabase personnelDatabase = QSqlDatabase::addDatabase("QSQLITE", "personnelDb");
+    personnelDatabase.setDatabaseName(personnelDbFileName);
+
+    //Note: this is just for "completeness" and not intended to be secure...
+    confDatabase.setUserName("DLRG_conf");
+    confDatabase.setPassword("password");
+
+    //Note: this is just for "completeness" and not intended to be secure...
+    personnelDatabase.setUserName("DLRG_pers");
+    personnelDatabase.setPassword("password");
+
+    if (!confDatabase.open())
+    {
+        std::cerr<<"ERROR: Could not open configuration database!"<<std::endl;
+        return false;
+    }
+    if (!personnelDatabase.open())
+    {
+        std::cerr<<"ERROR: Could not open personnel database!"<<std::endl;
+        return false;
+    }
+
+    if (!DatabaseCreator::checkConfigVersion() || !DatabaseCreator::checkPersonnelVersion())
+    {
+        std::cerr<<"ERROR: Unsupported database version! Start the program once with graphical user interface."<<std::endl;
+        return false;
+    }
+
+    //Do not lock the lock files in order to only read from the databases
+    pConfLockFile = std::make_shared<QLockFile>(configDir.filePath("db.lock"));
+    pPersLockFile = pConfLockFile;
+
+    if (personnelDir.absolutePath() != configDir.absolutePath())
+        pPersLockFile = std::make_shared<QLockFile>(personnelDir.filePath("db.lock"));
+
+    if (!DatabaseCache::populate(pConfLockFile, pPersLockFile))
+    {
+        std::cerr<<"ERROR: Could not cache database entries!"<<std::endl;
+        return false;
+    }
+
+    //Report archive index is only needed by some commands (see run())
+    if (!ReportArchiveIndex::open(configDir.filePath("archive.sqlite3")))
+        std::cerr<<"WARNING: Could not open report archive index!"<<std::endl;
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Export reports to PDF files in parallel.
+ *
+ * Uses BatchExporter::exportReports() with \p pJobs parallel jobs. Prints a "PROGRESS" record whenever
+ * another report has been processed, a "FAILED" record for each failed report and a final "SUMMARY" record.
+ *
+ * \param pFileNames Report file names.
+ * \param pJobs Number of parallel export jobs.
+ * \return ExitCode::_SUCCESS, if all reports were exported, and ExitCode::_FAILURE otherwise.
+ */
+CommandLineInterface::ExitCode CommandLineInterface::exportReports(const QStringList& pFileNames, const int pJobs)
+{
+    int tLastDone = -1;
+
+    auto tProgress = [&tLastDone](int pDone, int pTotal) -> bool
+    {
+        if (pDone != tLastDone)
+        {
+            std::cout<<"PROGRESS\t"<<pDone<<"\t"<<pTotal<<std::endl;
+            tLastDone = pDone;
+        }
+
+        return true;
+    };
+
+    QStringList tErrors;
+
+    bool tSuccess = BatchExporter::exportReports(pFileNames, pJobs, tErrors, tProgress);
+
+    for (const QString& tError : tErrors)
+        std::cout<<"FAILED\t"<<tError.toStdString()<<std::endl;
+
+    std::cout<<"SUMMARY\t"<<(pFileNames.size() - tErrors.size())<<"\t"<<tErrors.size()<<std::endl;
+
+    return tSuccess ? ExitCode::_SUCCESS : ExitCode::_FAILURE;
+}
+
+/*!
+ * \brief Correct the carryovers of a chain of reports.
+ *
+ * Uses CarryoverFixer::fixCarryovers() with \p pJobs parallel jobs. Prints a "CHANGED" record with the field name,
+ * the old and the new value for each changed value of each changed report, a "FAILED" record for each report
+ * that could not be loaded, saved or indexed (see ReportArchiveIndex::update()) and a final "SUMMARY" record
+ * with the numbers of changed, unchanged and failed reports.
+ * Reports after the first report that could not be loaded are not checked and hence not counted as unchanged.
+ * If \p pDryRun is true, the changes are only printed but no report is saved.
+ *
+ * \param pFileNames Report file names in chronological order.
+ * \param pJobs Number of parallel jobs.
+ * \param pDryRun Only print the changes without saving?
+ * \return ExitCode::_SUCCESS, if all reports were processed, and ExitCode::_FAILURE otherwise.
+ */
+CommandLineInterface::ExitCode CommandLineInterface::fixCarryovers(const QStringList& pFileNames, const int pJobs, const bool pDryRun)
+{
+    std::vector<CarryoverFixer::Change> tChanges;
+    int tUnchanged = 0;
+    QStringList tErrors;
+
+    bool tSuccess = CarryoverFixer::fixCarryovers(pFileNames, pJobs, pDryRun, tChanges, tUnchanged, tErrors);
+
+    //Refresh report archive index entries of all rewritten reports
+    if (!pDryRun)
+    {
+        QStringList tChangedFiles;
+        QStringList tIndexErrors;
+
+        for (const CarryoverFixer::Change& tChange : tChanges)
+            tChangedFiles.append(tChange.fileName);
+
+        ReportArchiveIndex::update(tChangedFiles, tIndexErrors, pJobs);
+
+        if (!tIndexErrors.isEmpty())
+        {
+            tErrors.append(tIndexErrors);
+            tSuccess = false;
+        }
+    }
+
+    for (const CarryoverFixer::Change& tChange : tChanges)
+    {
+        const std::string tFileName = tChange.fileName.toStdString();
+
+        const Report::CarryoverSummary& tOld = tChange.oldSummary;
+        const Report::CarryoverSummary& tNew = tChange.newSummary;
+
+        if (tOld.number != tNew.number)
+            std::cout<<"CHANGED\t"<<tFileName<<"\tnumber\t"<<tOld.number<<"\t"<<tNew.number<<std::endl;
+        if (tOld.personnelMinutesCarry != tNew.personnelMinutesCarry)
+            std::cout<<"CHANGED\t"<<tFileName<<"\tpersonnelMinutesCarry\t"<<tOld.personnelMinutesCarry<<"\t"
+                     <<tNew.personnelMinutesCarry<<std::endl;
+        if (tOld.boatMinutesCarry != tNew.boatMinutesCarry)
+            std::cout<<"CHANGED\t"<<tFileName<<"\tboatMinutesCarry\t"<<tOld.boatMinutesCarry<<"\t"<<tNew.boatMinutesCarry<<std::endl;
+        if (tOld.engineHoursInitial != tNew.engineHoursInitial)
+            std::cout<<"CHANGED\t"<<tFileName<<"\tengineHoursInitial\t"<<tOld.engineHoursInitial<<"\t"<<tNew.engineHoursInitial<<std::endl;
+        if (tOld.engineHoursFinal != tNew.engineHoursFinal)
+            std::cout<<"CHANGED\t"<<tFileName<<"\tengineHoursFinal\t"<<tOld.engineHoursFinal<<"\t"<<tNew.engineHoursFinal<<std::endl;
+    }
+
+    for (const QString& tError : tErrors)
+        std::cout<<"FAILED\t"<<tError.toStdString()<<std::endl;
+
+    std::cout<<"SUMMARY\t"<<tChanges.size()<<"\t"<<tUnchanged<<"\t"<<tErrors.size()<<std::endl;
+
+    return tSuccess ? ExitCode::_SUCCESS : ExitCode::_FAILURE;
+}
+
+/*!
+ * \brief Check that reports are valid.
+ *
+ * Tries to load each report and prints an "OK" or "INVALID" record for it. If \p pCheckCarryovers is true,
+ * additionally checks that the carryovers of each report match the carryovers calculated from the previous
+ * (valid) report in the order of \p pFileNames and prints a "CARRYOVER_MISMATCH" record instead of "OK" otherwise.
+ * Prints a final "SUMMARY" record.
+ *
+ * \param pFileNames Report file names (in chronological order, if \p pCheckCarryovers is true).
+ * \param pCheckCarryovers Check the carryovers?
+ * \return ExitCode::_SUCCESS, if all reports are valid, and ExitCode::_FAILURE otherwise.
+ */
+CommandLineInterface::ExitCode CommandLineInterface::validateReports(const QStringList& pFileNames, const bool pCheckCarryovers)
+{
+    Report report;
+
+    //Only the previous report's carryover summary is needed for checking the carryovers
+    Report::CarryoverSummary lastSummary;
+    bool lastReportValid = false;
+
+    int tInvalid = 0;
+
+    for (const QString& tFileName : pFileNames)
+    {
+        if (!report.open(tFileName))
+        {
+            std::cout<<"INVALID\t"<<tFileName.toStdString()<<std::endl;
+            ++tInvalid;
+
+            //Cannot check the next report's carryovers against this one
+            lastReportValid = false;
+            continue;
+        }
+
+        if (pCheckCarryovers && lastReportValid)
+        {
+            Report::CarryoverSummary tSummary = report.getCarryoverSummary();
+
+            if (Report::calculateCarryovers(lastSummary, tSummary))
+            {
+                std::cout<<"CARRYOVER_MISMATCH\t"<<tFileName.toStdString()<<std::endl;
+                ++tInvalid;
+
+                lastSummary = report.getCarryoverSummary();
+                continue;
+            }
+        }
+
+        std::cout<<"OK\t"<<tFileName.toStdString()<<std::endl;
+
+        lastSummary = report.getCarryoverSummary();
+        lastReportValid = true;
+    }
+
+    std::cout<<"SUMMARY\t"<<(pFileNames.size() - tInvalid)<<"\t"<<tInvalid<<std::endl;
+
+    return tInvalid == 0 ? ExitCode::_SUCCESS : ExitCode::_FAILURE;
+}
+
+/*!
+ * \brief Print a summary of reports.
+ *
+ * Prints a "REPORT" record for each report with the fields file name, serial number, date, station,
+ * duty begin and end time, personnel strength, number of boat drives and the personnel and boat hours carryovers
+ * (in minutes). Reports that cannot be loaded are reported by an "INVALID" record. Finally prints a "SUMMARY" record
+ * with the number of reports, the total personnel strength and the total number of boat drives.
+ *
+ * \param pFileNames Report file names.
+ * \return ExitCode::_SUCCESS, if all reports could be loaded, and ExitCode::_FAILURE otherwise.
+ */
+CommandLineInterface::ExitCode CommandLineInterface::printStatistics(const QStringList& pFileNames)
+{
+    Report report;
+
+    int tReports = 0;
+    int tPersonnel = 0;
+    int tBoatDrives = 0;
+    int tInvalid = 0;
+
+    for (const QString& tFileName : pFileNames)
+    {
+        if (!report.open(tFileName))
+        {
+            std::cout<<"INVALID\t"<<tFileName.toStdString()<<std::endl;
+            ++tInvalid;
+            continue;
+        }
+
+        const int tPersonnelSize = report.getPersonnelSize();
+        const int tDrivesCount = report.boatLog()->getDrivesCount();
+
+        std::cout<<"REPORT\t"<<tFileName.toStdString()<<"\t"<<report.getNumber()<<"\t"
+                 <<report.getDate().toString(Qt::ISODate).toStdString()<<"\t"<<report.getStation().toStdString()<<"\t"
+                 <<report.getBeginTime().toString("hh:mm").toStdString()<<"\t"<<report.getEndTime().toString("hh:mm").toStdString()<<"\t"
+                 <<tPersonnelSize<<"\t"<<tDrivesCount<<"\t"
+                 <<report.getPersonnelMinutesCarry()<<"\t"<<report.boatLog()->getBoatMinutesCarry()<<std::endl;
+
+        ++tReports;
+        tPersonnel += tPersonnelSize;
+        tBoatDrives += tDrivesCount;
+    }
+
+    std::cout<<"SUMMARY\t"<<tReports<<"\t"<<tPersonnel<<"\t"<<tBoatDrives<<std::endl;
+
+    return tInvalid == 0 ? ExitCode::_SUCCESS : ExitCode::_FAILURE;
+}
+
+/*!
+ * \brief Add reports to the report archive index.
+ *
+ * Updates the index entries of all report files and of all report files in directories (recursively) given
+ * in \p pFileNames (see ReportArchiveIndex::update() and ReportArchiveIndex::updateDirectory()).
+ * Prints a "FAILED" record for each report that could not be loaded and a final "SUMMARY" record
+ * with the numbers of added/refreshed entries and failed reports.
+ *
+ * \param pFileNames Report file names or directories.
+ * \param pJobs Number of parallel jobs.
+ * \return ExitCode::_SUCCESS, if all reports could be loaded, and ExitCode::_FAILURE otherwise.
+ */
+CommandLineInterface::ExitCode CommandLineInterface::indexReports(const QStringList& pFileNames, const int pJobs)
+{
+    QStringList tFileNames;
+    QStringList tErrors;
+
+    int tUpdated = 0;
+
+    for (const QString& tFileName : pFileNames)
+    {
+        if (QFileInfo(tFileName).isDir())
+            tUpdated += ReportArchiveIndex::updateDirectory(tFileName, true, tErrors, pJobs);
+        else
+            tFileNames.append(tFileName);
+    }
+
+    tUpdated += ReportArchiveIndex::update(tFileNames, tErrors, pJobs);
+
+    for (const QString& tError : tErrors)
+        std::cout<<"FAILED\t"<<tError.toStdString()<<std::endl;
+
+    std::cout<<"SUMMARY\t"<<tUpdated<<"\t"<<tErrors.size()<<std::endl;
+
+    return tErrors.isEmpty() ? ExitCode::_SUCCESS : ExitCode::_FAILURE;
+}
+
+/*!
+ * \brief List reports from the report archive index.
+ *
+ * Prints a "REPORT" record (with the same fields as printStatistics()) for each indexed report of station \p pStation
+ * (or of all stations, if empty) with a date from \p pFrom to \p pTo, sorted by date (see ReportArchiveIndex::reports()).
+ * If \p pLatest is true, only prints the latest existing report of the station (see ReportArchiveIndex::latestReport()).
+ * Reports are not loaded, so the listing reflects the state of the last index update.
+ *
+ * \param pStation Station identifier.
+ * \param pFrom First date.
+ * \param pTo Last date.
+ * \param pLatest Only list the latest report of the station?
+ * \return ExitCode::_FAILURE, if no report was found in case of \p pLatest, and ExitCode::_SUCCESS otherwise.
+ */
+CommandLineInterface::ExitCode CommandLineInterface::listReports(const QString& pStation, const QDate pFrom, const QDate pTo,
+                                                                 const bool pLatest)
+{
+    std::vector<ReportArchiveIndex::Entry> tEntries;
+
+    if (pLatest)
+    {
+        ReportArchiveIndex::Entry tEntry;
+
+        if (!ReportArchiveIndex::latestReport(pStation, tEntry))
+        {
+            std::cerr<<"ERROR: No report found for station \""<<pStation.toStdString()<<"\"!"<<std::endl;
+            return ExitCode::_FAILURE;
+        }
+
+        tEntries.push_back(std::move(tEntry));
+    }
+    else
+        tEntries = ReportArchiveIndex::reports(pFrom, pTo, pStation);
+
+    for (const ReportArchiveIndex::Entry& tEntry : tEntries)
+    {
+        std::cout<<"REPORT\t"<<tEntry.fileName.toStdString()<<"\t"<<tEntry.carryovers.number<<"\t"
+                 <<tEntry.date.toString(Qt::ISODate).toStdString()<<"\t"<<tEntry.station.toStdString()<<"\t"
+                 <<tEntry.beginTime.toString("hh:mm").toStdString()<<"\t"<<tEntry.endTime.toString("hh:mm").toStdString()<<"\t"
+                 <<tEntry.personnelSize<<"\t"<<tEntry.drivesCount<<"\t"
+                 <<tEntry.carryovers.personnelMinutesCarry<<"\t"<<tEntry.carryovers.boatMinutesCarry<<std::endl;
+    }
+
+    std::cout<<"SUMMARY\t"<<tEntries.size()<<std::endl;
+
+    return ExitCode::_SUCCESS;
+}
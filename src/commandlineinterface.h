@@ -0,0 +1,88 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef COMMANDLINEINTERFACE_H
+#define COMMANDLINEINTERFACE_H
+
+#include <QDate>
+#include <QLockFile>
+#include <QString>
+#include <QStringList>
+
+#include <memory>
+
+/*!
+ * \brief Run batch operations on reports without graphical user interface.
+ *
+ * If the program is started with "--cli" as first argument (see isRequested()), run() is used instead of starting
+ * the graphical user interface. It only creates a QCoreApplication and executes one of the following commands
+ * on a list of report files given on the command line:
+ *
+ * - "export": Export all reports to PDF files in parallel (see BatchExporter).
+ * - "fix-carryovers": Correct the carryovers of each report using the respective previous report (see CarryoverFixer).
+ * - "validate": Check that all reports can be loaded (and optionally that their carryovers are consistent).
+ * - "statistics": Print a summary of each report and of all reports.
+ * - "index": Add reports or whole directories to the report archive index (see ReportArchiveIndex).
+ * - "list": List reports from the report archive index by station and/or date range without loading them.
+ *
+ * Results are printed to standard output as tab-separated records (first field is the record type),
+ * while errors and warnings are printed to standard error. The process exit code is one of ExitCode.
+ *
+ * The databases are only read (except for the report archive index, which is only a cache),
+ * so this can also be used while another program instance is running.
+ * No dialogs are shown; missing or outdated databases are reported as errors instead of being created or upgraded.
+ */
+class CommandLineInterface
+{
+public:
+    /*!
+     * \brief Exit codes of run().
+     */
+    enum class ExitCode : int
+    {
+        _SUCCESS = 0,       ///< All reports processed successfully.
+        _FAILURE = 1,       ///< Some reports could not be processed or are invalid.
+        _USAGE_ERROR = 2,   ///< Invalid command line arguments.
+        _SETUP_ERROR = 3    ///< Databases could not be opened or cached.
+    };
+
+public:
+    CommandLineInterface() = delete;    ///< Deleted constructor.
+    //
+    static bool isRequested(int pArgc, char* pArgv[]);  ///< Check, if the program shall run without graphical user interface.
+    static int run(int pArgc, char* pArgv[]);           ///< Run a batch operation without graphical user interface.
+
+private:
+    static bool openDatabases(std::shared_ptr<QLockFile>& pConfLockFile,
+                              std::shared_ptr<QLockFile>& pPersLockFile);       ///< Open and cache the databases for reading.
+    //
+    static ExitCode exportReports(const QStringList& pFileNames, int pJobs);    ///< Export reports to PDF files in parallel.
+    static ExitCode fixCarryovers(const QStringList& pFileNames, int pJobs,
+                                  bool pDryRun);                                ///< Correct the carryovers of a chain of reports.
+    static ExitCode validateReports(const QStringList& pFileNames, bool pCheckCarryovers); ///< Check that reports are valid.
+    static ExitCode printStatistics(const QStringList& pFileNames);             ///< Print a summary of reports.
+    static ExitCode indexReports(const QStringList& pFileNames, int pJobs);     ///< Add reports to the report archive index.
+    static ExitCode listReports(const QString& pStation, QDate pFrom, QDate pTo,
+                                bool pLatest);                                  ///< List reports from the report archive index.
+};
+
+#endif // COMMANDLINEINTERFACE_H
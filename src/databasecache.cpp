@@ -22,16 +22,28 @@
 
 #include "databasecache.h"
 
+#include <QCoreApplication>
 #include <QStringList>
 #include <QValidator>
+#include <QVariant>
 #include <QtSql/QSqlDatabase>
 #include <QtSql/QSqlQuery>
 
+#include <chrono>
 #include <iostream>
+#include <mutex>
 
 //Initialize static class members
 
 bool DatabaseCache::populated = false;
+bool DatabaseCache::verifyPersonnel = false;
+bool DatabaseCache::concurrentAccess = false;
+//
+int DatabaseCache::configDataVersion = -1;
+int DatabaseCache::personnelDataVersion = -1;
+//
+std::shared_future<bool> DatabaseCache::configFuture;
+std::shared_future<bool> DatabaseCache::personnelFuture;
 //
 std::shared_ptr<QLockFile> DatabaseCache::confLockFilePtr = nullptr;
 std::shared_ptr<QLockFile> DatabaseCache::persLockFilePtr = nullptr;
@@ -39,11 +51,25 @@ std::shared_ptr<QLockFile> DatabaseCache::persLockFilePtr = nullptr;
 std::map<QString, int> DatabaseCache::settingsInt;
 std::map<QString, double> DatabaseCache::settingsDbl;
 std::map<QString, QString> DatabaseCache::settingsStr;
+std::atomic<uint64_t> DatabaseCache::settingsGenerationCounter = 1;
+//
+bool DatabaseCache::settingsWriteBehindEnabled = false;
+std::map<QString, DatabaseCache::PendingSetting> DatabaseCache::pendingSettings;
+QTimer* DatabaseCache::settingsFlushTimer = nullptr;
 //
 std::map<int, Aux::Station> DatabaseCache::stationsMap;
 std::map<int, Aux::Boat> DatabaseCache::boatsMap;
 //
 std::map<int, Person> DatabaseCache::personnelMap;
+//
+std::unordered_map<QString, int> DatabaseCache::personnelIdentIndex;
+std::unordered_map<QString, int> DatabaseCache::personnelMmbNrIndex;
+std::map<std::pair<QString, QString>, std::set<int>> DatabaseCache::personnelNameIndex;
+//
+std::shared_ptr<const std::vector<Person>> DatabaseCache::personnelSnapshotPtr = std::make_shared<const std::vector<Person>>();
+std::atomic_bool DatabaseCache::personnelSnapshotOutdated = false;
+//
+std::shared_mutex DatabaseCache::cacheMutex;
 
 //Public
 
@@ -54,6 +80,8 @@ std::map<int, Person> DatabaseCache::personnelMap;
  * i.e. a lock file is already present, then write operations to the database
  * should be prevented and hence true will be returned.
  *
+ * If concurrent access is enabled (see setConcurrentAccess()), the lock file is ignored and false is returned.
+ *
  * \return If database should be considerered read-only because lock file cannot be acquired.
  */
 bool DatabaseCache::isConfigReadOnly()
@@ -61,6 +89,9 @@ bool DatabaseCache::isConfigReadOnly()
     if (confLockFilePtr == nullptr)
         return true;
 
+    if (concurrentAccess)
+        return false;
+
     //Try to acquire lock file, again
     if (!confLockFilePtr->isLocked())
         confLockFilePtr->tryLock(100);
@@ -75,6 +106,8 @@ bool DatabaseCache::isConfigReadOnly()
  * i.e. a lock file is already present, then write operations to the database
  * should be prevented and hence true will be returned.
  *
+ * If concurrent access is enabled (see setConcurrentAccess()), the lock file is ignored and false is returned.
+ *
  * \return If database should be considerered read-only because lock file cannot be acquired.
  */
 bool DatabaseCache::isPersonnelReadOnly()
@@ -82,6 +115,9 @@ bool DatabaseCache::isPersonnelReadOnly()
     if (persLockFilePtr == nullptr)
         return true;
 
+    if (concurrentAccess)
+        return false;
+
     //Try to acquire lock file, again
     if (!persLockFilePtr->isLocked())
         persLockFilePtr->tryLock(100);
@@ -89,6 +125,69 @@ bool DatabaseCache::isPersonnelReadOnly()
     return !persLockFilePtr->isLocked();
 }
 
+/*!
+ * \brief Enable or disable concurrent database access by multiple program instances.
+ *
+ * Normally only the program instance holding the database lock files can write to the databases
+ * (see isConfigReadOnly() and isPersonnelReadOnly()). If concurrent access is enabled, the lock files are ignored
+ * and both databases are switched to SQLite's write-ahead logging (WAL) journal mode, in which readers do not block
+ * the (single) writer and vice versa. Concurrent writes from different instances are serialized by SQLite itself;
+ * a write waits up to 5 seconds for another instance's write transaction to finish (busy timeout).
+ * Note that WAL mode does not work for database files on network file systems.
+ *
+ * When disabling concurrent access, the databases are switched back to the default rollback journal mode,
+ * but only if this instance holds the lock files (other instances might still use the databases otherwise).
+ *
+ * Note: All write operations use either a single statement or a short transaction, such that other instances are not blocked for long.
+ *
+ * If the journal mode actually needs to be changed, this waits for the background loaders started by populateAsync()
+ * to finish first (see waitForConfig() and waitForPersonnel()), since changing it requires exclusive database access.
+ *
+ * \param pEnable Enable concurrent access?
+ * \return If the journal mode could be changed (if enabling) or true (if disabling).
+ */
+bool DatabaseCache::setConcurrentAccess(const bool pEnable)
+{
+    //Changing the journal mode requires exclusive database access, which is not possible
+    //while the background loaders (see populateAsync()) are still reading; so wait for them, if necessary
+
+    const QString tJournalMode = pEnable ? "wal" : "delete";
+
+    if (!hasJournalMode("configDb", tJournalMode))
+        waitForConfig();
+    if (!hasJournalMode("personnelDb", tJournalMode))
+        waitForPersonnel();
+
+    if (pEnable)
+    {
+        bool tSuccess = setJournalMode("configDb", "wal");
+        tSuccess &= setJournalMode("personnelDb", "wal");
+
+        if (!tSuccess)
+        {
+            std::cerr<<"ERROR: Could not enable write-ahead logging!"<<std::endl;
+
+            //Undo partial change, if possible
+            setConcurrentAccess(false);
+
+            return false;
+        }
+
+        concurrentAccess = true;
+    }
+    else
+    {
+        concurrentAccess = false;
+
+        if (confLockFilePtr != nullptr && confLockFilePtr->isLocked())
+            setJournalMode("configDb", "delete");
+        if (persLockFilePtr != nullptr && persLockFilePtr->isLocked())
+            setJournalMode("personnelDb", "delete");
+    }
+
+    return true;
+}
+
 //
 
 /*!
@@ -115,6 +214,13 @@ bool DatabaseCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
     if (populated && !pForce)
         return true;
 
+    //Let a running asynchronous populate action finish first
+    waitForConfig();
+    waitForPersonnel();
+
+    configFuture = std::shared_future<bool>();
+    personnelFuture = std::shared_future<bool>();
+
     //Take over lock file pointers
     confLockFilePtr = pConfLockFile;
     persLockFilePtr = pPersLockFile;
@@ -122,40 +228,38 @@ bool DatabaseCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
     //Set to false on query error, but continue and then return 'populated' at the end
     populated = true;
 
+    //Remember database states first to detect later changes by other connections
+    configDataVersion = getDataVersion("configDb");
+    personnelDataVersion = getDataVersion("personnelDb");
+
     //Load application settings
 
     //Integer type settings
-    settingsInt.clear();
-    populated &= loadIntSettings();
+    populated &= loadIntSettings("configDb", true);
 
     //Floating-point type settings
-    settingsDbl.clear();
-    populated &= loadDblSettings();
+    populated &= loadDblSettings("configDb", true);
 
     //String type settings
-    settingsStr.clear();
-    populated &= loadStrSettings();
+    populated &= loadStrSettings("configDb", true);
 
     //Load stations
 
-    stationsMap.clear();
-    populated &= loadStations();
+    populated &= loadStations("configDb", true);
 
     if (stationsMap.empty())
         std::cerr<<"WARNING: No stations found in database!"<<std::endl;
 
     //Load boats
 
-    boatsMap.clear();
-    populated &= loadBoats();
+    populated &= loadBoats("configDb", true);
 
     if (boatsMap.empty())
         std::cerr<<"WARNING: No boats found in database!"<<std::endl;
 
     //Load personnel
 
-    personnelMap.clear();
-    populated &= loadPersonnel();
+    populated &= loadPersonnel("personnelDb", true);
 
     if (personnelMap.empty())
         std::cerr<<"WARNING: No personnel found in database!"<<std::endl;
@@ -163,6 +267,182 @@ bool DatabaseCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
     return populated;
 }
 
+/*!
+ * \brief Fill database cache asynchronously with fields from settings and personnel databases.
+ *
+ * Does the same as populate() but returns immediately. The configuration database (settings,
+ * stations and boats) and the personnel database are loaded in parallel by two worker threads, each using
+ * its own, temporary database connection cloned from "configDb" or "personnelDb", respectively
+ * (see loadConfigInBackground() and loadPersonnelInBackground()).
+ *
+ * Before accessing any cached settings, stations or boats, waitForConfig() must be called. Likewise,
+ * waitForPersonnel() must be called before accessing the cached personnel. Use isConfigReady()
+ * and isPersonnelReady() to check without blocking whether loading has finished.
+ *
+ * \param pConfLockFile Pointer to a lock file for the configuration database.
+ * \param pPersLockFile Pointer to a lock file for the personnel database.
+ * \param pForce Populate cache even if already populated.
+ */
+void DatabaseCache::populateAsync(const std::shared_ptr<QLockFile> pConfLockFile, const std::shared_ptr<QLockFile> pPersLockFile,
+                                  const bool pForce)
+{
+    if (populated && !pForce)
+        return;
+
+    //Let a running asynchronous populate action finish first
+    waitForConfig();
+    waitForPersonnel();
+
+    //Take over lock file pointers
+    confLockFilePtr = pConfLockFile;
+    persLockFilePtr = pPersLockFile;
+
+    //Loading errors are reported by waitForConfig() and waitForPersonnel()
+    populated = true;
+
+    //Remember database states first to detect later changes by other connections
+    configDataVersion = getDataVersion("configDb");
+    personnelDataVersion = getDataVersion("personnelDb");
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        settingsInt.clear();
+        settingsDbl.clear();
+        settingsStr.clear();
+        stationsMap.clear();
+        boatsMap.clear();
+        clearPersonnel();
+        publishPersonnelSnapshot();
+    }
+
+    configFuture = std::async(std::launch::async, &DatabaseCache::loadConfigInBackground).share();
+    personnelFuture = std::async(std::launch::async, &DatabaseCache::loadPersonnelInBackground).share();
+}
+
+/*!
+ * \brief Wait until the configuration cache is filled.
+ *
+ * Blocks until the configuration database was loaded into the cache by populateAsync().
+ * Returns immediately, if populateAsync() was not used.
+ *
+ * \return If loading the configuration database was successful (or populateAsync() not used).
+ */
+bool DatabaseCache::waitForConfig()
+{
+    return !configFuture.valid() || configFuture.get();
+}
+
+/*!
+ * \brief Wait until the personnel cache is filled.
+ *
+ * Blocks until the personnel database was loaded into the cache by populateAsync().
+ * Returns immediately, if populateAsync() was not used.
+ *
+ * \return If loading the personnel database was successful (or populateAsync() not used).
+ */
+bool DatabaseCache::waitForPersonnel()
+{
+    return !personnelFuture.valid() || personnelFuture.get();
+}
+
+/*!
+ * \brief Check if the configuration cache is filled.
+ *
+ * \return If loading the configuration database by populateAsync() has finished (or populateAsync() not used).
+ */
+bool DatabaseCache::isConfigReady()
+{
+    return !configFuture.valid() || configFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+/*!
+ * \brief Check if the personnel cache is filled.
+ *
+ * \return If loading the personnel database by populateAsync() has finished (or populateAsync() not used).
+ */
+bool DatabaseCache::isPersonnelReady()
+{
+    return !personnelFuture.valid() || personnelFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+//
+
+/*!
+ * \brief Check if the configuration database was changed by another connection.
+ *
+ * Compares SQLite's 'data_version' of the configuration database with its value from the previous check
+ * (or from populate()). The value changes, whenever another connection (e.g. another program instance
+ * or an external tool) commits changes to the database. Own changes do not change the value.
+ *
+ * \return If the database was changed by another connection since the last check.
+ */
+bool DatabaseCache::configChanged()
+{
+    int tDataVersion = getDataVersion("configDb");
+
+    if (tDataVersion == -1 || tDataVersion == configDataVersion)
+        return false;
+
+    configDataVersion = tDataVersion;
+
+    return true;
+}
+
+/*!
+ * \brief Check if the personnel database was changed by another connection.
+ *
+ * See configChanged().
+ *
+ * \return If the database was changed by another connection since the last check.
+ */
+bool DatabaseCache::personnelChanged()
+{
+    int tDataVersion = getDataVersion("personnelDb");
+
+    if (tDataVersion == -1 || tDataVersion == personnelDataVersion)
+        return false;
+
+    personnelDataVersion = tDataVersion;
+
+    return true;
+}
+
+/*!
+ * \brief Re-load settings, stations and boats from configuration database into cache.
+ *
+ * Loads the settings, stations and boats again from the configuration database and replaces the cached ones.
+ * The personnel cache is not touched.
+ *
+ * \return If successful.
+ */
+bool DatabaseCache::reloadConfig()
+{
+    //Write deferred settings first, which would otherwise be lost from cache
+    bool tSuccess = flushSettings();
+
+    tSuccess &= loadIntSettings("configDb", true);
+    tSuccess &= loadDblSettings("configDb", true);
+    tSuccess &= loadStrSettings("configDb", true);
+    tSuccess &= loadStations("configDb", true);
+    tSuccess &= loadBoats("configDb", true);
+
+    return tSuccess;
+}
+
+/*!
+ * \brief Re-load personnel from personnel database into cache.
+ *
+ * Loads the personnel again from the personnel database and replaces the personnel cache.
+ * The cached settings, stations and boats are not touched.
+ *
+ * \return If successful.
+ */
+bool DatabaseCache::reloadPersonnel()
+{
+    return loadPersonnel("personnelDb", true);
+}
+
 //
 
 /*!
@@ -176,6 +456,8 @@ bool DatabaseCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
  * If the setting was not found and \p pCreate is false, the function returns false.
  * If the setting was not found and \p pCreate is true, the function returns, whether writing to database was successful.
  *
+ * Note: If \p pCreate is true, this must be called from the main thread (see setSetting()).
+ *
  * \param pSetting Name of the setting.
  * \param pValue Destination for the setting's value.
  * \param pDefault Default value to use for the setting.
@@ -185,8 +467,15 @@ bool DatabaseCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
 bool DatabaseCache::getSetting(const QString& pSetting, int& pValue, const int pDefault, const bool pCreate)
 {
     //Search for setting in cache; if not found then return specified default value
-    if (settingsInt.find(pSetting) == settingsInt.end())
+    std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
+    auto it = settingsInt.find(pSetting);
+
+    if (it == settingsInt.end())
     {
+        //Must not hold the lock when creating the setting below
+        tLock.unlock();
+
         //Use default value
         pValue = pDefault;
 
@@ -202,7 +491,7 @@ bool DatabaseCache::getSetting(const QString& pSetting, int& pValue, const int p
     else
     {
         //Use cached setting
-        pValue = settingsInt.at(pSetting);
+        pValue = it->second;
 
         return true;
     }
@@ -218,8 +507,15 @@ bool DatabaseCache::getSetting(const QString& pSetting, int& pValue, const int p
 bool DatabaseCache::getSetting(const QString& pSetting, double& pValue, const double pDefault, const bool pCreate)
 {
     //Search for setting in cache; if not found then return specified default value
-    if (settingsDbl.find(pSetting) == settingsDbl.end())
+    std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
+    auto it = settingsDbl.find(pSetting);
+
+    if (it == settingsDbl.end())
     {
+        //Must not hold the lock when creating the setting below
+        tLock.unlock();
+
         //Use default value
         pValue = pDefault;
 
@@ -235,7 +531,7 @@ bool DatabaseCache::getSetting(const QString& pSetting, double& pValue, const do
     else
     {
         //Use cached setting
-        pValue = settingsDbl.at(pSetting);
+        pValue = it->second;
 
         return true;
     }
@@ -251,8 +547,15 @@ bool DatabaseCache::getSetting(const QString& pSetting, double& pValue, const do
 bool DatabaseCache::getSetting(const QString& pSetting, QString& pValue, const QString pDefault, const bool pCreate)
 {
     //Search for setting in cache; if not found then return specified default value
-    if (settingsStr.find(pSetting) == settingsStr.end())
+    std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
+    auto it = settingsStr.find(pSetting);
+
+    if (it == settingsStr.end())
     {
+        //Must not hold the lock when creating the setting below
+        tLock.unlock();
+
         //Use default value
         pValue = pDefault;
 
@@ -268,7 +571,7 @@ bool DatabaseCache::getSetting(const QString& pSetting, QString& pValue, const Q
     else
     {
         //Use cached setting
-        pValue = settingsStr.at(pSetting);
+        pValue = it->second;
 
         return true;
     }
@@ -284,6 +587,10 @@ bool DatabaseCache::getSetting(const QString& pSetting, QString& pValue, const Q
  *
  * Returns immediately, if database is read-only.
  *
+ * If write-behind is enabled (see setSettingsWriteBehind()), only the cache is updated and the database
+ * write is deferred until flushSettings() is called (which happens automatically after some idle time).
+ * The function then always returns true (unless the database is read-only).
+ *
  * \param pSetting Name of the setting.
  * \param pValue New value for the setting.
  * \return If writing to database was successful.
@@ -293,6 +600,21 @@ bool DatabaseCache::setSetting(const QString& pSetting, const int pValue)
     if (isConfigReadOnly())
         return false;
 
+    //Only update cache and write to database later, if write-behind enabled
+    if (settingsWriteBehindEnabled)
+    {
+        deferSetting(pSetting, 0, pValue, settingsInt.find(pSetting) == settingsInt.end());
+
+        {
+            const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+            settingsInt[pSetting] = pValue;
+        }
+
+        ++settingsGenerationCounter;
+
+        return true;
+    }
+
     QSqlDatabase configDb = QSqlDatabase::database("configDb");
     QSqlQuery query(configDb);
 
@@ -323,7 +645,12 @@ bool DatabaseCache::setSetting(const QString& pSetting, const int pValue)
     }
     else
     {
-        settingsInt[pSetting] = pValue;
+        {
+            const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+            settingsInt[pSetting] = pValue;
+        }
+
+        ++settingsGenerationCounter;
         return true;
     }
 
@@ -340,6 +667,21 @@ bool DatabaseCache::setSetting(const QString& pSetting, const double pValue)
     if (isConfigReadOnly())
         return false;
 
+    //Only update cache and write to database later, if write-behind enabled
+    if (settingsWriteBehindEnabled)
+    {
+        deferSetting(pSetting, 1, pValue, settingsDbl.find(pSetting) == settingsDbl.end());
+
+        {
+            const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+            settingsDbl[pSetting] = pValue;
+        }
+
+        ++settingsGenerationCounter;
+
+        return true;
+    }
+
     QSqlDatabase configDb = QSqlDatabase::database("configDb");
     QSqlQuery query(configDb);
 
@@ -370,7 +712,12 @@ bool DatabaseCache::setSetting(const QString& pSetting, const double pValue)
     }
     else
     {
-        settingsDbl[pSetting] = pValue;
+        {
+            const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+            settingsDbl[pSetting] = pValue;
+        }
+
+        ++settingsGenerationCounter;
         return true;
     }
 
@@ -387,6 +734,21 @@ bool DatabaseCache::setSetting(const QString& pSetting, const QString& pValue)
     if (isConfigReadOnly())
         return false;
 
+    //Only update cache and write to database later, if write-behind enabled
+    if (settingsWriteBehindEnabled)
+    {
+        deferSetting(pSetting, 2, pValue, settingsStr.find(pSetting) == settingsStr.end());
+
+        {
+            const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+            settingsStr[pSetting] = pValue;
+        }
+
+        ++settingsGenerationCounter;
+
+        return true;
+    }
+
     QSqlDatabase configDb = QSqlDatabase::database("configDb");
     QSqlQuery query(configDb);
 
@@ -417,164 +779,357 @@ bool DatabaseCache::setSetting(const QString& pSetting, const QString& pValue)
     }
     else
     {
-        settingsStr[pSetting] = pValue;
+        {
+            const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+            settingsStr[pSetting] = pValue;
+        }
+
+        ++settingsGenerationCounter;
         return true;
     }
 
     return false;
 }
 
-//
-
 /*!
- * \brief Get the cached available stations.
+ * \brief Get a counter that is incremented whenever any cached setting changes.
  *
- * \return Map of available stations (see Aux::Station) with (unique) integer IDs as keys.
- */
-std::map<int, Aux::Station> DatabaseCache::stations()
-{
-    return stationsMap;
-}
-
-/*!
- * \brief Get the cached available boats.
+ * The counter is incremented by every successful setSetting() call and every time settings are (re-)loaded
+ * from the configuration database. Hence a setting value derived from the cache stays valid
+ * as long as this counter does not change (see e.g. SettingsCache).
  *
- * \return Map of available boats (see Aux::Boat) with (unique) integer IDs as keys.
+ * \return Current settings generation.
  */
-std::map<int, Aux::Boat> DatabaseCache::boats()
+uint64_t DatabaseCache::settingsGeneration()
 {
-    return boatsMap;
+    return settingsGenerationCounter.load();
 }
 
 //
 
 /*!
- * \brief Replace the stations in cache and database.
+ * \brief Enable or disable deferred writing of settings to the database.
  *
- * Updates database records for all stations with unchanged name and location (^= identifier), removes and re-adds
- * records for stations with changed name or location, removes removed stations and adds new stations.
- * Finally, if writing to database was successful, clears the stations cache and re-loads
- * the stations into cache to update their IDs (which are simply database row IDs).
+ * If enabled, setSetting() only updates the settings cache and remembers the setting, while the actual database
+ * write is deferred. Repeated writes of the same setting are coalesced and all deferred settings are finally written
+ * within a single database transaction by flushSettings(), which is called automatically once no further setting
+ * has been written for a short time.
+ * This avoids a separate database transaction (and hence disk synchronization) for each single setting.
  *
- * Returns immediately, if database is read-only.
+ * Since setSetting() then succeeds even if the deferred write fails later on, write-behind should only be enabled
+ * temporarily for a batch of settings, which is then explicitly written by flushSettings() (or by disabling write-behind
+ * again) such that write errors can be reported (see e.g. SettingsDialog::writeDatabase()).
  *
- * Note: Checks for wrongly formatted strings in station properties and for duplicate stations
- * (see checkStationFormat(), checkStationDuplicates()) and simply returns if there is a problem.
+ * Enabling requires an application instance (for the flush timer). Disabling immediately writes all deferred settings.
  *
- * \param pStations New/changed list of stations.
- * \return If writing to database and re-loading stations was successful.
+ * Note: Like setSetting(), this must be called from the main thread.
+ *
+ * \param pEnable Enable write-behind?
+ * \return If write-behind could be enabled (if enabling) or if deferred settings were written successfully (if disabling).
  */
-bool DatabaseCache::updateStations(const std::vector<Aux::Station>& pStations)
+bool DatabaseCache::setSettingsWriteBehind(const bool pEnable)
 {
-    if (isConfigReadOnly())
-        return false;
-
-    //Check stations' formatting first
-    for (const Aux::Station& newStation : pStations)
+    if (!pEnable)
     {
-        if (!checkStationFormat(newStation))
-        {
-            std::cerr<<"ERROR: Wrongly formatted station!"<<std::endl;
-            return false;
-        }
+        settingsWriteBehindEnabled = false;
+        return flushSettings();
     }
-    for (const Aux::Station& newStation : pStations)
+
+    if (QCoreApplication::instance() == nullptr)
     {
-        if (!checkStationDuplicates(newStation, pStations, true))
-        {
-            std::cerr<<"ERROR: Duplicate station!"<<std::endl;
-            return false;
-        }
+        std::cerr<<"ERROR: Cannot defer writing of settings without application instance!"<<std::endl;
+        return false;
     }
 
-    QSqlDatabase configDb = QSqlDatabase::database("configDb");
-    QSqlQuery configQuery(configDb);
-
-    //Removed stations
-    for (const auto& it : stationsMap)  //(sic!)
+    if (settingsFlushTimer == nullptr)
     {
-        const Aux::Station& currentStation = it.second;
-
-        //Keep station if in both old and new list of stations
-        bool tContinue = false;
-        for (const Aux::Station& newStation : pStations)
-        {
-            if (newStation.location == currentStation.location && newStation.name == currentStation.name)
-            {
-                tContinue = true;
-                break;
-            }
-        }
-        if (tContinue)
-            continue;
+        settingsFlushTimer = new QTimer(QCoreApplication::instance());
+        settingsFlushTimer->setSingleShot(true);
+        settingsFlushTimer->setInterval(settingsFlushDelay);
 
-        //Remove it otherwise
-        configQuery.prepare("DELETE FROM Stations WHERE Location=:location AND Name=:name;");
-        configQuery.bindValue(":location", currentStation.location);
-        configQuery.bindValue(":name", currentStation.name);
-
-        if (!configQuery.exec())
-        {
-            std::cerr<<"ERROR: Could not remove station from configuration database!"<<std::endl;
-            return false;
-        }
+        QObject::connect(settingsFlushTimer, &QTimer::timeout, []() -> void { flushSettings(); });
     }
 
-    //New stations
-    for (const Aux::Station& newStation : pStations)    //(sic!)
-    {
-        //Skip station if in both old and new list of stations
-        int tmpRowId = 0;
-        if (stationRowIdFromNameLocation(newStation.name, newStation.location, tmpRowId))
-            continue;
+    settingsWriteBehindEnabled = true;
 
-        configQuery.prepare("INSERT INTO Stations (Location, Name, LocalGroup, DistrictAssociation, "
-                                                  "RadioCallName, RadioCallNameAlt) "
-                            "VALUES (:location, :name, :group, :district, :radiocall, :radiocallAlt);");
-        configQuery.bindValue(":location", newStation.location);
-        configQuery.bindValue(":name", newStation.name);
-        configQuery.bindValue(":group", newStation.localGroup);
-        configQuery.bindValue(":district", newStation.districtAssociation);
-        configQuery.bindValue(":radiocall", newStation.radioCallName);
-        configQuery.bindValue(":radiocallAlt", newStation.radioCallNameAlt);
-
-        if (!configQuery.exec())
-        {
-            std::cerr<<"ERROR: Could not add station to configuration database!"<<std::endl;
-            return false;
-        }
-    }
+    return true;
+}
+
+/*!
+ * \brief Check, if settings are written to the database deferred.
+ *
+ * See setSettingsWriteBehind().
+ *
+ * \return If write-behind is enabled.
+ */
+bool DatabaseCache::settingsWriteBehind()
+{
+    return settingsWriteBehindEnabled;
+}
+
+/*!
+ * \brief Write all deferred settings to the database in a single transaction.
+ *
+ * Writes all settings that were deferred by setSetting() because of enabled write-behind (see setSettingsWriteBehind()).
+ * All settings are written within a single database transaction, which is rolled back if any write fails.
+ * In that case the settings cache is re-loaded from the database such that it does not contain the unwritten values.
+ *
+ * \return If writing to database was successful (or nothing to write).
+ */
+bool DatabaseCache::flushSettings()
+{
+    if (settingsFlushTimer != nullptr)
+        settingsFlushTimer->stop();
+
+    if (pendingSettings.empty())
+        return true;
+
+    std::map<QString, PendingSetting> tPendingSettings;
+    tPendingSettings.swap(pendingSettings);
+
+    //Discard cached values that could not be written and re-load settings from database
+    auto tRevertCache = []() -> void
+    {
+        loadIntSettings("configDb", true);
+        loadDblSettings("configDb", true);
+        loadStrSettings("configDb", true);
+    };
+
+    if (isConfigReadOnly())
+    {
+        std::cerr<<"ERROR: Could not write deferred settings to read-only configuration database!"<<std::endl;
+        tRevertCache();
+        return false;
+    }
+
+    QSqlDatabase configDb = QSqlDatabase::database("configDb");
+
+    //Prepare each statement only once and write all changes in a single transaction
+
+    if (!configDb.transaction())
+    {
+        std::cerr<<"ERROR: Could not start configuration database transaction!"<<std::endl;
+        tRevertCache();
+        return false;
+    }
+
+    QSqlQuery insertQuery(configDb);
+    QSqlQuery updateIntQuery(configDb);
+    QSqlQuery updateDblQuery(configDb);
+    QSqlQuery updateStrQuery(configDb);
+
+    if (!insertQuery.prepare("INSERT INTO Application (Setting, Type, ValueInt, ValueDbl, ValueStr) "
+                             "VALUES (:setting, :type, :valInt, :valDbl, :valStr);") ||
+        !updateIntQuery.prepare("UPDATE Application SET ValueInt=:value WHERE Setting=:setting;") ||
+        !updateDblQuery.prepare("UPDATE Application SET ValueDbl=:value WHERE Setting=:setting;") ||
+        !updateStrQuery.prepare("UPDATE Application SET ValueStr=:value WHERE Setting=:setting;"))
+    {
+        std::cerr<<"ERROR: Could not prepare configuration database queries!"<<std::endl;
+        configDb.rollback();
+        tRevertCache();
+        return false;
+    }
+
+    for (const auto& it : tPendingSettings)
+    {
+        const PendingSetting& tPending = it.second;
+
+        QSqlQuery* tQuery = &insertQuery;
+
+        if (tPending.insert)
+        {
+            insertQuery.bindValue(":setting", it.first);
+            insertQuery.bindValue(":type", tPending.type);
+            insertQuery.bindValue(":valInt", tPending.type == 0 ? tPending.value : QVariant(0));
+            insertQuery.bindValue(":valDbl", tPending.type == 1 ? tPending.value : QVariant(0));
+            insertQuery.bindValue(":valStr", tPending.type == 2 ? tPending.value : QVariant(""));
+        }
+        else
+        {
+            if (tPending.type == 0)
+                tQuery = &updateIntQuery;
+            else if (tPending.type == 1)
+                tQuery = &updateDblQuery;
+            else
+                tQuery = &updateStrQuery;
+
+            tQuery->bindValue(":setting", it.first);
+            tQuery->bindValue(":value", tPending.value);
+        }
+
+        if (!tQuery->exec())
+        {
+            std::cerr<<"ERROR: Could not write setting \"" + it.first.toStdString() + "\" to configuration database!"<<std::endl;
+            configDb.rollback();
+            tRevertCache();
+            return false;
+        }
+    }
+
+    if (!configDb.commit())
+    {
+        std::cerr<<"ERROR: Could not commit configuration database transaction!"<<std::endl;
+        configDb.rollback();
+        tRevertCache();
+        return false;
+    }
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Get the cached available stations.
+ *
+ * \return Map of available stations (see Aux::Station) with (unique) integer IDs as keys.
+ */
+std::map<int, Aux::Station> DatabaseCache::stations()
+{
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
+    return stationsMap;
+}
+
+/*!
+ * \brief Get the cached available boats.
+ *
+ * \return Map of available boats (see Aux::Boat) with (unique) integer IDs as keys.
+ */
+std::map<int, Aux::Boat> DatabaseCache::boats()
+{
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
+    return boatsMap;
+}
+
+//
+
+/*!
+ * \brief Replace the stations in cache and database.
+ *
+ * Updates database records for all stations with unchanged name and location (^= identifier), removes and re-adds
+ * records for stations with changed name or location, removes removed stations and adds new stations.
+ * All changes are written within a single database transaction, which is rolled back if any write fails.
+ * The stations cache is re-loaded at the beginning of this (immediate) transaction, such that the changes
+ * are determined against the current database content. Finally, if writing to database was successful,
+ * clears the stations cache and re-loads the stations into cache to update their IDs (which are simply database row IDs).
+ *
+ * Returns immediately, if database is read-only.
+ *
+ * Note: Checks for wrongly formatted strings in station properties and for duplicate stations
+ * (see checkStationFormat(), checkStationDuplicates()) and simply returns if there is a problem.
+ *
+ * \param pStations New/changed list of stations.
+ * \return If writing to database and re-loading stations was successful.
+ */
+bool DatabaseCache::updateStations(const std::vector<Aux::Station>& pStations)
+{
+    if (isConfigReadOnly())
+        return false;
+
+    //Check stations' formatting first
+    for (const Aux::Station& newStation : pStations)
+    {
+        if (!checkStationFormat(newStation))
+        {
+            std::cerr<<"ERROR: Wrongly formatted station!"<<std::endl;
+            return false;
+        }
+    }
+    for (const Aux::Station& newStation : pStations)
+    {
+        if (!checkStationDuplicates(newStation, pStations, true))
+        {
+            std::cerr<<"ERROR: Duplicate station!"<<std::endl;
+            return false;
+        }
+    }
+
+    QSqlDatabase configDb = QSqlDatabase::database("configDb");
+
+    //Prepare each statement only once and write all changes in a single transaction
+
+    if (!beginImmediateTransaction("configDb"))
+        return false;
+
+    //Compare with the current database content instead of a possibly outdated cache (see setConcurrentAccess())
+    if (!loadStations("configDb", true))
+    {
+        std::cerr<<"ERROR: Could not read stations from configuration database!"<<std::endl;
+        rollbackTransaction("configDb");
+        return false;
+    }
+
+    QSqlQuery removeQuery(configDb);
+    QSqlQuery insertQuery(configDb);
+    QSqlQuery updateQuery(configDb);
+
+    if (!removeQuery.prepare("DELETE FROM Stations WHERE Location=:location AND Name=:name;") ||
+        !insertQuery.prepare("INSERT INTO Stations (Location, Name, LocalGroup, DistrictAssociation, "
+                                                   "RadioCallName, RadioCallNameAlt) "
+                             "VALUES (:location, :name, :group, :district, :radiocall, :radiocallAlt);") ||
+        !updateQuery.prepare("UPDATE Stations SET LocalGroup=:group, DistrictAssociation=:district, "
+                                                 "RadioCallName=:radiocall, RadioCallNameAlt=:radiocallAlt "
+                             "WHERE Location=:location AND Name=:name;"))
+    {
+        std::cerr<<"ERROR: Could not prepare configuration database queries!"<<std::endl;
+        rollbackTransaction("configDb");
+        return false;
+    }
+
+    std::set<std::pair<QString, QString>> tNewStationLocationNames;
+    for (const Aux::Station& newStation : pStations)
+        tNewStationLocationNames.insert({newStation.location, newStation.name});
+
+    //Removed stations
+    for (const auto& it : stationsMap)  //(sic!)
+    {
+        const Aux::Station& currentStation = it.second;
+
+        //Keep station if in both old and new list of stations
+        if (tNewStationLocationNames.find({currentStation.location, currentStation.name}) != tNewStationLocationNames.end())
+            continue;
+
+        //Remove it otherwise
+        removeQuery.bindValue(":location", currentStation.location);
+        removeQuery.bindValue(":name", currentStation.name);
+
+        if (!removeQuery.exec())
+        {
+            std::cerr<<"ERROR: Could not remove station from configuration database!"<<std::endl;
+            rollbackTransaction("configDb");
+            return false;
+        }
+    }
 
-    //Edited stations (do not check, simply update all not removed and not added stations)
     for (const Aux::Station& newStation : pStations)    //(sic!)
     {
-        //Skip station if not in both old and new list of stations
+        //Add new stations and update all stations in both old and new list of stations (edited stations are not checked)
         int tmpRowId = 0;
-        if (!stationRowIdFromNameLocation(newStation.name, newStation.location, tmpRowId))
-            continue;
+        QSqlQuery& tQuery = stationRowIdFromNameLocation(newStation.name, newStation.location, tmpRowId) ? updateQuery : insertQuery;
 
-        configQuery.prepare("UPDATE Stations SET LocalGroup=:group, DistrictAssociation=:district, "
-                                                "RadioCallName=:radiocall, RadioCallNameAlt=:radiocallAlt "
-                            "WHERE Location=:location AND Name=:name;");
-        configQuery.bindValue(":location", newStation.location);
-        configQuery.bindValue(":name", newStation.name);
-        configQuery.bindValue(":group", newStation.localGroup);
-        configQuery.bindValue(":district", newStation.districtAssociation);
-        configQuery.bindValue(":radiocall", newStation.radioCallName);
-        configQuery.bindValue(":radiocallAlt", newStation.radioCallNameAlt);
-
-        if (!configQuery.exec())
+        tQuery.bindValue(":location", newStation.location);
+        tQuery.bindValue(":name", newStation.name);
+        tQuery.bindValue(":group", newStation.localGroup);
+        tQuery.bindValue(":district", newStation.districtAssociation);
+        tQuery.bindValue(":radiocall", newStation.radioCallName);
+        tQuery.bindValue(":radiocallAlt", newStation.radioCallNameAlt);
+
+        if (!tQuery.exec())
         {
-            std::cerr<<"ERROR: Could not update station in configuration database!"<<std::endl;
+            std::cerr<<"ERROR: Could not add or update station in configuration database!"<<std::endl;
+            rollbackTransaction("configDb");
             return false;
         }
     }
 
-    //Reload stations to obtain new/changed row IDs
+    if (!commitTransaction("configDb"))
+        return false;
 
-    stationsMap.clear();
+    //Reload stations to obtain new/changed row IDs
 
-    return loadStations();
+    return loadStations("configDb", true);
 }
 
 /*!
@@ -582,8 +1137,10 @@ bool DatabaseCache::updateStations(const std::vector<Aux::Station>& pStations)
  *
  * Updates database records for all boats with unchanged name (^= identifier), removes and re-adds
  * records for boats with changed name, removes removed boats and adds new boats.
- * Finally, if writing to database was successful, clears the boats cache and re-loads
- * the boats into cache to update their IDs (which are simply database row IDs).
+ * All changes are written within a single database transaction, which is rolled back if any write fails.
+ * The boats cache is re-loaded at the beginning of this (immediate) transaction, such that the changes
+ * are determined against the current database content. Finally, if writing to database was successful,
+ * clears the boats cache and re-loads the boats into cache to update their IDs (which are simply database row IDs).
  *
  * Returns immediately, if database is read-only.
  *
@@ -628,7 +1185,40 @@ bool DatabaseCache::updateBoats(const std::vector<Aux::Boat>& pBoats)
     }
 
     QSqlDatabase configDb = QSqlDatabase::database("configDb");
-    QSqlQuery configQuery(configDb);
+
+    //Prepare each statement only once and write all changes in a single transaction
+
+    if (!beginImmediateTransaction("configDb"))
+        return false;
+
+    //Compare with the current database content instead of a possibly outdated cache (see setConcurrentAccess())
+    if (!loadBoats("configDb", true))
+    {
+        std::cerr<<"ERROR: Could not read boats from configuration database!"<<std::endl;
+        rollbackTransaction("configDb");
+        return false;
+    }
+
+    QSqlQuery removeQuery(configDb);
+    QSqlQuery insertQuery(configDb);
+    QSqlQuery updateQuery(configDb);
+
+    if (!removeQuery.prepare("DELETE FROM Boats WHERE Name=:name;") ||
+        !insertQuery.prepare("INSERT INTO Boats (Name, Acronym, Type, FuelType, RadioCallName, RadioCallNameAlt, "
+                                                "HomeStation) "
+                             "VALUES (:name, :acronym, :type, :fuel, :radiocall, :radiocallAlt, :homeStation);") ||
+        !updateQuery.prepare("UPDATE Boats SET Acronym=:acronym, Type=:type, FuelType=:fuel, RadioCallName=:radiocall, "
+                                              "RadioCallNameAlt=:radiocallAlt, HomeStation=:homeStation "
+                             "WHERE Name=:name;"))
+    {
+        std::cerr<<"ERROR: Could not prepare configuration database queries!"<<std::endl;
+        rollbackTransaction("configDb");
+        return false;
+    }
+
+    std::set<QString> tNewBoatNames;
+    for (const Aux::Boat& newBoat : pBoats)
+        tNewBoatNames.insert(newBoat.name);
 
     //Removed boats
     for (const auto& it : boatsMap) //(sic!)
@@ -636,86 +1226,48 @@ bool DatabaseCache::updateBoats(const std::vector<Aux::Boat>& pBoats)
         const Aux::Boat& currentBoat = it.second;
 
         //Keep boat if in both old and new list of boats
-        bool tContinue = false;
-        for (const Aux::Boat& newBoat : pBoats)
-        {
-            if (newBoat.name == currentBoat.name)
-            {
-                tContinue = true;
-                break;
-            }
-        }
-        if (tContinue)
+        if (tNewBoatNames.find(currentBoat.name) != tNewBoatNames.end())
             continue;
 
         //Remove it otherwise
-        configQuery.prepare("DELETE FROM Boats WHERE Name=:name;");
-        configQuery.bindValue(":name", currentBoat.name);
+        removeQuery.bindValue(":name", currentBoat.name);
 
-        if (!configQuery.exec())
+        if (!removeQuery.exec())
         {
             std::cerr<<"ERROR: Could not remove boat from configuration database!"<<std::endl;
+            rollbackTransaction("configDb");
             return false;
         }
     }
 
-    //New boats
     for (const Aux::Boat& newBoat : pBoats) //(sic!)
     {
-        //Skip boat if in both old and new list of boats
+        //Add new boats and update all boats in both old and new list of boats (edited boats are not checked)
         int tmpRowId = 0;
-        if (boatRowIdFromName(newBoat.name, tmpRowId))
-            continue;
-
-        configQuery.prepare("INSERT INTO Boats (Name, Acronym, Type, FuelType, RadioCallName, RadioCallNameAlt, "
-                                               "HomeStation) "
-                            "VALUES (:name, :acronym, :type, :fuel, :radiocall, :radiocallAlt, :homeStation);");
-        configQuery.bindValue(":name", newBoat.name);
-        configQuery.bindValue(":acronym", newBoat.acronym);
-        configQuery.bindValue(":type", newBoat.type);
-        configQuery.bindValue(":fuel", newBoat.fuelType);
-        configQuery.bindValue(":radiocall", newBoat.radioCallName);
-        configQuery.bindValue(":radiocallAlt", newBoat.radioCallNameAlt);
-        configQuery.bindValue(":homeStation", newBoat.homeStation);
-
-        if (!configQuery.exec())
-        {
-            std::cerr<<"ERROR: Could not add boat to configuration database!"<<std::endl;
-            return false;
-        }
-    }
+        QSqlQuery& tQuery = boatRowIdFromName(newBoat.name, tmpRowId) ? updateQuery : insertQuery;
 
-    //Edited boats (do not check, simply update all not removed and not added boats)
-    for (const Aux::Boat& newBoat : pBoats) //(sic!)
-    {
-        //Skip boat if not in both old and new list of boats
-        int tmpRowId = 0;
-        if (!boatRowIdFromName(newBoat.name, tmpRowId))
-            continue;
+        tQuery.bindValue(":name", newBoat.name);
+        tQuery.bindValue(":acronym", newBoat.acronym);
+        tQuery.bindValue(":type", newBoat.type);
+        tQuery.bindValue(":fuel", newBoat.fuelType);
+        tQuery.bindValue(":radiocall", newBoat.radioCallName);
+        tQuery.bindValue(":radiocallAlt", newBoat.radioCallNameAlt);
+        tQuery.bindValue(":homeStation", newBoat.homeStation);
 
-        configQuery.prepare("UPDATE Boats SET Acronym=:acronym, Type=:type, FuelType=:fuel, RadioCallName=:radiocall, "
-                                             "RadioCallNameAlt=:radiocallAlt, HomeStation=:homeStation "
-                            "WHERE Name=:name;");
-        configQuery.bindValue(":name", newBoat.name);
-        configQuery.bindValue(":acronym", newBoat.acronym);
-        configQuery.bindValue(":type", newBoat.type);
-        configQuery.bindValue(":fuel", newBoat.fuelType);
-        configQuery.bindValue(":radiocall", newBoat.radioCallName);
-        configQuery.bindValue(":radiocallAlt", newBoat.radioCallNameAlt);
-        configQuery.bindValue(":homeStation", newBoat.homeStation);
-
-        if (!configQuery.exec())
+        if (!tQuery.exec())
         {
-            std::cerr<<"ERROR: Could not update boat in configuration database!"<<std::endl;
+            std::cerr<<"ERROR: Could not add or update boat in configuration database!"<<std::endl;
+            rollbackTransaction("configDb");
             return false;
         }
     }
 
-    //Reload boats to obtain new/changed row IDs
+    if (!commitTransaction("configDb"))
+        return false;
 
-    boatsMap.clear();
+    //Reload boats to obtain new/changed row IDs
 
-    return loadBoats();
+    return loadBoats("configDb", true);
 }
 
 //
@@ -733,6 +1285,8 @@ bool DatabaseCache::updateBoats(const std::vector<Aux::Boat>& pBoats)
  */
 bool DatabaseCache::stationRowIdFromNameLocation(const QString& pName, const QString& pLocation, int& pRowId)
 {
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
     for (const auto& it : stationsMap)
     {
         if (it.second.name == pName && it.second.location == pLocation)
@@ -758,6 +1312,8 @@ bool DatabaseCache::stationRowIdFromNameLocation(const QString& pName, const QSt
  */
 bool DatabaseCache::stationNameLocationFromRowId(const int pRowId, QString& pName, QString& pLocation)
 {
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
     if (stationsMap.find(pRowId) != stationsMap.end())
     {
         pName = stationsMap.at(pRowId).name;
@@ -780,6 +1336,8 @@ bool DatabaseCache::stationNameLocationFromRowId(const int pRowId, QString& pNam
  */
 bool DatabaseCache::boatRowIdFromName(const QString& pName, int& pRowId)
 {
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
     for (const auto& it : boatsMap)
     {
         if (it.second.name == pName)
@@ -804,6 +1362,8 @@ bool DatabaseCache::boatRowIdFromName(const QString& pName, int& pRowId)
  */
 bool DatabaseCache::boatNameFromRowId(const int pRowId, QString& pName)
 {
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
     if (boatsMap.find(pRowId) != boatsMap.end())
     {
         pName = boatsMap.at(pRowId).name;
@@ -827,13 +1387,9 @@ bool DatabaseCache::boatNameFromRowId(const int pRowId, QString& pName)
  */
 bool DatabaseCache::memberNumExists(const QString& pMembershipNumber)
 {
-    for (const auto& it : personnelMap)
-    {
-        if (Person::extractMembershipNumber(it.second.getIdent()) == pMembershipNumber)
-            return true;
-    }
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
 
-    return false;
+    return personnelMmbNrIndex.find(pMembershipNumber) != personnelMmbNrIndex.end();
 }
 
 /*!
@@ -848,13 +1404,9 @@ bool DatabaseCache::memberNumExists(const QString& pMembershipNumber)
  */
 bool DatabaseCache::personExists(const QString& pIdent)
 {
-    for (const auto& it : personnelMap)
-    {
-        if (it.second.getIdent() == pIdent)
-            return true;
-    }
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
 
-    return false;
+    return findPerson(pIdent) != nullptr;
 }
 
 /*!
@@ -868,16 +1420,16 @@ bool DatabaseCache::personExists(const QString& pIdent)
  */
 bool DatabaseCache::getPerson(Person& pPerson, const QString& pIdent)
 {
-    for (const auto& it : personnelMap)
-    {
-        if (it.second.getIdent() == pIdent)
-        {
-            pPerson = it.second;
-            return true;
-        }
-    }
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
 
-    return false;
+    const Person* tPerson = findPerson(pIdent);
+
+    if (tPerson == nullptr)
+        return false;
+
+    pPerson = *tPerson;
+
+    return true;
 }
 
 /*!
@@ -916,10 +1468,19 @@ void DatabaseCache::getPersons(std::vector<Person>& pPersons, const QString& pLa
 {
     pPersons.clear();
 
-    for (const auto& it : personnelMap)
+    const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
+    auto nameIt = personnelNameIndex.find({pLastName, pFirstName});
+
+    if (nameIt == personnelNameIndex.end())
+        return;
+
+    for (int tRowId : nameIt->second)
     {
-        if (it.second.getLastName() == pLastName && it.second.getFirstName() == pFirstName && (!pActiveOnly || it.second.getActive()))
-            pPersons.push_back(it.second);
+        const Person& tPerson = personnelMap.at(tRowId);
+
+        if (!pActiveOnly || tPerson.getActive())
+            pPersons.push_back(tPerson);
     }
 }
 
@@ -928,15 +1489,40 @@ void DatabaseCache::getPersons(std::vector<Person>& pPersons, const QString& pLa
  *
  * Assigns a list of all persons in personnel cache to \p pPersons.
  *
+ * Note: This copies all persons. Use personnel() to iterate the personnel without copying.
+ *
  * \param pPersons Destination for list of persons.
  */
 void DatabaseCache::getPersonnel(std::vector<Person>& pPersons)
 {
-    pPersons.clear();
-    pPersons.reserve(personnelMap.size());
+    pPersons = *personnel();
+}
+
+/*!
+ * \brief Get a shared, immutable snapshot of all persons from personnel cache.
+ *
+ * Returns the list of all persons in personnel cache (ordered by database row ID) without copying it.
+ * The snapshot is never modified. Any change to the personnel cache instead causes the snapshot to be replaced by a new one,
+ * which will be returned by subsequent calls, while previously obtained snapshots remain valid and unchanged.
+ * Obtaining and reading a snapshot is therefore also safe from other threads.
+ *
+ * The new snapshot is only created by the first call after the change(s), such that a series of single person changes
+ * (see addPerson(), updatePerson(), removePerson()) copies the personnel cache only once instead of after each change.
+ *
+ * \return Pointer to the current personnel snapshot.
+ */
+std::shared_ptr<const std::vector<Person>> DatabaseCache::personnel()
+{
+    if (personnelSnapshotOutdated.load())
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        //Snapshot may have been replaced by another thread meanwhile
+        if (personnelSnapshotOutdated.load())
+            publishPersonnelSnapshot();
+    }
 
-    for (auto it : personnelMap)
-        pPersons.push_back(std::move(it.second));
+    return std::atomic_load(&personnelSnapshotPtr);
 }
 
 //
@@ -944,14 +1530,16 @@ void DatabaseCache::getPersonnel(std::vector<Person>& pPersons)
 /*!
  * \brief Add new person to personnel cache and database.
  *
- * Adds new person record for \p pPerson to personnel database and, if successful, clears and re-loads the personnel cache.
- * The person is not added, if a person with the same membership number already exists in personnel cache (i.e. in database)
+ * Adds new person record for \p pPerson to personnel database and, if successful, also adds the person to the personnel cache
+ * (using the row ID of the new record). The personnel cache is only cleared and re-loaded, if that row ID cannot be determined.
+ * The person is not added, if a person with the same membership number already exists in personnel cache or in database
  * or if the person's name or membership number are wrongly formatted (see checkPersonnelDuplicates(), checkPersonFormat()).
+ * The database is checked and written within a single immediate transaction (see checkMembershipNumberNotInDatabase()).
  *
  * Returns immediately, if database is read-only.
  *
  * \param pNewPerson New person.
- * \return If writing to database and re-loading personnel cache was successful.
+ * \return If writing to database and updating personnel cache was successful.
  */
 bool DatabaseCache::addPerson(const Person& pNewPerson)
 {
@@ -971,6 +1559,17 @@ bool DatabaseCache::addPerson(const Person& pNewPerson)
     }
 
     QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
+
+    //Check the database itself again, since the cache may miss records just added by another instance (see setConcurrentAccess())
+    if (!beginImmediateTransaction("personnelDb"))
+        return false;
+
+    if (!checkMembershipNumberNotInDatabase(Person::extractMembershipNumber(pNewPerson.getIdent())))
+    {
+        rollbackTransaction("personnelDb");
+        return false;
+    }
+
     QSqlQuery personnelQuery(personnelDb);
 
     personnelQuery.prepare("INSERT INTO Personnel (LastName, FirstName, MembershipNumber, Qualifications, Status) "
@@ -984,29 +1583,55 @@ bool DatabaseCache::addPerson(const Person& pNewPerson)
     if (!personnelQuery.exec())
     {
         std::cerr<<"ERROR: Could not add person to personnel database!"<<std::endl;
+        rollbackTransaction("personnelDb");
         return false;
     }
 
-    //Reload personnel to obtain new/changed row IDs
+    //Add person to cache using the row ID of the inserted record; fall back to reloading the whole personnel otherwise
 
-    personnelMap.clear();
+    bool tRowIdValid = false;
+    int tRowId = personnelQuery.lastInsertId().toInt(&tRowIdValid);
+
+    if (!commitTransaction("personnelDb"))
+        return false;
+
+    if (!tRowIdValid || personnelMap.find(tRowId) != personnelMap.end())
+    {
+        std::cerr<<"WARNING: Could not determine row ID of added person! Reloading personnel."<<std::endl;
+
+        return reloadPersonnel();
+    }
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        auto insertIt = personnelMap.insert({tRowId, personFromRecord(pNewPerson.getLastName(), pNewPerson.getFirstName(),
+                                                                      Person::extractMembershipNumber(pNewPerson.getIdent()),
+                                                                      pNewPerson.getQualifications(),
+                                                                      pNewPerson.getActive() ? 0 : 1)});
+        indexPerson(tRowId, insertIt.first->second);
 
-    return loadPersonnel();
+        invalidatePersonnelSnapshot();
+    }
+
+    return verifyPersonnelIfEnabled();
 }
 
 /*!
  * \brief Update person in personnel cache and database.
  *
  * Updates the database record for the person with identifier \p pIdent with \p pNewPerson and, if successful,
- * clears and re-loads the personnel cache. The person is not updated, if the membership number has changed
+ * also replaces the cached person. The person is not updated, if the membership number has changed
  * but a different person with the same membership number already exists. The person is also not changed,
  * if the person's name or membership number are wrongly formatted. See also checkPersonnelDuplicates() and checkPersonFormat().
+ * If the person was removed from the database by another program instance meanwhile (see setConcurrentAccess()),
+ * nothing is written and the personnel cache is re-loaded instead.
  *
  * Returns immediately, if database is read-only.
  *
  * \param pIdent Identifier of the person to update.
  * \param pNewPerson Changed person.
- * \return If writing to database and re-loading personnel cache was successful.
+ * \return If writing to database and updating personnel cache was successful.
  */
 bool DatabaseCache::updatePerson(const QString& pIdent, const Person& pNewPerson)
 {
@@ -1036,6 +1661,19 @@ bool DatabaseCache::updatePerson(const QString& pIdent, const Person& pNewPerson
     }
 
     QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
+
+    const QString tNewMmbNr = Person::extractMembershipNumber(pNewPerson.getIdent());
+
+    //Check the database itself again, since the cache may miss records just added by another instance (see setConcurrentAccess())
+    if (!beginImmediateTransaction("personnelDb"))
+        return false;
+
+    if (tNewMmbNr != Person::extractMembershipNumber(pIdent) && !checkMembershipNumberNotInDatabase(tNewMmbNr))
+    {
+        rollbackTransaction("personnelDb");
+        return false;
+    }
+
     QSqlQuery personnelQuery(personnelDb);
 
     personnelQuery.prepare("UPDATE Personnel SET LastName=:lastName, FirstName=:firstName, MembershipNumber=:newMmbNr, "
@@ -1044,32 +1682,60 @@ bool DatabaseCache::updatePerson(const QString& pIdent, const Person& pNewPerson
     personnelQuery.bindValue(":lastName", pNewPerson.getLastName());
     personnelQuery.bindValue(":firstName", pNewPerson.getFirstName());
     personnelQuery.bindValue(":mmbNr", Person::extractMembershipNumber(pIdent));
-    personnelQuery.bindValue(":newMmbNr", Person::extractMembershipNumber(pNewPerson.getIdent()));
+    personnelQuery.bindValue(":newMmbNr", tNewMmbNr);
     personnelQuery.bindValue(":qualis", pNewPerson.getQualifications().toString());
     personnelQuery.bindValue(":status", pNewPerson.getActive() ? 0 : 1);
 
     if (!personnelQuery.exec())
     {
         std::cerr<<"ERROR: Could not update person in personnel database!"<<std::endl;
+        rollbackTransaction("personnelDb");
         return false;
     }
 
-    //Reload personnel to obtain new/changed row IDs
+    //Person may have been removed or renumbered by another instance meanwhile; then the cache is outdated as well
+    if (personnelQuery.numRowsAffected() != 1)
+    {
+        std::cerr<<"ERROR: Person to update not found in personnel database! Reloading personnel."<<std::endl;
+        rollbackTransaction("personnelDb");
+        reloadPersonnel();
+        return false;
+    }
 
-    personnelMap.clear();
+    if (!commitTransaction("personnelDb"))
+        return false;
 
-    return loadPersonnel();
-}
+    //Replace the cached person (row ID is unchanged by the update)
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        int tRowId = personnelIdentIndex.at(pIdent);
+        Person& tCachedPerson = personnelMap.at(tRowId);
+
+        unindexPerson(tRowId, tCachedPerson);
+
+        tCachedPerson = personFromRecord(pNewPerson.getLastName(), pNewPerson.getFirstName(),
+                                         Person::extractMembershipNumber(pNewPerson.getIdent()),
+                                         pNewPerson.getQualifications(), pNewPerson.getActive() ? 0 : 1);
+
+        indexPerson(tRowId, tCachedPerson);
+
+        invalidatePersonnelSnapshot();
+    }
+
+    return verifyPersonnelIfEnabled();
+}
 
 /*!
  * \brief Remove person from personnel cache and database.
  *
- * Removes person with identifier \p pIdent from the database and, if successful, clears and re-loads the personnel cache.
+ * Removes person with identifier \p pIdent from the database and, if successful, also removes it from the personnel cache.
  *
  * Returns immediately, if database is read-only.
  *
  * \param pIdent Identifier of the person to remove.
- * \return If writing to database and re-loading personnel cache was successful.
+ * \return If writing to database and updating personnel cache was successful.
  */
 bool DatabaseCache::removePerson(const QString& pIdent)
 {
@@ -1095,11 +1761,147 @@ bool DatabaseCache::removePerson(const QString& pIdent)
         return false;
     }
 
-    //Reload personnel to obtain new/changed row IDs
+    //Remove the person from cache
 
-    personnelMap.clear();
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        int tRowId = personnelIdentIndex.at(pIdent);
+
+        unindexPerson(tRowId, personnelMap.at(tRowId));
+        personnelMap.erase(tRowId);
+
+        invalidatePersonnelSnapshot();
+    }
+
+    return verifyPersonnelIfEnabled();
+}
+
+/*!
+ * \brief Add many new persons to personnel cache and database at once.
+ *
+ * Adds new person records for all persons from \p pNewPersons to the personnel database, which is much faster
+ * than calling addPerson() for each person, since all records are inserted by a single batch execution
+ * of one prepared statement within a single database transaction. If this fails, the transaction is rolled back
+ * and no person is added at all. Otherwise the personnel cache is cleared and re-loaded only once at the end.
+ *
+ * Persons that are wrongly formatted (see checkPersonFormat()) or whose membership number either already exists
+ * in the personnel database or appears multiple times in \p pNewPersons are skipped.
+ * Their indices in \p pNewPersons are appended to \p pInvalidPersons and \p pDuplicatePersons, respectively.
+ *
+ * Returns immediately, if database is read-only.
+ *
+ * \param pNewPersons New persons.
+ * \param pInvalidPersons Indices of skipped, wrongly formatted persons from \p pNewPersons.
+ * \param pDuplicatePersons Indices of skipped persons from \p pNewPersons with duplicate membership number.
+ * \return If writing to database and updating personnel cache was successful.
+ */
+bool DatabaseCache::addPersons(const std::vector<Person>& pNewPersons,
+                               std::vector<std::size_t>& pInvalidPersons, std::vector<std::size_t>& pDuplicatePersons)
+{
+    if (isPersonnelReadOnly())
+        return false;
+
+    QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
+
+    //Check for duplicates against the database itself within the transaction, since the cache may miss records
+    //just added by another instance (see setConcurrentAccess())
+
+    if (!beginImmediateTransaction("personnelDb"))
+        return false;
+
+    std::set<QString> tExistingMmbNrs;
+
+    {
+        QSqlQuery mmbNrsQuery(personnelDb);
+
+        if (!mmbNrsQuery.exec("SELECT MembershipNumber FROM Personnel;"))
+        {
+            std::cerr<<"ERROR: Could not read personnel database!"<<std::endl;
+            rollbackTransaction("personnelDb");
+            return false;
+        }
+
+        while (mmbNrsQuery.next())
+            tExistingMmbNrs.insert(mmbNrsQuery.value(0).toString());
+    }
+
+    //Check all persons first and collect the accepted ones column-wise for the batch execution
+
+    QVariantList tLastNames, tFirstNames, tMmbNrs, tQualis, tStatuses;
+
+    std::set<QString> tNewMmbNrs;
+
+    for (std::size_t i = 0; i < pNewPersons.size(); ++i)
+    {
+        const Person& tPerson = pNewPersons[i];
 
-    return loadPersonnel();
+        if (!checkPersonFormat(tPerson))
+        {
+            pInvalidPersons.push_back(i);
+            continue;
+        }
+
+        QString tMmbNr = Person::extractMembershipNumber(tPerson.getIdent());
+
+        if (tExistingMmbNrs.find(tMmbNr) != tExistingMmbNrs.end() || !tNewMmbNrs.insert(tMmbNr).second)
+        {
+            pDuplicatePersons.push_back(i);
+            continue;
+        }
+
+        tLastNames.push_back(tPerson.getLastName());
+        tFirstNames.push_back(tPerson.getFirstName());
+        tMmbNrs.push_back(tMmbNr);
+        tQualis.push_back(tPerson.getQualifications().toString());
+        tStatuses.push_back(tPerson.getActive() ? 0 : 1);
+    }
+
+    if (tMmbNrs.isEmpty())
+    {
+        rollbackTransaction("personnelDb");
+        return true;
+    }
+
+    QSqlQuery personnelQuery(personnelDb);
+
+    personnelQuery.prepare("INSERT INTO Personnel (LastName, FirstName, MembershipNumber, Qualifications, Status) "
+                           "VALUES (:lastName, :firstName, :mmbNr, :qualis, :status);");
+    personnelQuery.bindValue(":lastName", tLastNames);
+    personnelQuery.bindValue(":firstName", tFirstNames);
+    personnelQuery.bindValue(":mmbNr", tMmbNrs);
+    personnelQuery.bindValue(":qualis", tQualis);
+    personnelQuery.bindValue(":status", tStatuses);
+
+    if (!personnelQuery.execBatch())
+    {
+        std::cerr<<"ERROR: Could not add persons to personnel database!"<<std::endl;
+        rollbackTransaction("personnelDb");
+        return false;
+    }
+
+    if (!commitTransaction("personnelDb"))
+        return false;
+
+    return reloadPersonnel();
+}
+
+//
+
+/*!
+ * \brief Enable or disable verification of the personnel cache after each change.
+ *
+ * The personnel cache is not re-loaded from the database after adding, updating or removing a person
+ * but directly updated instead (see addPerson(), updatePerson(), removePerson()). If verification is enabled,
+ * each such change is followed by a comparison of the whole personnel cache with the database records,
+ * which is expensive but useful for testing. Verification is disabled by default. It is enabled by the concurrency
+ * stress test and can be enabled for the application by setting the environment variable WACHDIENST_MANAGER_VERIFY_PERSONNEL to 1.
+ *
+ * \param pVerify Verify the personnel cache after each change?
+ */
+void DatabaseCache::setPersonnelVerification(const bool pVerify)
+{
+    verifyPersonnel = pVerify;
 }
 
 //Private
@@ -1109,13 +1911,16 @@ bool DatabaseCache::removePerson(const QString& pIdent)
  *
  * Loads all settings from configuration database into settings cache that have integer type.
  *
- * Note: Does not clear the settings cache before. Values of existing settings are, however, simply overwritten.
+ * Note: Does not clear the settings cache before, unless \p pClear is true. Values of existing settings are, however,
+ * simply overwritten. The loaded settings are put into the cache at once and the cache is left unchanged on failure.
  *
+ * \param pConnectionName Name of the configuration database connection to read from.
+ * \param pClear Replace the whole settings cache (of this type) by the loaded settings.
  * \return If reading from database was successful.
  */
-bool DatabaseCache::loadIntSettings()
+bool DatabaseCache::loadIntSettings(const QString& pConnectionName, const bool pClear)
 {
-    QSqlDatabase configDb = QSqlDatabase::database("configDb");
+    QSqlDatabase configDb = QSqlDatabase::database(pConnectionName);
     QSqlQuery configQuery(configDb);
 
     configQuery.prepare("SELECT Setting, ValueInt FROM Application WHERE Type=:type;");
@@ -1124,13 +1929,29 @@ bool DatabaseCache::loadIntSettings()
     if (!configQuery.exec())
         return false;
 
+    std::map<QString, int> tSettings;
+
     while (configQuery.next())
     {
         QString tSetting = configQuery.value("Setting").toString();
         int tValue = configQuery.value("ValueInt").toInt();
-        settingsInt[tSetting] = tValue;
+        tSettings[tSetting] = tValue;
+    }
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        if (pClear)
+            settingsInt.swap(tSettings);
+        else
+        {
+            for (const auto& it : tSettings)
+                settingsInt[it.first] = it.second;
+        }
     }
 
+    ++settingsGenerationCounter;
+
     return true;
 }
 
@@ -1139,13 +1960,16 @@ bool DatabaseCache::loadIntSettings()
  *
  * Loads all settings from configuration database into settings cache that have floating-point type.
  *
- * Note: Does not clear the settings cache before. Values of existing settings are, however, simply overwritten.
+ * Note: Does not clear the settings cache before, unless \p pClear is true. Values of existing settings are, however,
+ * simply overwritten. The loaded settings are put into the cache at once and the cache is left unchanged on failure.
  *
+ * \param pConnectionName Name of the configuration database connection to read from.
+ * \param pClear Replace the whole settings cache (of this type) by the loaded settings.
  * \return If reading from database was successful.
  */
-bool DatabaseCache::loadDblSettings()
+bool DatabaseCache::loadDblSettings(const QString& pConnectionName, const bool pClear)
 {
-    QSqlDatabase configDb = QSqlDatabase::database("configDb");
+    QSqlDatabase configDb = QSqlDatabase::database(pConnectionName);
     QSqlQuery configQuery(configDb);
 
     configQuery.prepare("SELECT Setting, ValueDbl FROM Application WHERE Type=:type;");
@@ -1154,13 +1978,29 @@ bool DatabaseCache::loadDblSettings()
     if (!configQuery.exec())
         return false;
 
+    std::map<QString, double> tSettings;
+
     while (configQuery.next())
     {
         QString tSetting = configQuery.value("Setting").toString();
         double tValue = configQuery.value("ValueDbl").toDouble();
-        settingsDbl[tSetting] = tValue;
+        tSettings[tSetting] = tValue;
+    }
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        if (pClear)
+            settingsDbl.swap(tSettings);
+        else
+        {
+            for (const auto& it : tSettings)
+                settingsDbl[it.first] = it.second;
+        }
     }
 
+    ++settingsGenerationCounter;
+
     return true;
 }
 
@@ -1169,13 +2009,16 @@ bool DatabaseCache::loadDblSettings()
  *
  * Loads all settings from configuration database into settings cache that have string type.
  *
- * Note: Does not clear the settings cache before. Values of existing settings are, however, simply overwritten.
+ * Note: Does not clear the settings cache before, unless \p pClear is true. Values of existing settings are, however,
+ * simply overwritten. The loaded settings are put into the cache at once and the cache is left unchanged on failure.
  *
+ * \param pConnectionName Name of the configuration database connection to read from.
+ * \param pClear Replace the whole settings cache (of this type) by the loaded settings.
  * \return If reading from database was successful.
  */
-bool DatabaseCache::loadStrSettings()
+bool DatabaseCache::loadStrSettings(const QString& pConnectionName, const bool pClear)
 {
-    QSqlDatabase configDb = QSqlDatabase::database("configDb");
+    QSqlDatabase configDb = QSqlDatabase::database(pConnectionName);
     QSqlQuery configQuery(configDb);
 
     configQuery.prepare("SELECT Setting, ValueStr FROM Application WHERE Type=:type;");
@@ -1184,16 +2027,56 @@ bool DatabaseCache::loadStrSettings()
     if (!configQuery.exec())
         return false;
 
+    std::map<QString, QString> tSettings;
+
     while (configQuery.next())
     {
         QString tSetting = configQuery.value("Setting").toString();
         QString tValue = configQuery.value("ValueStr").toString();
-        settingsStr[tSetting] = tValue;
+        tSettings[tSetting] = tValue;
+    }
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        if (pClear)
+            settingsStr.swap(tSettings);
+        else
+        {
+            for (const auto& it : tSettings)
+                settingsStr[it.first] = it.second;
+        }
     }
 
+    ++settingsGenerationCounter;
+
     return true;
 }
 
+/*!
+ * \brief Remember a setting for deferred writing to the database (see flushSettings()).
+ *
+ * Replaces the value of an already deferred setting (keeping, whether it needs to be inserted)
+ * and (re-)starts the timer that calls flushSettings() after some idle time.
+ *
+ * \param pSetting Name of the setting.
+ * \param pType Setting type as stored in the database (0: integer, 1: floating-point, 2: string).
+ * \param pValue New value for the setting.
+ * \param pInsert Setting not yet in database (insert instead of update)?
+ */
+void DatabaseCache::deferSetting(const QString& pSetting, const int pType, const QVariant& pValue, const bool pInsert)
+{
+    auto it = pendingSettings.find(pSetting);
+
+    if (it != pendingSettings.end())
+        it->second.value = pValue;
+    else
+        pendingSettings.insert({pSetting, PendingSetting{pType, pValue, pInsert}});
+
+    if (settingsFlushTimer != nullptr)
+        settingsFlushTimer->start();
+}
+
 //
 
 /*!
@@ -1201,13 +2084,16 @@ bool DatabaseCache::loadStrSettings()
  *
  * Skips stations that are wrongly formatted or duplicate (see checkStationFormat(), checkStationDuplicates()).
  *
- * Note: Does not clear the stations cache before. Stations with the same database row ID are simply overwritten.
+ * Note: Does not clear the stations cache before, unless \p pClear is true. Stations with the same database row ID are simply
+ * overwritten. The loaded stations are put into the cache at once and the cache is left unchanged on failure.
  *
+ * \param pConnectionName Name of the configuration database connection to read from.
+ * \param pClear Replace the whole stations cache by the loaded stations.
  * \return If reading from database was successful.
  */
-bool DatabaseCache::loadStations()
+bool DatabaseCache::loadStations(const QString& pConnectionName, const bool pClear)
 {
-    QSqlDatabase configDb = QSqlDatabase::database("configDb");
+    QSqlDatabase configDb = QSqlDatabase::database(pConnectionName);
     QSqlQuery configQuery(configDb);
 
     configQuery.prepare("SELECT Location, Name, LocalGroup, DistrictAssociation, RadioCallName, RadioCallNameAlt, "
@@ -1217,6 +2103,7 @@ bool DatabaseCache::loadStations()
         return false;
 
     std::vector<Aux::Station> tStationList;
+    std::map<int, Aux::Station> tStations;
 
     while (configQuery.next())
     {
@@ -1242,7 +2129,19 @@ bool DatabaseCache::loadStations()
         }
 
         tStationList.push_back(tStation);
-        stationsMap[tRowId] = std::move(tStation);
+        tStations[tRowId] = std::move(tStation);
+    }
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        if (pClear)
+            stationsMap.swap(tStations);
+        else
+        {
+            for (auto& it : tStations)
+                stationsMap[it.first] = std::move(it.second);
+        }
     }
 
     return true;
@@ -1253,13 +2152,16 @@ bool DatabaseCache::loadStations()
  *
  * Skips boats that are wrongly formatted or duplicate (see checkBoatFormat(), checkBoatDuplicates()).
  *
- * Note: Does not clear the boats cache before. Boats with the same database row ID are simply overwritten.
+ * Note: Does not clear the boats cache before, unless \p pClear is true. Boats with the same database row ID are simply
+ * overwritten. The loaded boats are put into the cache at once and the cache is left unchanged on failure.
  *
+ * \param pConnectionName Name of the configuration database connection to read from.
+ * \param pClear Replace the whole boats cache by the loaded boats.
  * \return If reading from database was successful.
  */
-bool DatabaseCache::loadBoats()
+bool DatabaseCache::loadBoats(const QString& pConnectionName, const bool pClear)
 {
-    QSqlDatabase configDb = QSqlDatabase::database("configDb");
+    QSqlDatabase configDb = QSqlDatabase::database(pConnectionName);
     QSqlQuery configQuery(configDb);
 
     configQuery.prepare("SELECT Name, Acronym, Type, FuelType, RadioCallName, RadioCallNameAlt, HomeStation, rowid "
@@ -1269,6 +2171,7 @@ bool DatabaseCache::loadBoats()
         return false;
 
     std::vector<Aux::Boat> tBoatList;
+    std::map<int, Aux::Boat> tBoats;
 
     while (configQuery.next())
     {
@@ -1305,7 +2208,19 @@ bool DatabaseCache::loadBoats()
         }
 
         tBoatList.push_back(tBoat);
-        boatsMap[tRowId] = std::move(tBoat);
+        tBoats[tRowId] = std::move(tBoat);
+    }
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        if (pClear)
+            boatsMap.swap(tBoats);
+        else
+        {
+            for (auto& it : tBoats)
+                boatsMap[it.first] = std::move(it.second);
+        }
     }
 
     return true;
@@ -1318,13 +2233,20 @@ bool DatabaseCache::loadBoats()
  *
  * Skips persons that are wrongly formatted or duplicate (see checkPersonFormat(), checkPersonnelDuplicates()).
  *
- * Note: Does not clear the personnel cache before. Persons with the same database row ID are skipped.
+ * Note: Does not clear the personnel cache before, unless \p pClear is true. Persons with the same database row ID
+ * are skipped. The loaded persons are put into the cache at once and the cache is left unchanged on failure.
+ *
+ * The new cache (including lookup indexes and personnel snapshot) is built without holding the cache lock,
+ * which is only taken exclusively for swapping it in. Hence the personnel cache must not be changed concurrently
+ * (i.e. personnel changes must not be made while loading from another thread, see also populateAsync()).
  *
+ * \param pConnectionName Name of the personnel database connection to read from.
+ * \param pClear Replace the whole personnel cache by the loaded persons.
  * \return If reading from database was successful.
  */
-bool DatabaseCache::loadPersonnel()
+bool DatabaseCache::loadPersonnel(const QString& pConnectionName, const bool pClear)
 {
-    QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
+    QSqlDatabase personnelDb = QSqlDatabase::database(pConnectionName);
     QSqlQuery personnelQuery(personnelDb);
 
     personnelQuery.prepare("SELECT LastName, FirstName, MembershipNumber, Qualifications, Status, rowid FROM Personnel;");
@@ -1332,24 +2254,47 @@ bool DatabaseCache::loadPersonnel()
     if (!personnelQuery.exec())
         return false;
 
-    std::vector<Person> tPersonsList;
+    //Read all records first in order to parse the (mostly recurring) qualification strings in bulk
+
+    std::vector<QString> tLastNames, tFirstNames, tMembershipNumbers, tQualiStrings;
+    std::vector<int> tStatuses, tRowIds;
 
     while (personnelQuery.next())
     {
-        Person tPerson(personnelQuery.value("LastName").toString(),
-                       personnelQuery.value("FirstName").toString(),
-                       Person::createInternalIdent(
-                           personnelQuery.value("LastName").toString(),
-                           personnelQuery.value("FirstName").toString(),
-                           personnelQuery.value("MembershipNumber").toString()
-                           ),
-                       Person::Qualifications(
-                           personnelQuery.value("Qualifications").toString()
-                           ),
-                       personnelQuery.value("Status").toInt() == 0
-                       );
-
-        int tRowId = personnelQuery.value("rowid").toInt();
+        tLastNames.push_back(personnelQuery.value("LastName").toString());
+        tFirstNames.push_back(personnelQuery.value("FirstName").toString());
+        tMembershipNumbers.push_back(personnelQuery.value("MembershipNumber").toString());
+        tQualiStrings.push_back(personnelQuery.value("Qualifications").toString());
+        tStatuses.push_back(personnelQuery.value("Status").toInt());
+        tRowIds.push_back(personnelQuery.value("rowid").toInt());
+    }
+
+    std::vector<Person::Qualifications> tQualis;
+    Person::Qualifications::parseBulk(tQualiStrings, tQualis);
+
+    //Build the new cache outside of the lock and only take the exclusive lock for swapping it in,
+    //such that readers are not blocked while the persons are checked and indexed
+
+    std::map<int, Person> tPersonnelMap;
+    std::unordered_map<QString, int> tIdentIndex;
+    std::unordered_map<QString, int> tMmbNrIndex;
+    std::map<std::pair<QString, QString>, std::set<int>> tNameIndex;
+
+    if (!pClear)
+    {
+        const std::shared_lock<std::shared_mutex> tLock(cacheMutex);
+
+        tPersonnelMap = personnelMap;
+        tIdentIndex = personnelIdentIndex;
+        tMmbNrIndex = personnelMmbNrIndex;
+        tNameIndex = personnelNameIndex;
+    }
+
+    for (std::size_t i = 0; i < tRowIds.size(); ++i)
+    {
+        Person tPerson = personFromRecord(tLastNames[i], tFirstNames[i], tMembershipNumbers[i], tQualis[i], tStatuses[i]);
+
+        int tRowId = tRowIds[i];
 
         if (!checkPersonFormat(tPerson))
         {
@@ -1357,19 +2302,456 @@ bool DatabaseCache::loadPersonnel()
             continue;
         }
 
-        if (!checkPersonnelDuplicates(tPerson))
+        const QString tMmbNr = Person::extractMembershipNumber(tPerson.getIdent());
+
+        //Same check as checkPersonnelDuplicates() but against the new cache
+        if (tMmbNrIndex.find(tMmbNr) != tMmbNrIndex.end())
         {
             std::cerr<<"WARNING: Duplicate person record! Skip."<<std::endl;
             continue;
         }
 
-        tPersonsList.push_back(tPerson);
-        personnelMap.insert({tRowId, std::move(tPerson)});
+        auto insertIt = tPersonnelMap.insert({tRowId, std::move(tPerson)});
+
+        if (insertIt.second)
+        {
+            const Person& tInsertedPerson = insertIt.first->second;
+
+            tIdentIndex[tInsertedPerson.getIdent()] = tRowId;
+            tMmbNrIndex[tMmbNr] = tRowId;
+            tNameIndex[{tInsertedPerson.getLastName(), tInsertedPerson.getFirstName()}].insert(tRowId);
+        }
+    }
+
+    std::shared_ptr<const std::vector<Person>> tSnapshot = createPersonnelSnapshot(tPersonnelMap);
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(cacheMutex);
+
+        personnelMap.swap(tPersonnelMap);
+        personnelIdentIndex.swap(tIdentIndex);
+        personnelMmbNrIndex.swap(tMmbNrIndex);
+        personnelNameIndex.swap(tNameIndex);
+
+        std::atomic_store(&personnelSnapshotPtr, std::move(tSnapshot));
+        personnelSnapshotOutdated.store(false);
     }
 
+    //Previous cache is destroyed only here, after releasing the lock
+
     return true;
 }
 
+/*!
+ * \brief Load configuration database into cache using a separate database connection.
+ *
+ * Loads settings, stations and boats like populate() but through a temporary clone of the "configDb" connection,
+ * such that this function can be executed in a different thread (see populateAsync()).
+ *
+ * \return If reading from database was successful.
+ */
+bool DatabaseCache::loadConfigInBackground()
+{
+    const QString tConnectionName = "configDbLoader";
+
+    bool tSuccess = false;
+
+    {
+        QSqlDatabase configDb = QSqlDatabase::cloneDatabase("configDb", tConnectionName);
+
+        if (configDb.open())
+        {
+            tSuccess = loadIntSettings(tConnectionName);
+            tSuccess &= loadDblSettings(tConnectionName);
+            tSuccess &= loadStrSettings(tConnectionName);
+            tSuccess &= loadStations(tConnectionName);
+            tSuccess &= loadBoats(tConnectionName);
+
+            configDb.close();
+        }
+        else
+            std::cerr<<"ERROR: Could not open configuration database!"<<std::endl;
+    }
+
+    //Connection must not be referenced anymore here
+    QSqlDatabase::removeDatabase(tConnectionName);
+
+    if (stationsMap.empty())
+        std::cerr<<"WARNING: No stations found in database!"<<std::endl;
+    if (boatsMap.empty())
+        std::cerr<<"WARNING: No boats found in database!"<<std::endl;
+
+    return tSuccess;
+}
+
+/*!
+ * \brief Load personnel database into cache using a separate database connection.
+ *
+ * Loads the personnel like populate() but through a temporary clone of the "personnelDb" connection,
+ * such that this function can be executed in a different thread (see populateAsync()).
+ *
+ * \return If reading from database was successful.
+ */
+bool DatabaseCache::loadPersonnelInBackground()
+{
+    const QString tConnectionName = "personnelDbLoader";
+
+    bool tSuccess = false;
+
+    {
+        QSqlDatabase personnelDb = QSqlDatabase::cloneDatabase("personnelDb", tConnectionName);
+
+        if (personnelDb.open())
+        {
+            tSuccess = loadPersonnel(tConnectionName);
+
+            personnelDb.close();
+        }
+        else
+            std::cerr<<"ERROR: Could not open personnel database!"<<std::endl;
+    }
+
+    //Connection must not be referenced anymore here
+    QSqlDatabase::removeDatabase(tConnectionName);
+
+    if (personnelMap.empty())
+        std::cerr<<"WARNING: No personnel found in database!"<<std::endl;
+
+    return tSuccess;
+}
+
+//
+
+/*!
+ * \brief Read SQLite's data version of a database connection.
+ *
+ * \param pConnectionName Name of the database connection.
+ * \return Value of 'PRAGMA data_version', if query successful, and -1 otherwise.
+ */
+int DatabaseCache::getDataVersion(const QString& pConnectionName)
+{
+    QSqlDatabase database = QSqlDatabase::database(pConnectionName);
+    QSqlQuery query(database);
+
+    if (query.exec("PRAGMA data_version;") && query.next())
+        return query.value(0).toInt();
+    else
+        return -1;
+}
+
+/*!
+ * \brief Check the SQLite journal mode of a database connection.
+ *
+ * \param pConnectionName Name of the database connection.
+ * \param pJournalMode Expected journal mode (lower case, e.g. "wal" or "delete").
+ * \return If the journal mode is \p pJournalMode.
+ */
+bool DatabaseCache::hasJournalMode(const QString& pConnectionName, const QString& pJournalMode)
+{
+    QSqlQuery query(QSqlDatabase::database(pConnectionName));
+
+    return query.exec("PRAGMA journal_mode;") && query.next() && query.value(0).toString().toLower() == pJournalMode;
+}
+
+/*!
+ * \brief Set the SQLite journal mode and busy timeout of a database connection.
+ *
+ * \param pConnectionName Name of the database connection.
+ * \param pJournalMode New journal mode (lower case, e.g. "wal" or "delete").
+ * \return If the journal mode is \p pJournalMode afterwards.
+ */
+bool DatabaseCache::setJournalMode(const QString& pConnectionName, const QString& pJournalMode)
+{
+    QSqlDatabase database = QSqlDatabase::database(pConnectionName);
+    QSqlQuery query(database);
+
+    if (!query.exec("PRAGMA busy_timeout = 5000;"))
+        return false;
+
+    //Changing the journal mode requires exclusive access, so only do that if actually necessary
+    if (hasJournalMode(pConnectionName, pJournalMode))
+        return true;
+
+    if (!query.exec("PRAGMA journal_mode = " + pJournalMode + ";") || !query.next())
+        return false;
+
+    return query.value(0).toString().toLower() == pJournalMode;
+}
+
+/*!
+ * \brief Start an immediate transaction on a database connection.
+ *
+ * In contrast to QSqlDatabase::transaction() the database write lock is acquired at once ("BEGIN IMMEDIATE"),
+ * such that no other connection can write to the database between reading and writing within the transaction.
+ *
+ * \param pConnectionName Name of the database connection.
+ * \return If successful.
+ */
+bool DatabaseCache::beginImmediateTransaction(const QString& pConnectionName)
+{
+    QSqlQuery query(QSqlDatabase::database(pConnectionName));
+
+    if (!query.exec("BEGIN IMMEDIATE;"))
+    {
+        std::cerr<<"ERROR: Could not start database transaction!"<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Commit a transaction started by beginImmediateTransaction().
+ *
+ * Rolls the transaction back, if committing fails.
+ *
+ * \param pConnectionName Name of the database connection.
+ * \return If successful.
+ */
+bool DatabaseCache::commitTransaction(const QString& pConnectionName)
+{
+    QSqlQuery query(QSqlDatabase::database(pConnectionName));
+
+    if (!query.exec("COMMIT;"))
+    {
+        std::cerr<<"ERROR: Could not commit database transaction!"<<std::endl;
+        rollbackTransaction(pConnectionName);
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Roll back a transaction started by beginImmediateTransaction().
+ *
+ * \param pConnectionName Name of the database connection.
+ */
+void DatabaseCache::rollbackTransaction(const QString& pConnectionName)
+{
+    QSqlQuery query(QSqlDatabase::database(pConnectionName));
+    query.exec("ROLLBACK;");
+}
+
+/*!
+ * \brief Check that a membership number does not exist in the personnel database.
+ *
+ * In contrast to checkPersonnelDuplicates() the personnel database itself is queried, which also detects records
+ * that were just added by another program instance and are not yet in the personnel cache (see setConcurrentAccess()).
+ * Should be called within a transaction (see beginImmediateTransaction()) that also writes the new membership number.
+ *
+ * Prints an error, if the membership number exists or the query fails.
+ *
+ * \param pMembershipNumber Membership number to check.
+ * \return If the query was successful and no record has membership number \p pMembershipNumber.
+ */
+bool DatabaseCache::checkMembershipNumberNotInDatabase(const QString& pMembershipNumber)
+{
+    QSqlQuery query(QSqlDatabase::database("personnelDb"));
+
+    query.prepare("SELECT 1 FROM Personnel WHERE MembershipNumber=:mmbNr LIMIT 1;");
+    query.bindValue(":mmbNr", pMembershipNumber);
+
+    if (!query.exec())
+    {
+        std::cerr<<"ERROR: Could not read personnel database!"<<std::endl;
+        return false;
+    }
+
+    if (query.next())
+    {
+        std::cerr<<"ERROR: Duplicate membership number!"<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Clear the personnel cache and its lookup indexes.
+ *
+ * Note: The cache lock must be held exclusively. The personnel snapshot is not replaced (see publishPersonnelSnapshot()).
+ */
+void DatabaseCache::clearPersonnel()
+{
+    personnelMap.clear();
+
+    personnelIdentIndex.clear();
+    personnelMmbNrIndex.clear();
+    personnelNameIndex.clear();
+}
+
+/*!
+ * \brief Add a cached person to the personnel lookup indexes.
+ *
+ * Adds \p pPerson, which must already be cached in the personnel cache with row ID \p pRowId,
+ * to the lookup indexes for identifier, membership number and name.
+ *
+ * \param pRowId Database row ID of the person.
+ * \param pPerson The cached person.
+ */
+void DatabaseCache::indexPerson(const int pRowId, const Person& pPerson)
+{
+    personnelIdentIndex[pPerson.getIdent()] = pRowId;
+    personnelMmbNrIndex[Person::extractMembershipNumber(pPerson.getIdent())] = pRowId;
+    personnelNameIndex[{pPerson.getLastName(), pPerson.getFirstName()}].insert(pRowId);
+}
+
+/*!
+ * \brief Remove a cached person from the personnel lookup indexes.
+ *
+ * Removes \p pPerson, which is cached in the personnel cache with row ID \p pRowId,
+ * from the lookup indexes for identifier, membership number and name.
+ *
+ * \param pRowId Database row ID of the person.
+ * \param pPerson The cached person.
+ */
+void DatabaseCache::unindexPerson(const int pRowId, const Person& pPerson)
+{
+    personnelIdentIndex.erase(pPerson.getIdent());
+    personnelMmbNrIndex.erase(Person::extractMembershipNumber(pPerson.getIdent()));
+
+    auto nameIt = personnelNameIndex.find({pPerson.getLastName(), pPerson.getFirstName()});
+
+    if (nameIt != personnelNameIndex.end())
+    {
+        nameIt->second.erase(pRowId);
+
+        if (nameIt->second.empty())
+            personnelNameIndex.erase(nameIt);
+    }
+}
+
+/*!
+ * \brief Find person in personnel cache by its identifier.
+ *
+ * \param pIdent Person's identifier.
+ * \return Pointer to the cached person or nullptr, if no person with identifier \p pIdent is cached.
+ */
+const Person* DatabaseCache::findPerson(const QString& pIdent)
+{
+    auto identIt = personnelIdentIndex.find(pIdent);
+
+    if (identIt == personnelIdentIndex.end())
+        return nullptr;
+
+    return &personnelMap.at(identIt->second);
+}
+
+/*!
+ * \brief Replace the personnel snapshot by the current personnel cache.
+ *
+ * Creates a new immutable copy of the personnel cache and atomically replaces the snapshot returned by personnel().
+ *
+ * Note: The cache lock must be held exclusively.
+ */
+void DatabaseCache::publishPersonnelSnapshot()
+{
+    std::atomic_store(&personnelSnapshotPtr, createPersonnelSnapshot(personnelMap));
+    personnelSnapshotOutdated.store(false);
+}
+
+/*!
+ * \brief Mark the personnel snapshot as outdated.
+ *
+ * Instead of immediately copying the whole personnel cache after each change, the snapshot is only replaced
+ * by the next call of personnel() (see publishPersonnelSnapshot()).
+ *
+ * Note: The cache lock must be held exclusively.
+ */
+void DatabaseCache::invalidatePersonnelSnapshot()
+{
+    personnelSnapshotOutdated.store(true);
+}
+
+/*!
+ * \brief Create an immutable copy of a personnel cache.
+ *
+ * \param pPersonnel Personnel cache (database 'rowid' as key).
+ * \return Persons of \p pPersonnel in order of their row IDs.
+ */
+std::shared_ptr<const std::vector<Person>> DatabaseCache::createPersonnelSnapshot(const std::map<int, Person>& pPersonnel)
+{
+    std::shared_ptr<std::vector<Person>> tSnapshot = std::make_shared<std::vector<Person>>();
+    tSnapshot->reserve(pPersonnel.size());
+
+    for (const auto& it : pPersonnel)
+        tSnapshot->push_back(it.second);
+
+    return tSnapshot;
+}
+
+/*!
+ * \brief Create a cached person from the fields of a personnel database record.
+ *
+ * \param pLastName Person's last name.
+ * \param pFirstName Person's first name.
+ * \param pMembershipNumber Person's membership number.
+ * \param pQualifications Person's qualifications.
+ * \param pStatus Database status value (0 for active person).
+ * \return The person.
+ */
+Person DatabaseCache::personFromRecord(const QString& pLastName, const QString& pFirstName, const QString& pMembershipNumber,
+                                       const Person::Qualifications& pQualifications, const int pStatus)
+{
+    return Person(pLastName, pFirstName, Person::createInternalIdent(pLastName, pFirstName, pMembershipNumber),
+                  pQualifications, pStatus == 0);
+}
+
+/*!
+ * \brief Verify the personnel cache against the database, if enabled.
+ *
+ * Does nothing and returns true, if verification is disabled (see setPersonnelVerification()).
+ *
+ * Otherwise reads all personnel records from the database and compares them to the incrementally maintained personnel cache.
+ * If the cache does not exactly match the database records (apart from skipped invalid records, see loadPersonnel()),
+ * an error is printed and the personnel cache is cleared and re-loaded from the database.
+ *
+ * \return If verification is disabled or personnel cache matches database.
+ */
+bool DatabaseCache::verifyPersonnelIfEnabled()
+{
+    if (!verifyPersonnel)
+        return true;
+
+    //Copy instead of swapping the cache, such that readers never see an empty personnel cache
+    const std::map<int, Person> tCachedPersonnel = personnelMap;
+    const std::unordered_map<QString, int> tCachedIdentIndex = personnelIdentIndex;
+    const std::unordered_map<QString, int> tCachedMmbNrIndex = personnelMmbNrIndex;
+    const std::map<std::pair<QString, QString>, std::set<int>> tCachedNameIndex = personnelNameIndex;
+
+    //Load personnel from scratch for comparison
+    if (!loadPersonnel("personnelDb", true))
+    {
+        std::cerr<<"ERROR: Could not read personnel database for cache verification!"<<std::endl;
+        return false;
+    }
+
+    bool tConsistent = tCachedPersonnel.size() == personnelMap.size() && tCachedIdentIndex == personnelIdentIndex &&
+                       tCachedMmbNrIndex == personnelMmbNrIndex && tCachedNameIndex == personnelNameIndex;
+
+    for (auto cachedIt = tCachedPersonnel.begin(), loadedIt = personnelMap.begin();
+         tConsistent && cachedIt != tCachedPersonnel.end(); ++cachedIt, ++loadedIt)
+    {
+        const Person& tCachedPerson = cachedIt->second;
+        const Person& tLoadedPerson = loadedIt->second;
+
+        tConsistent = cachedIt->first == loadedIt->first &&
+                      tCachedPerson.getIdent() == tLoadedPerson.getIdent() &&
+                      tCachedPerson.getLastName() == tLoadedPerson.getLastName() &&
+                      tCachedPerson.getFirstName() == tLoadedPerson.getFirstName() &&
+                      tCachedPerson.getQualifications() == tLoadedPerson.getQualifications() &&
+                      tCachedPerson.getActive() == tLoadedPerson.getActive();
+    }
+
+    //Keep freshly loaded personnel in any case
+
+    if (!tConsistent)
+        std::cerr<<"ERROR: Personnel cache is inconsistent with personnel database! Reloaded personnel."<<std::endl;
+
+    return tConsistent;
+}
+
 //
 
 /*!
@@ -1523,16 +2905,12 @@ bool DatabaseCache::checkBoatDuplicates(const Aux::Boat& pBoat, const std::vecto
  * Searches the personnel cache for persons with the same membership number as \p pPerson.
  * The function returns false, if such a person is found, and true else.
  *
+ * Note: Does not lock the cache. Call only from the main thread or with the cache lock held.
+ *
  * \param pPerson Person to search for in cache.
  * \return If no person with membership number of \p pPerson found.
  */
 bool DatabaseCache::checkPersonnelDuplicates(const Person& pPerson)
 {
-    QString tMmbNr = Person::extractMembershipNumber(pPerson.getIdent());
-
-    for (const auto& it : personnelMap)
-        if (Person::extractMembershipNumber(it.second.getIdent()) == tMmbNr)
-            return false;
-
-    return true;
+    return personnelMmbNrIndex.find(Person::extractMembershipNumber(pPerson.getIdent())) == personnelMmbNrIndex.end();
 }
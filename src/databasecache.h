@@ -26,11 +26,21 @@
 #include "auxil.h"
 #include "person.h"
 
+#include <QHash>
 #include <QLockFile>
 #include <QString>
+#include <QTimer>
+#include <QVariant>
 
+#include <atomic>
+#include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
+#include <set>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 /*!
@@ -40,12 +50,30 @@
  * the databases using this class interface. Before using the DatabaseCache, all database records
  * must be read from the databases by calling populate(). This fills the cache and so reading from
  * databases can be avoided in most of this class's functions. Reading always happens via the cached
- * values. Note that some write functions will clear and then re-load parts of the cache, though.
+ * values. Note that some write functions will clear and then re-load parts of the cache, though
+ * (personnel changes are applied to the cache directly, see also setPersonnelVerification()).
  * All write functions (set.../update.../etc.) will update the cached values and will
  * also immediately write the new values to the corresponding database.
  *
+ * The cache can also be filled in the background by populateAsync(). Then waitForConfig() and waitForPersonnel()
+ * must be called before accessing the cached configuration or personnel, respectively.
+ *
+ * Personnel lookups by identifier, membership number or name do not search the whole personnel cache
+ * but use additional lookup indexes, which are always kept in sync with the cached personnel.
+ *
  * The write functions always check for the respective database lock files via isConfigReadOnly() and isPersonnelReadOnly().
  * If those return true, the corresponding write operation is skipped and the cached value left as is.
+ * Multiple program instances can be allowed to write concurrently via setConcurrentAccess().
+ *
+ * Changes made to the databases by other connections (e.g. other program instances) can be detected
+ * via configChanged() and personnelChanged() and the affected part of the cache can then be re-loaded
+ * via reloadConfig() or reloadPersonnel(), respectively (see also DatabaseWatcher).
+ *
+ * All read functions (get.../stations()/boats()/lookups) may be called from any thread. The cached values are protected
+ * by a reader-writer lock, which readers hold in shared mode only while copying the requested values, while the write
+ * functions hold it exclusively only while changing the cache (never during database queries). Re-loading a part of
+ * the cache replaces it at once, such that readers never observe a partially loaded cache. The write functions
+ * (set.../update.../add.../remove.../reload...) must, however, only be called from the main thread.
  */
 class DatabaseCache
 {
@@ -54,10 +82,23 @@ public:
     //
     static bool isConfigReadOnly();     ///< Check, if configuration database can be written.
     static bool isPersonnelReadOnly();  ///< Check, if personnel database can be written.
+    static bool setConcurrentAccess(bool pEnable);  ///< Enable or disable concurrent database access by multiple program instances.
     //
     static bool populate(std::shared_ptr<QLockFile> pConfLockFile, std::shared_ptr<QLockFile> pPersLockFile,
                          bool pForce = false);                                              ///< \brief Fill database cache with fields
                                                                                             ///  from settings and personnel databases.
+    static void populateAsync(std::shared_ptr<QLockFile> pConfLockFile, std::shared_ptr<QLockFile> pPersLockFile,
+                              bool pForce = false);                         ///< \brief Fill database cache asynchronously with fields
+                                                                            ///  from settings and personnel databases.
+    static bool waitForConfig();        ///< Wait until the configuration cache is filled.
+    static bool waitForPersonnel();     ///< Wait until the personnel cache is filled.
+    static bool isConfigReady();        ///< Check if the configuration cache is filled.
+    static bool isPersonnelReady();     ///< Check if the personnel cache is filled.
+    //
+    static bool configChanged();        ///< Check if the configuration database was changed by another connection.
+    static bool personnelChanged();     ///< Check if the personnel database was changed by another connection.
+    static bool reloadConfig();         ///< Re-load settings, stations and boats from configuration database into cache.
+    static bool reloadPersonnel();      ///< Re-load personnel from personnel database into cache.
     //
     static bool getSetting(const QString& pSetting, int& pValue,
                            int pDefault = 0, bool pCreate = false);         ///< Get a cached, integer type setting.
@@ -68,6 +109,11 @@ public:
     static bool setSetting(const QString& pSetting, int pValue);        ///< Write an integer type setting to cache and database.
     static bool setSetting(const QString& pSetting, double pValue);     ///< Write a floating-point type setting to cache and database.
     static bool setSetting(const QString& pSetting, const QString& pValue); ///< Write a string type setting to cache and database.
+    static uint64_t settingsGeneration();   ///< Get a counter that is incremented whenever any cached setting changes.
+    //
+    static bool setSettingsWriteBehind(bool pEnable);   ///< Enable or disable deferred writing of settings to the database.
+    static bool settingsWriteBehind();                  ///< Check, if settings are written to the database deferred.
+    static bool flushSettings();                        ///< Write all deferred settings to the database in a single transaction.
     //
     static std::map<int, Aux::Station> stations();                                  ///< Get the cached available stations.
     static std::map<int, Aux::Boat> boats();                                        ///< Get the cached available boats.
@@ -93,20 +139,66 @@ public:
                            const QString& pFirstName, bool pActiveOnly = false);        ///< \brief Get persons with specified
                                                                                         ///  name from personnel cache.
     static void getPersonnel(std::vector<Person>& pPersons);                            ///< Get all persons from personnel cache.
+    static std::shared_ptr<const std::vector<Person>> personnel();                      ///< \brief Get a shared, immutable snapshot
+                                                                                        ///  of all persons from personnel cache.
     //
     static bool addPerson(const Person& pNewPerson);                            ///< Add new person to personnel cache and database.
     static bool updatePerson(const QString& pIdent, const Person& pNewPerson);  ///< Update person in personnel cache and database.
     static bool removePerson(const QString& pIdent);                            ///< Remove person from personnel cache and database.
+    static bool addPersons(const std::vector<Person>& pNewPersons, std::vector<std::size_t>& pInvalidPersons,
+                           std::vector<std::size_t>& pDuplicatePersons);       ///< \brief Add many new persons to personnel
+                                                                                ///  cache and database at once.
+    //
+    static void setPersonnelVerification(bool pVerify);     ///< Enable or disable verification of the personnel cache after each change.
 
 private:
-    static bool loadIntSettings();  ///< Load all integer type settings from database into cache.
-    static bool loadDblSettings();  ///< Load all floating-point type settings from database into cache.
-    static bool loadStrSettings();  ///< Load all string type settings from database into cache.
+    static bool loadIntSettings(const QString& pConnectionName = "configDb",
+                                bool pClear = false);                           ///< \brief Load all integer type settings
+                                                                                ///  from database into cache.
+    static bool loadDblSettings(const QString& pConnectionName = "configDb",
+                                bool pClear = false);                           ///< \brief Load all floating-point type settings
+                                                                                ///  from database into cache.
+    static bool loadStrSettings(const QString& pConnectionName = "configDb",
+                                bool pClear = false);                           ///< Load all string type settings from database into cache.
+    static void deferSetting(const QString& pSetting, int pType, const QVariant& pValue,
+                             bool pInsert);                                     ///< \brief Remember a setting for deferred writing
+                                                                                ///  to the database (see flushSettings()).
+    //
+    static bool loadStations(const QString& pConnectionName = "configDb",
+                             bool pClear = false);                              ///< Load all stations from database into cache.
+    static bool loadBoats(const QString& pConnectionName = "configDb",
+                          bool pClear = false);                                 ///< Load all boats from database into cache.
+    //
+    static bool loadPersonnel(const QString& pConnectionName = "personnelDb",
+                              bool pClear = false);                             ///< Load all personnel from database into cache.
     //
-    static bool loadStations();     ///< Load all stations from database into cache.
-    static bool loadBoats();        ///< Load all boats from database into cache.
+    static bool loadConfigInBackground();       ///< Load configuration database into cache using a separate database connection.
+    static bool loadPersonnelInBackground();    ///< Load personnel database into cache using a separate database connection.
     //
-    static bool loadPersonnel();    ///< Load all personnel from database into cache.
+    static int getDataVersion(const QString& pConnectionName);                                 ///< \brief Read SQLite's data version
+                                                                                                ///  of a database connection.
+    static bool hasJournalMode(const QString& pConnectionName, const QString& pJournalMode);   ///< \brief Check the SQLite journal mode
+                                                                                                ///  of a database connection.
+    static bool setJournalMode(const QString& pConnectionName, const QString& pJournalMode);   ///< \brief Set the SQLite journal mode
+                                                                                                ///  and busy timeout of a database
+                                                                                                ///  connection.
+    static bool beginImmediateTransaction(const QString& pConnectionName); ///< Start an immediate transaction on a database connection.
+    static bool commitTransaction(const QString& pConnectionName);         ///< Commit a transaction started by beginImmediateTransaction().
+    static void rollbackTransaction(const QString& pConnectionName);       ///< Roll back a transaction started by beginImmediateTransaction().
+    //
+    static void clearPersonnel();                                   ///< Clear the personnel cache and its lookup indexes.
+    static void indexPerson(int pRowId, const Person& pPerson);     ///< Add a cached person to the personnel lookup indexes.
+    static void unindexPerson(int pRowId, const Person& pPerson);   ///< Remove a cached person from the personnel lookup indexes.
+    static const Person* findPerson(const QString& pIdent);         ///< Find person in personnel cache by its identifier.
+    static Person personFromRecord(const QString& pLastName, const QString& pFirstName, const QString& pMembershipNumber,
+                                   const Person::Qualifications& pQualifications,
+                                   int pStatus);                                    ///< \brief Create a cached person from the
+                                                                                    ///  fields of a personnel database record.
+    static bool verifyPersonnelIfEnabled();                         ///< Verify the personnel cache against the database, if enabled.
+    static void publishPersonnelSnapshot();                         ///< Replace the personnel snapshot by the current personnel cache.
+    static void invalidatePersonnelSnapshot();                      ///< Mark the personnel snapshot as outdated.
+    static std::shared_ptr<const std::vector<Person>> createPersonnelSnapshot(const std::map<int, Person>& pPersonnel);
+                                                                    ///< Create an immutable copy of a personnel cache.
     //
     static bool checkStationFormat(Aux::Station pStation);                          ///< Validate the station properties' formatting.
     static bool checkBoatFormat(Aux::Boat pBoat);                                   ///< Validate the boat properties' formatting.
@@ -118,9 +210,30 @@ private:
                                     const std::vector<Aux::Boat>& pBoats, bool pOneAllowed);
                                                                                     ///< Check if there are no duplicate boats.
     static bool checkPersonnelDuplicates(const Person& pPerson);                    ///< Check if there are no duplicate persons.
+    static bool checkMembershipNumberNotInDatabase(const QString& pMembershipNumber);   ///< \brief Check that a membership number
+                                                                                        ///  does not exist in the personnel database.
+
+private:
+    /*!
+     * \brief A setting waiting to be written to the database (see setSettingsWriteBehind()).
+     */
+    struct PendingSetting
+    {
+        int type;       ///< Setting type as stored in the database (0: integer, 1: floating-point, 2: string).
+        QVariant value; ///< New value of the setting.
+        bool insert;    ///< Setting not yet in database (insert instead of update)?
+    };
 
 private:
     static bool populated;                              //Database fields loaded into cache from databases by populate()?
+    static bool verifyPersonnel;                        //Compare personnel cache with database after each personnel change?
+    static bool concurrentAccess;                       //Ignore lock files and allow writing from multiple instances (WAL mode)?
+    //
+    static int configDataVersion;                       //Last seen 'data_version' of configuration database (see configChanged())
+    static int personnelDataVersion;                    //Last seen 'data_version' of personnel database (see personnelChanged())
+    //
+    static std::shared_future<bool> configFuture;       //Result of asynchronously loading the configuration database (see populateAsync())
+    static std::shared_future<bool> personnelFuture;    //Result of asynchronously loading the personnel database (see populateAsync())
     //
     static std::shared_ptr<QLockFile> confLockFilePtr;  //Lock file to limit config database writing to single application instance
     static std::shared_ptr<QLockFile> persLockFilePtr;  //Lock file to limit personnel database writing to single application instance
@@ -128,11 +241,27 @@ private:
     static std::map<QString, int> settingsInt;          //Cache for integer type settings
     static std::map<QString, double> settingsDbl;       //Cache for floating-point type settings
     static std::map<QString, QString> settingsStr;      //Cache for string type settings
+    static std::atomic<uint64_t> settingsGenerationCounter; //Incremented on every change of the settings caches
+    //
+    static bool settingsWriteBehindEnabled;                     //Defer writing of settings to database (see setSettingsWriteBehind())?
+    static std::map<QString, PendingSetting> pendingSettings;   //Settings not yet written to database with setting name as key
+    static QTimer* settingsFlushTimer;                          //Timer to write deferred settings to database after some idle time
+    static constexpr int settingsFlushDelay = 1000;             //Idle time in milliseconds after which deferred settings are written
     //
     static std::map<int, Aux::Station> stationsMap;     //Cache for stations (database 'rowid' as key)
     static std::map<int, Aux::Boat> boatsMap;           //Cache for boats (database 'rowid' as key)
     //
     static std::map<int, Person> personnelMap;          //Cache for personnel (database 'rowid' as key)
+    //
+    static std::unordered_map<QString, int> personnelIdentIndex;        //Lookup index for 'personnelMap' by person identifier
+    static std::unordered_map<QString, int> personnelMmbNrIndex;        //Lookup index for 'personnelMap' by membership number
+    static std::map<std::pair<QString, QString>, std::set<int>> personnelNameIndex; //Lookup index for 'personnelMap' by
+                                                                                    //(last name, first name)
+    //
+    static std::shared_ptr<const std::vector<Person>> personnelSnapshotPtr; //Immutable copy of 'personnelMap' (replaced on change)
+    static std::atomic_bool personnelSnapshotOutdated;                      //Snapshot to be replaced on next access (see personnel())?
+    //
+    static std::shared_mutex cacheMutex;                //Reader-writer lock for all cached settings, stations, boats and personnel
 };
 
 #endif // DATABASECACHE_H
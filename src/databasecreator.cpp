@@ -29,6 +29,8 @@
 #include <QtSql/QSqlDatabase>
 #include <QtSql/QSqlQuery>
 
+#include <iostream>
+
 //Public
 
 /*!
@@ -36,7 +38,8 @@
  *
  * Uses opened configuration database connected with name "configDb".
  *
- * Sets user_version to compiled value and creates empty tables for application settings, stations and boats.
+ * Sets user_version to compiled value and creates empty tables for application settings, stations and boats
+ * as well as their indexes (see createConfigIndexes()).
  *
  * \return If successful.
  */
@@ -74,6 +77,8 @@ bool DatabaseCreator::createConfigDatabase()
                                 "HomeStation TEXT);"
                                 );
 
+    success &= createConfigIndexes();
+
     return success;
 }
 
@@ -82,7 +87,8 @@ bool DatabaseCreator::createConfigDatabase()
  *
  * Uses opened personnel database connected with name "personnelDb".
  *
- * Sets user_version to compiled value and creates empty table for personnel records.
+ * Sets user_version to compiled value and creates empty table for personnel records
+ * as well as its indexes (see createPersonnelIndexes()).
  *
  * \return If successful.
  */
@@ -101,25 +107,32 @@ bool DatabaseCreator::createPersonnelDatabase()
                                    "Status INT);"
                                    );
 
+    success &= createPersonnelIndexes();
+
     return success;
 }
 
 /*!
  * \brief Upgrade format of old configuration database to the compiled version.
  *
- * Note: Does nothing and returns false, as the configuration database version is still unchanged from the original version.
+ * Successively applies all upgrade steps from the database version to the compiled version (see runUpgradeSteps()).
+ * There are no upgrade steps for the configuration database yet.
  *
  * \return If upgrade was required and successful.
  */
 bool DatabaseCreator::upgradeConfigDatabase()
 {
-    return false;
+    if (!checkConfigVersionOlder())
+        return false;
+
+    return runUpgradeSteps("configDb", Version::ConfigDatabaseUserVersion, {});
 }
 
 /*!
  * \brief Upgrade format of old personnel database to the compiled version.
  *
- * Upgrades personnel databases from version 1 to version 2.
+ * Successively applies all upgrade steps from the database version to the compiled version (see runUpgradeSteps()):
+ * - Version 1 to version 2: Convert legacy qualifications (see upgradePersonnelV1ToV2()).
  *
  * \return If upgrade was required and successful.
  */
@@ -128,36 +141,7 @@ bool DatabaseCreator::upgradePersonnelDatabase()
     if (!checkPersonnelVersionOlder())
         return false;
 
-    if (getPersonnelVersion() == 1 && Version::PersonnelDatabaseUserVersion == 2)
-    {
-        QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
-
-        QSqlQuery personnelQuery(personnelDb);
-
-        personnelQuery.prepare("SELECT Qualifications, rowid FROM Personnel;");
-
-        if (!personnelQuery.exec())
-            return false;
-
-        QSqlQuery updateQualisQuery(personnelDb);
-
-        while (personnelQuery.next())
-        {
-            QString tNewQualis = Person::Qualifications::convertLegacyQualifications(personnelQuery.value("Qualifications").toString());
-            int tRowId = personnelQuery.value("rowid").toInt();
-
-            updateQualisQuery.prepare("UPDATE Personnel SET Qualifications=:qualis WHERE rowid=:row;");
-            updateQualisQuery.bindValue(":qualis", tNewQualis);
-            updateQualisQuery.bindValue(":row", tRowId);
-
-            if (!updateQualisQuery.exec())
-                return false;
-        }
-
-        return setPersonnelVersion(Version::PersonnelDatabaseUserVersion);
-    }
-
-    return false;
+    return runUpgradeSteps("personnelDb", Version::PersonnelDatabaseUserVersion, {{1, &DatabaseCreator::upgradePersonnelV1ToV2}});
 }
 
 //
@@ -214,8 +198,153 @@ bool DatabaseCreator::checkPersonnelVersionOlder()
     return tVersion != -1 && tVersion < Version::PersonnelDatabaseUserVersion;
 }
 
+//
+
+/*!
+ * \brief Create the indexes of the configuration database tables.
+ *
+ * Creates indexes on Application(Setting) and Stations(Location, Name), if they do not exist yet.
+ *
+ * Indexes only speed up queries and do not change the database format. Hence they are not tied to the database version
+ * but created when creating a new database and (if missing) whenever an existing database is opened for writing.
+ *
+ * \return If successful.
+ */
+bool DatabaseCreator::createConfigIndexes()
+{
+    QSqlDatabase configDb = QSqlDatabase::database("configDb");
+    QSqlQuery configQuery(configDb);
+
+    bool success = configQuery.exec("CREATE INDEX IF NOT EXISTS Application_Setting ON Application (Setting);");
+    success &= configQuery.exec("CREATE INDEX IF NOT EXISTS Stations_Location_Name ON Stations (Location, Name);");
+
+    return success;
+}
+
+/*!
+ * \brief Create the indexes of the personnel database table.
+ *
+ * Creates indexes on Personnel(MembershipNumber) and Personnel(LastName, FirstName), if they do not exist yet.
+ *
+ * See also createConfigIndexes().
+ *
+ * Note: The membership number index is not unique, since existing databases might contain duplicates
+ * (which are ignored when loading the personnel, see DatabaseCache).
+ *
+ * \return If successful.
+ */
+bool DatabaseCreator::createPersonnelIndexes()
+{
+    QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
+    QSqlQuery personnelQuery(personnelDb);
+
+    bool success = personnelQuery.exec("CREATE INDEX IF NOT EXISTS Personnel_MembershipNumber ON Personnel (MembershipNumber);");
+    success &= personnelQuery.exec("CREATE INDEX IF NOT EXISTS Personnel_LastName_FirstName ON Personnel (LastName, FirstName);");
+
+    return success;
+}
+
 //Private
 
+/*!
+ * \brief Upgrade the database to a newer version by successively applying single upgrade steps.
+ *
+ * Starting from the current 'user_version' of database connection \p pConnectionName the upgrade step
+ * for this version from \p pSteps is applied and the version incremented by one, until \p pTargetVersion is reached.
+ * Each step and its version increment are executed within a separate transaction, which is rolled back
+ * if the step fails. Hence a failed upgrade leaves the database at the last successfully reached version.
+ *
+ * \param pConnectionName Name of the database connection.
+ * \param pTargetVersion Version to upgrade to.
+ * \param pSteps Upgrade steps (mapping the version they upgrade from to the step function).
+ * \return If the database was older than \p pTargetVersion and all required steps were successful.
+ */
+bool DatabaseCreator::runUpgradeSteps(const QString& pConnectionName, const int pTargetVersion,
+                                      const std::map<int, bool (*)()>& pSteps)
+{
+    QSqlDatabase database = QSqlDatabase::database(pConnectionName);
+
+    int tVersion = getUserVersion(pConnectionName);
+
+    if (tVersion == -1 || tVersion >= pTargetVersion)
+        return false;
+
+    while (tVersion < pTargetVersion)
+    {
+        auto it = pSteps.find(tVersion);
+        if (it == pSteps.end())
+        {
+            std::cerr<<"ERROR: No database upgrade available from version "<<tVersion<<"!"<<std::endl;
+            return false;
+        }
+
+        if (!database.transaction())
+        {
+            std::cerr<<"ERROR: Could not start database transaction!"<<std::endl;
+            return false;
+        }
+
+        if (!(it->second)() || !setUserVersion(pConnectionName, tVersion + 1))
+        {
+            std::cerr<<"ERROR: Could not upgrade database from version "<<tVersion<<"!"<<std::endl;
+            database.rollback();
+            return false;
+        }
+
+        if (!database.commit())
+        {
+            std::cerr<<"ERROR: Could not commit database transaction!"<<std::endl;
+            database.rollback();
+            return false;
+        }
+
+        ++tVersion;
+    }
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Upgrade personnel database from version 1 to version 2.
+ *
+ * Converts the qualifications of all persons from the legacy format (see Person::Qualifications::convertLegacyQualifications()).
+ *
+ * \return If successful.
+ */
+bool DatabaseCreator::upgradePersonnelV1ToV2()
+{
+    QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
+
+    QSqlQuery personnelQuery(personnelDb);
+
+    personnelQuery.prepare("SELECT Qualifications, rowid FROM Personnel;");
+
+    if (!personnelQuery.exec())
+        return false;
+
+    QSqlQuery updateQualisQuery(personnelDb);
+
+    updateQualisQuery.prepare("UPDATE Personnel SET Qualifications=:qualis WHERE rowid=:row;");
+
+    while (personnelQuery.next())
+    {
+        QString tNewQualis = Person::Qualifications::convertLegacyQualifications(personnelQuery.value("Qualifications").toString());
+        int tRowId = personnelQuery.value("rowid").toInt();
+
+        updateQualisQuery.bindValue(":qualis", tNewQualis);
+        updateQualisQuery.bindValue(":row", tRowId);
+
+        if (!updateQualisQuery.exec())
+            return false;
+    }
+
+    return true;
+}
+
+//
+
 /*!
  * \brief Read the configuration database version.
  *
@@ -223,13 +352,7 @@ bool DatabaseCreator::checkPersonnelVersionOlder()
  */
 int DatabaseCreator::getConfigVersion()
 {
-    QSqlDatabase configDb = QSqlDatabase::database("configDb");
-    QSqlQuery configQuery(configDb);
-
-    if (configQuery.exec("PRAGMA user_version;") && configQuery.next())
-        return configQuery.value("user_version").toInt();
-    else
-        return -1;
+    return getUserVersion("configDb");
 }
 
 /*!
@@ -240,10 +363,7 @@ int DatabaseCreator::getConfigVersion()
  */
 bool DatabaseCreator::setConfigVersion(const int pVersion)
 {
-    QSqlDatabase configDb = QSqlDatabase::database("configDb");
-    QSqlQuery configQuery(configDb);
-
-    return configQuery.exec("PRAGMA user_version = " + QString::number(pVersion) + ";");
+    return setUserVersion("configDb", pVersion);
 }
 
 /*!
@@ -253,13 +373,7 @@ bool DatabaseCreator::setConfigVersion(const int pVersion)
  */
 int DatabaseCreator::getPersonnelVersion()
 {
-    QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
-    QSqlQuery personnelQuery(personnelDb);
-
-    if (personnelQuery.exec("PRAGMA user_version;") && personnelQuery.next())
-        return personnelQuery.value("user_version").toInt();
-    else
-        return -1;
+    return getUserVersion("personnelDb");
 }
 
 /*!
@@ -270,8 +384,37 @@ int DatabaseCreator::getPersonnelVersion()
  */
 bool DatabaseCreator::setPersonnelVersion(const int pVersion)
 {
-    QSqlDatabase personnelDb = QSqlDatabase::database("personnelDb");
-    QSqlQuery personnelQuery(personnelDb);
+    return setUserVersion("personnelDb", pVersion);
+}
+
+/*!
+ * \brief Read a database version.
+ *
+ * \param pConnectionName Name of the database connection.
+ * \return Database's 'user_version', if query successful, and -1 otherwise.
+ */
+int DatabaseCreator::getUserVersion(const QString& pConnectionName)
+{
+    QSqlDatabase database = QSqlDatabase::database(pConnectionName);
+    QSqlQuery query(database);
+
+    if (query.exec("PRAGMA user_version;") && query.next())
+        return query.value("user_version").toInt();
+    else
+        return -1;
+}
+
+/*!
+ * \brief Write a database version.
+ *
+ * \param pConnectionName Name of the database connection.
+ * \param pVersion New value for database's 'user_version'.
+ * \return If successful.
+ */
+bool DatabaseCreator::setUserVersion(const QString& pConnectionName, const int pVersion)
+{
+    QSqlDatabase database = QSqlDatabase::database(pConnectionName);
+    QSqlQuery query(database);
 
-    return personnelQuery.exec("PRAGMA user_version = " + QString::number(pVersion) + ";");
+    return query.exec("PRAGMA user_version = " + QString::number(pVersion) + ";");
 }
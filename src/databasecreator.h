@@ -23,6 +23,10 @@
 #ifndef DATABASECREATOR_H
 #define DATABASECREATOR_H
 
+#include <QString>
+
+#include <map>
+
 /*!
  * \brief Basic database handling.
  *
@@ -30,6 +34,9 @@
  * and check existing database versions (checkConfigVersion(), checkPersonnelVersion()). If databases use incompatible
  * formats from older software versions (checkConfigVersionOlder(), checkPersonnelVersionOlder()) it might be possible
  * to convert their format to the current version via upgradeConfigDatabase() and upgradePersonnelDatabase().
+ * Such upgrades are performed step by step from one version to the next, each step within its own transaction.
+ * Table indexes are not part of the versioned format and can be added to existing databases at any time
+ * (see createConfigIndexes(), createPersonnelIndexes()).
  *
  * Note: Database connections with names "configDb" and "personnelDb" must
  * already exist and these databases must be opened before using this class.
@@ -48,12 +55,23 @@ public:
     static bool checkPersonnelVersion();            ///< Check if the personnel database version matches the compiled version.
     static bool checkConfigVersionOlder();          ///< Check if the configuration database version is older than the compiled version.
     static bool checkPersonnelVersionOlder();       ///< Check if the personnel database version is older than the compiled version.
+    //
+    static bool createConfigIndexes();              ///< Create the indexes of the configuration database tables.
+    static bool createPersonnelIndexes();           ///< Create the indexes of the personnel database table.
 
 private:
+    static bool runUpgradeSteps(const QString& pConnectionName, int pTargetVersion,
+                                const std::map<int, bool (*)()>& pSteps);   ///< \brief Upgrade the database to a newer version
+                                                                            ///  by successively applying single upgrade steps.
+    //
+    static bool upgradePersonnelV1ToV2();           ///< Upgrade personnel database from version 1 to version 2.
+    //
     static int getConfigVersion();                  ///< Read the configuration database version.
     static bool setConfigVersion(int pVersion);     ///< Write the configuration database version.
     static int getPersonnelVersion();               ///< Read the personnel database version.
     static bool setPersonnelVersion(int pVersion);  ///< Write the personnel database version.
+    static int getUserVersion(const QString& pConnectionName);                  ///< Read a database version.
+    static bool setUserVersion(const QString& pConnectionName, int pVersion);   ///< Write a database version.
 };
 
 #endif // DATABASECREATOR_H
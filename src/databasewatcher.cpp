@@ -0,0 +1,129 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "databasewatcher.h"
+
+#include "databasecache.h"
+
+#include <iostream>
+
+//Initialize static class members
+
+DatabaseWatcher* DatabaseWatcher::instancePtr = nullptr;
+
+//Public
+
+/*!
+ * \brief Constructor.
+ *
+ * Registers the watcher as the instance returned by instance().
+ *
+ * \param pParent The parent object.
+ */
+DatabaseWatcher::DatabaseWatcher(QObject *const pParent) :
+    QObject(pParent)
+{
+    connect(&checkTimer, &QTimer::timeout, this, &DatabaseWatcher::on_checkTimerTimeout);
+
+    instancePtr = this;
+}
+
+/*!
+ * \brief Destructor.
+ */
+DatabaseWatcher::~DatabaseWatcher()
+{
+    if (instancePtr == this)
+        instancePtr = nullptr;
+}
+
+//
+
+/*!
+ * \brief Get the existing watcher instance.
+ *
+ * \return Pointer to the most recently constructed watcher or nullptr, if there is none.
+ */
+DatabaseWatcher* DatabaseWatcher::instance()
+{
+    return instancePtr;
+}
+
+//
+
+/*!
+ * \brief Start checking for database changes periodically.
+ *
+ * \param pInterval Interval between checks in milliseconds.
+ */
+void DatabaseWatcher::start(const int pInterval)
+{
+    checkTimer.start(pInterval);
+}
+
+/*!
+ * \brief Stop checking for database changes.
+ */
+void DatabaseWatcher::stop()
+{
+    checkTimer.stop();
+}
+
+/*!
+ * \brief Check for database changes immediately.
+ *
+ * Re-loads the configuration and/or personnel cache, if the corresponding database was changed
+ * by another connection, and emits configChanged() and/or personnelChanged() afterwards.
+ * Parts of the cache that are still being loaded asynchronously are not checked.
+ */
+void DatabaseWatcher::checkNow()
+{
+    //Cache might still be filled in the background (see DatabaseCache::populateAsync())
+
+    if (DatabaseCache::isConfigReady() && DatabaseCache::configChanged())
+    {
+        if (!DatabaseCache::reloadConfig())
+            std::cerr<<"ERROR: Could not re-load changed configuration database!"<<std::endl;
+
+        emit configChanged();
+    }
+
+    if (DatabaseCache::isPersonnelReady() && DatabaseCache::personnelChanged())
+    {
+        if (!DatabaseCache::reloadPersonnel())
+            std::cerr<<"ERROR: Could not re-load changed personnel database!"<<std::endl;
+
+        emit personnelChanged();
+    }
+}
+
+//Private slots
+
+/*!
+ * \brief Check for database changes.
+ *
+ * See checkNow().
+ */
+void DatabaseWatcher::on_checkTimerTimeout()
+{
+    checkNow();
+}
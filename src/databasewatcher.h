@@ -0,0 +1,68 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef DATABASEWATCHER_H
+#define DATABASEWATCHER_H
+
+#include <QObject>
+#include <QTimer>
+
+/*!
+ * \brief Detect database changes made by other program instances and keep the DatabaseCache up to date.
+ *
+ * Periodically checks whether the configuration or personnel database was changed by another connection
+ * (see DatabaseCache::configChanged() and DatabaseCache::personnelChanged()). If so, only the affected part
+ * of the cache is re-loaded (see DatabaseCache::reloadConfig() and DatabaseCache::reloadPersonnel()) and
+ * configChanged() or personnelChanged() is emitted, respectively, such that open windows and dialogs
+ * can update their displayed data. SettingsCache reads from DatabaseCache and is hence updated as well.
+ *
+ * A single watcher should be created in the main thread after populating the DatabaseCache. It can then
+ * be accessed via instance() in order to subscribe to its signals. Checking starts with start().
+ */
+class DatabaseWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DatabaseWatcher(QObject* pParent = nullptr);   ///< Constructor.
+    ~DatabaseWatcher();                                     ///< Destructor.
+    //
+    static DatabaseWatcher* instance();     ///< Get the existing watcher instance.
+    //
+    void start(int pInterval = 2000);       ///< Start checking for database changes periodically.
+    void stop();                            ///< Stop checking for database changes.
+    void checkNow();                        ///< Check for database changes immediately.
+
+private slots:
+    void on_checkTimerTimeout();            ///< Check for database changes.
+
+signals:
+    void configChanged();       ///< Signal emitted after re-loading the configuration cache due to external changes.
+    void personnelChanged();    ///< Signal emitted after re-loading the personnel cache due to external changes.
+
+private:
+    QTimer checkTimer;                  //Timer for periodic checks
+    //
+    static DatabaseWatcher* instancePtr;    //Existing watcher instance
+};
+
+#endif // DATABASEWATCHER_H
@@ -20,12 +20,17 @@
 /////////////////////////////////////////////////////////////////////////////////////////
 */
 
+#include "batchexporter.h"
+#include "carryoverfixer.h"
+#include "commandlineinterface.h"
 #include "databasecache.h"
 #include "databasecreator.h"
-#include "pdfexporter.h"
-#include "report.h"
+#include "databasewatcher.h"
+#include "paralleljobs.h"
+#include "reportarchiveindex.h"
 #include "settingscache.h"
 #include "singleinstancesynchronizer.h"
+#include "startupprofiler.h"
 #include "startupwindow.h"
 
 #include <QApplication>
@@ -36,6 +41,7 @@
 #include <QIcon>
 #include <QLockFile>
 #include <QMessageBox>
+#include <QProgressDialog>
 #include <QStandardPaths>
 #include <QString>
 #include <QStringList>
@@ -43,13 +49,24 @@
 #include <QTranslator>
 #include <QtSql/QSqlDatabase>
 
-#include <atomic>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
-#include <thread>
+#include <vector>
 
 int main(int argc, char *argv[])
 {
+    //Run batch operations without graphical user interface, if requested (see CommandLineInterface)
+    if (CommandLineInterface::isRequested(argc, argv))
+        return CommandLineInterface::run(argc, argv);
+
+    //Profile startup phases, if requested by environment variable (see StartupProfiler);
+    //make sure the profile is also written when returning early (errors, batch operations)
+    StartupProfiler::init();
+    const StartupProfiler::ScopedWriter tStartupProfileWriter;
+
+    StartupProfiler::beginPhase("Application setup");
+
     //Create Qt application
     QApplication a(argc, argv);
 
@@ -69,6 +86,8 @@ int main(int argc, char *argv[])
         std::cerr<<"WARNING: Could not load translations!"<<std::endl;
     }
 
+    StartupProfiler::beginPhase("Configuration directory");
+
     //Create application configuration directory at OS specific path if it does not exist
 
     QStringList standardPaths = QStandardPaths::standardLocations(QStandardPaths::AppConfigLocation);
@@ -235,6 +254,8 @@ int main(int argc, char *argv[])
         }
     }
 
+    StartupProfiler::beginPhase("Open databases");
+
     //Open general configuration and personnel databases from configuration directory
 
     QSqlDatabase confDatabase = QSqlDatabase::addDatabase("QSQLITE", "configDb");
@@ -264,6 +285,10 @@ int main(int argc, char *argv[])
         return EXIT_FAILURE;
     }
 
+    //Open index of known report files next to configuration database (only a cache, so just continue without it on failure)
+    if (!ReportArchiveIndex::open(configDir.filePath("archive.sqlite3")))
+        std::cerr<<"WARNING: Could not open report archive index!"<<std::endl;
+
     //Acquire database lock file (to avoid writing to database from multiple application instances)
     QString lockFileName = configDir.filePath("db.lock");
     std::shared_ptr<QLockFile> lockFilePtr = std::make_shared<QLockFile>(lockFileName);
@@ -282,6 +307,8 @@ int main(int argc, char *argv[])
         lockFilePtr2->tryLock(1000);
     }
 
+    StartupProfiler::beginPhase("Create databases");
+
     //Set up fresh databases if they do not exist
 
     if (!confDbExists)
@@ -314,6 +341,8 @@ int main(int argc, char *argv[])
         }
     }
 
+    StartupProfiler::beginPhase("Check database versions");
+
     //Check if database versions are supported, upgrade them if necessary
 
     if (!DatabaseCreator::checkConfigVersion())
@@ -383,25 +412,77 @@ int main(int argc, char *argv[])
             return EXIT_FAILURE;
     }
 
-    //Cache database entries
-    if (!DatabaseCache::populate(lockFilePtr, lockFilePtr2) || !SettingsCache::populate(lockFilePtr, lockFilePtr2))
+    //Add table indexes missing in databases created by older versions (only speed up queries, so just continue on failure);
+    //if the lock files are held by another instance, this is done below after possibly enabling concurrent access
+
+    if (lockFilePtr->isLocked() && !DatabaseCreator::createConfigIndexes())
+        std::cerr<<"WARNING: Could not create configuration database indexes!"<<std::endl;
+
+    if (lockFilePtr2->isLocked() && !DatabaseCreator::createPersonnelIndexes())
+        std::cerr<<"WARNING: Could not create personnel database indexes!"<<std::endl;
+
+    StartupProfiler::beginPhase("Populate configuration cache");
+
+    //Cache database entries; both databases are loaded in parallel in the background, but only the (small) configuration
+    //database is needed immediately (settings below); personnel is waited for only when actually needed (see StartupWindow)
+
+    //Compare incrementally updated personnel cache with database after each change, if requested (expensive, for testing)
+    const char* tEnvVerifyPersonnel = std::getenv("WACHDIENST_MANAGER_VERIFY_PERSONNEL");
+    if (tEnvVerifyPersonnel != nullptr && QString(tEnvVerifyPersonnel).trimmed() == "1")
+        DatabaseCache::setPersonnelVerification(true);
+
+    DatabaseCache::populateAsync(lockFilePtr, lockFilePtr2);
+
+    if (!DatabaseCache::waitForConfig() || !SettingsCache::populate(lockFilePtr, lockFilePtr2))
     {
         std::cerr<<"ERROR: Could not cache database entries!"<<std::endl;
         QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Füllen des Datenbank-Caches!").exec();
         return EXIT_FAILURE;
     }
 
+    StartupProfiler::beginPhase("Database access setup");
+
+    //Allow writing to the databases from multiple application instances at the same time, if enabled
+    //(waits for the personnel being loaded, if the journal mode needs to be changed, see DatabaseCache::setConcurrentAccess())
+
+    const bool concurrentAccess = SettingsCache::getBoolSetting(SettingsCache::IntSetting::_DATABASE_CONCURRENT_ACCESS);
+    const bool concurrentAccessSet = DatabaseCache::setConcurrentAccess(concurrentAccess);
+
+    if (!concurrentAccessSet)
+    {
+        std::cerr<<"WARNING: Could not enable concurrent database access!"<<std::endl;
+        QMessageBox(QMessageBox::Warning, "Warnung", "Gleichzeitiger Datenbank-Zugriff konnte nicht aktiviert werden!").exec();
+    }
+
+    //With concurrent access the databases are writable without holding the lock files, so add missing indexes now
+    //(see above); in WAL mode this does not conflict with the personnel possibly still being loaded in the background
+
+    if (concurrentAccess && concurrentAccessSet)
+    {
+        if (!lockFilePtr->isLocked() && !DatabaseCreator::createConfigIndexes())
+            std::cerr<<"WARNING: Could not create configuration database indexes!"<<std::endl;
+
+        if (!lockFilePtr2->isLocked() && !DatabaseCreator::createPersonnelIndexes())
+            std::cerr<<"WARNING: Could not create personnel database indexes!"<<std::endl;
+    }
+
+    //Keep database cache up to date with database changes from other application instances
+    DatabaseWatcher databaseWatcher;
+    databaseWatcher.start();
+
     //Start file dialogs in configured default directory
-    QString defaultFileDir = SettingsCache::getStrSetting("app_default_fileDialogDir");
+    QString defaultFileDir = SettingsCache::getStrSetting(SettingsCache::StrSetting::_DEFAULT_FILE_DIALOG_DIR);
     if (defaultFileDir != "" && QDir().cd(defaultFileDir))
     {
         QFileDialog fileDialog;
         fileDialog.setDirectory(defaultFileDir);
     }
 
+    StartupProfiler::beginPhase("Single instance synchronizer");
+
     //Determine whether to run in single instance mode and, if so, whether to proceed in "master" or "slave" mode
 
-    bool singleInstance = SettingsCache::getBoolSetting("app_singleInstance");
+    bool singleInstance = SettingsCache::getBoolSetting(SettingsCache::IntSetting::_SINGLE_INSTANCE);
 
     if (singleInstance && !SingleInstanceSynchronizer::init())
     {
@@ -415,22 +496,21 @@ int main(int argc, char *argv[])
 
     const bool singleInstanceMaster = singleInstance && SingleInstanceSynchronizer::isMaster();
 
+    StartupProfiler::beginPhase("Startup window construction");
+
     //Create main window
     StartupWindow startupWindow;
 
-    //In single instance "master" mode run a listener thread to receive requests from "slave" instances
-
-    std::thread masterListenerThread;
-    std::atomic_bool stopListenerThread(false);
+    //In single instance "master" mode receive requests from "slave" instances (processed by the event loop)
 
-    if (singleInstance && singleInstanceMaster)
+    if (singleInstance && singleInstanceMaster && !SingleInstanceSynchronizer::listen(startupWindow))
     {
-        masterListenerThread = std::thread([&startupWindow, &stopListenerThread]() -> void
-                                           {
-                                               SingleInstanceSynchronizer::listen(startupWindow, stopListenerThread);
-                                           });
+        std::cerr<<"ERROR: Could not listen for requests from other application instances!"<<std::endl;
+        QMessageBox(QMessageBox::Warning, "Warnung", "Anfragen anderer Programm-Instanzen können nicht empfangen werden!").exec();
     }
 
+    StartupProfiler::beginPhase("Command line handling");
+
     //Start application in different ways depending on command line arguments; if running in single instance "slave" mode then
     //just forward corresponding requests to running "master" instance and exit (except in case of "-E" or "-F" options!)
 
@@ -483,25 +563,52 @@ int main(int argc, char *argv[])
             return EXIT_FAILURE;
         }
 
+        //Below batch operations need the complete database cache
+        if (!DatabaseCache::waitForPersonnel())
+        {
+            std::cerr<<"ERROR: Could not cache database entries!"<<std::endl;
+            QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Füllen des Datenbank-Caches!").exec();
+            return EXIT_FAILURE;
+        }
+
         QStringList fileNames(cmdArgs.begin()+2, cmdArgs.end());
 
-        if (cmdArg1 == "-E")    //Automatically iterate file list and load and export each report to PDF (replacing extension with .pdf)
+        if (cmdArg1 == "-E")    //Automatically load and export each report of file list to PDF in parallel (replacing extension with .pdf)
         {
             //As following instructions may take some time but the program will exit afterwards, try to detach instance already
-            //now and stop listener thread if "master"; hence neither any "slave" requests will be processed by this instance
+            //now (also stops listening if "master"); hence neither any "slave" requests will be processed by this instance
             //nor this instance, if "slave", will be accidentally recognized as "master" by new other instances
             if (singleInstance)
+                SingleInstanceSynchronizer::detach();
+
+            //Optionally limit number of parallel export jobs via "-j<N>" before the file list; use number of cores by default
+
+            int exportJobs = ParallelJobs::defaultJobCount();
+
+            if (fileNames.front().startsWith("-j"))
             {
-                if (singleInstanceMaster)
+                bool tOk = false;
+                exportJobs = fileNames.front().mid(2).toInt(&tOk);
+
+                if (!tOk || exportJobs < 1)
                 {
-                    stopListenerThread.store(true);
-                    masterListenerThread.join();
+                    std::cerr<<"ERROR: Invalid number of export jobs!"<<std::endl;
+                    QMessageBox(QMessageBox::Critical, "Fehler", "Ungültige Anzahl paralleler Exporte!").exec();
+                    return EXIT_FAILURE;
                 }
-                SingleInstanceSynchronizer::detach();
+
+                fileNames.pop_front();
+            }
+
+            if (fileNames.isEmpty())
+            {
+                std::cerr<<"WARNING: Nothing to be done!"<<std::endl;
+                QMessageBox(QMessageBox::Warning, "Warnung", "Es gibt nichts zu tun!").exec();
+                return EXIT_SUCCESS;
             }
 
             QMessageBox msgBox(QMessageBox::Question, "Alle exportieren?",
-                               "Alle angegebenen Wachberichte (siehe Details) werden nacheinander geladen und als PDF exportiert. "
+                               "Alle angegebenen Wachberichte (siehe Details) werden geladen und als PDF exportiert. "
                                "Dazu wird jeweils die Dateiendung des Wachberichtes durch \".pdf\" ersetzt. Bestehende Dateien "
                                "werden ohne weiteres Nachfragen überschrieben. Fortfahren?", QMessageBox::Abort | QMessageBox::Yes);
 
@@ -517,47 +624,71 @@ int main(int argc, char *argv[])
             if (msgBox.exec() != QMessageBox::Yes)
                 return EXIT_SUCCESS;
 
-            Report report;
+            QProgressDialog progressDialog("Exportiere Wachberichte...", "Abbrechen", 0, fileNames.size());
+            progressDialog.setWindowModality(Qt::ApplicationModal);
+            progressDialog.setMinimumDuration(500);
 
-            for (const QString& tFileName : fileNames)
+            auto tProgress = [&progressDialog](int pDone, int pTotal) -> bool
             {
-                if (!report.open(tFileName))
-                {
-                    std::cerr<<"ERROR: Could not load report \""<<tFileName.toStdString()<<"\"!"<<std::endl;
-                    QMessageBox(QMessageBox::Critical, "Fehler", "Konnte Wachbericht \"" + tFileName + "\" nicht laden!").exec();
-                    return EXIT_FAILURE;
-                }
+                progressDialog.setLabelText(QString("Exportiere Wachberichte... (%1 von %2)").arg(pDone).arg(pTotal));
+                progressDialog.setValue(pDone);
+                QApplication::processEvents();
 
-                QFileInfo fileInfo(tFileName);
-                QString pdfFileName = fileInfo.path() + "/" + fileInfo.completeBaseName() + ".pdf";
+                return !progressDialog.wasCanceled();
+            };
 
-                if (!PDFExporter::exportPDF(report, pdfFileName))
-                {
-                    std::cerr<<"ERROR: Could not export report to \""<<pdfFileName.toStdString()<<"\"!"<<std::endl;
-                    QMessageBox(QMessageBox::Critical, "Fehler",
-                                                       "Konnte Wachbericht nicht nach \"" + pdfFileName + "\" exportieren!").exec();
-                    return EXIT_FAILURE;
-                }
+            QStringList exportErrors;
+
+            bool exportSuccess = BatchExporter::exportReports(fileNames, exportJobs, exportErrors, tProgress);
+
+            progressDialog.reset();
+
+            if (!exportSuccess)
+            {
+                QMessageBox msgBox2(QMessageBox::Warning, "Exportieren fehlgeschlagen",
+                                    "Es konnten nicht alle Wachberichte exportiert werden! Siehe Details.");
+                msgBox2.setDetailedText(exportErrors.join('\n'));
+                msgBox2.exec();
+
+                return EXIT_FAILURE;
             }
 
             QMessageBox(QMessageBox::Information, "Exportieren erfolgreich", "Es wurden alle Wachberichte exportiert!").exec();
 
             return EXIT_SUCCESS;
         }
-        else if (cmdArg1 == "-F")   //Iteratively fix all carryovers by loading first report from file list, applying its carryovers to
-        {                           //second report and saving second report; then applying its carryovers to third report and so forth
+        else if (cmdArg1 == "-F")   //Fix all carryovers by applying carryovers of first report from file list to second report,
+        {                           //then applying (corrected) carryovers of second report to third report and so forth
 
             //As following instructions may take some time but the program will exit afterwards, try to detach instance already
-            //now and stop listener thread if "master"; hence neither any "slave" requests will be processed by this instance
+            //now (also stops listening if "master"); hence neither any "slave" requests will be processed by this instance
             //nor this instance, if "slave", will be accidentally recognized as "master" by new other instances
             if (singleInstance)
+                SingleInstanceSynchronizer::detach();
+
+            //Optionally limit number of parallel jobs via "-j<N>" and/or only show changes via "-d" (dry run) before the file list
+
+            int fixJobs = ParallelJobs::defaultJobCount();
+            bool dryRun = false;
+
+            while (!fileNames.isEmpty() && (fileNames.front().startsWith("-j") || fileNames.front() == "-d"))
             {
-                if (singleInstanceMaster)
+                if (fileNames.front() == "-d")
+                    dryRun = true;
+                else
                 {
-                    stopListenerThread.store(true);
-                    masterListenerThread.join();
+                    bool tOk = false;
+                    fixJobs = fileNames.front().mid(2).toInt(&tOk);
+
+                    if (!tOk || fixJobs < 1)
+                    {
+                        std::cerr<<"ERROR: Invalid number of jobs!"<<std::endl;
+                        QMessageBox(QMessageBox::Critical, "Fehler", "Ungültige Anzahl paralleler Vorgänge!").exec();
+                        return EXIT_FAILURE;
+                    }
                 }
-                SingleInstanceSynchronizer::detach();
+
+                fileNames.pop_front();
             }
 
             if (fileNames.size() < 2)
@@ -567,63 +698,118 @@ int main(int argc, char *argv[])
                 return EXIT_SUCCESS;
             }
 
-            QMessageBox msgBox(QMessageBox::Question, "Alle korrigieren?",
-                               "Alle angegebenen Wachberichte (siehe Details) werden nacheinander geladen und nach Korrektur der "
-                               "Überträge mittels des jeweils vorherigen Wachberichtes wieder unter demselben Dateinamen gespeichert. "
-                               "Der erste Wachbericht bleibt unverändert. Die bestehenden Dateien werden ohne weiteres Nachfragen "
-                               "überschrieben.  Fortfahren?", QMessageBox::Abort | QMessageBox::Yes);
+            if (!dryRun)
+            {
+                QMessageBox msgBox(QMessageBox::Question, "Alle korrigieren?",
+                                   "Alle angegebenen Wachberichte (siehe Details) werden geladen und die Überträge mittels des "
+                                   "jeweils vorherigen Wachberichtes korrigiert. Wachberichte mit geänderten Überträgen werden "
+                                   "wieder unter demselben Dateinamen gespeichert. Der erste Wachbericht bleibt unverändert. "
+                                   "Die bestehenden Dateien werden ohne weiteres Nachfragen überschrieben.  Fortfahren?",
+                                   QMessageBox::Abort | QMessageBox::Yes);
 
-            QString detailedText  = "Für die folgenden Wachberichte werden in angegebener Reihenfolge die Überträge korrigiert:";
+                QString detailedText  = "Für die folgenden Wachberichte werden in angegebener Reihenfolge die Überträge korrigiert:";
 
-            for (const QString& tFileName : fileNames)
-                detailedText.append("\n- \"" + tFileName + "\"");
+                for (const QString& tFileName : fileNames)
+                    detailedText.append("\n- \"" + tFileName + "\"");
 
-            msgBox.setDetailedText(detailedText);
+                msgBox.setDetailedText(detailedText);
 
-            msgBox.setDefaultButton(QMessageBox::Abort);
+                msgBox.setDefaultButton(QMessageBox::Abort);
 
-            if (msgBox.exec() != QMessageBox::Yes)
-                return EXIT_SUCCESS;
+                if (msgBox.exec() != QMessageBox::Yes)
+                    return EXIT_SUCCESS;
+            }
+
+            QProgressDialog progressDialog("Korrigiere Überträge...", "Abbrechen", 0, fileNames.size());
+            progressDialog.setWindowModality(Qt::ApplicationModal);
+            progressDialog.setMinimumDuration(500);
+
+            auto tProgress = [&progressDialog](int pDone, int pTotal) -> bool
+            {
+                progressDialog.setMaximum(pTotal);
+                progressDialog.setValue(pDone);
+                QApplication::processEvents();
 
-            QStringList correctedFiles;
+                return !progressDialog.wasCanceled();
+            };
 
-            Report firstReport, secondReport;
+            std::vector<CarryoverFixer::Change> changes;
+            int unchanged = 0;
+            QStringList fixErrors;
 
-            if (!secondReport.open(fileNames[0]))
+            bool fixSuccess = CarryoverFixer::fixCarryovers(fileNames, fixJobs, dryRun, changes, unchanged, fixErrors, tProgress);
+
+            progressDialog.reset();
+
+            //Refresh report archive index entries of all rewritten reports
+            if (!dryRun)
             {
-                std::cerr<<"ERROR: Could not load report \""<<fileNames[0].toStdString()<<"\"!"<<std::endl;
-                QMessageBox(QMessageBox::Critical, "Fehler", "Konnte Wachbericht \"" + fileNames[0] + "\" nicht laden!").exec();
-                return EXIT_FAILURE;
+                QStringList changedFiles;
+                QStringList indexErrors;
+
+                for (const CarryoverFixer::Change& tChange : changes)
+                    changedFiles.append(tChange.fileName);
+
+                ReportArchiveIndex::update(changedFiles, indexErrors, fixJobs);
+
+                if (!indexErrors.isEmpty())
+                {
+                    fixErrors.append(indexErrors);
+                    fixSuccess = false;
+                }
             }
 
-            for (int i = 1; i < fileNames.size(); ++i)
+            const QString unchangedText = "Anzahl unveränderter Wachberichte: " + QString::number(unchanged);
+
+            QString changesText;
+
+            for (const CarryoverFixer::Change& tChange : changes)
+            {
+                changesText.append("\n- \"" + tChange.fileName + "\"");
+
+                for (const QString& tLine : CarryoverFixer::describeChange(tChange))
+                    changesText.append("\n    " + tLine);
+            }
+
+            if (!fixSuccess)
             {
-                firstReport = secondReport;
+                QMessageBox msgBox2(QMessageBox::Warning, "Korrektur fehlgeschlagen",
+                                    "Es konnten nicht alle Wachberichte korrigiert werden! Siehe Details.");
 
-                if (!secondReport.open(fileNames[i]))
+                QString detailedText2 = fixErrors.join('\n');
+
+                if (!changes.empty())
                 {
-                    std::cerr<<"ERROR: Could not load report \""<<fileNames[i].toStdString()<<"\"!"<<std::endl;
-                    QMessageBox(QMessageBox::Critical, "Fehler", "Konnte Wachbericht \"" + fileNames[i] + "\" nicht laden!").exec();
-                    return EXIT_FAILURE;
+                    detailedText2.append(dryRun ? "\n\nBei den folgenden Wachberichten wären Überträge zu korrigieren:" :
+                                                  "\n\nBei den folgenden Wachberichten wurden Überträge korrigiert:");
+                    detailedText2.append(changesText);
                 }
 
-                if (secondReport.loadCarryovers(firstReport))
-                {
-                    correctedFiles.append(fileNames[i]);
+                detailedText2.append("\n\n" + unchangedText);
 
-                    if (!secondReport.save(secondReport.getFileName()))
-                    {
-                        std::cerr<<"ERROR: Could not save report \""<<secondReport.getFileName().toStdString()<<"\"!"<<std::endl;
-                        QMessageBox(QMessageBox::Critical,
-                                    "Fehler", "Konnte Wachbericht \"" + secondReport.getFileName() + "\" nicht speichern!").exec();
-                        return EXIT_FAILURE;
-                    }
-                }
+                msgBox2.setDetailedText(detailedText2);
+                msgBox2.exec();
+
+                return EXIT_FAILURE;
             }
 
-            if (correctedFiles.isEmpty())
+            if (changes.empty())
+            {
+                QMessageBox msgBox2(QMessageBox::Information, "Korrektur beendet", "Es waren keine Korrekturen erforderlich!");
+
+                msgBox2.setDetailedText(unchangedText);
+
+                msgBox2.exec();
+            }
+            else if (dryRun)
             {
-                QMessageBox(QMessageBox::Information, "Korrektur beendet", "Es waren keine Korrekturen erforderlich!").exec();
+                QMessageBox msgBox2(QMessageBox::Information, "Prüfung beendet",
+                                    "Es sind Überträge zu korrigieren! Dies betrifft alle unter Details angegebenen Wachberichte. "
+                                    "Es wurden keine Dateien verändert.");
+
+                msgBox2.setDetailedText("Bei den folgenden Wachberichten wären Überträge zu korrigieren:" + changesText + "\n\n" + unchangedText);
+
+                msgBox2.exec();
             }
             else
             {
@@ -631,12 +817,7 @@ int main(int argc, char *argv[])
                                    "Es wurden Überträge korrigiert! Dies betrifft alle unter Details angegebenen Wachberichte. "
                                    "Hinweis: Für diese ist ein erneuter Export erforderlich.");
 
-                QString detailedText2  = "Bei den folgenden Wachberichten wurden Überträge korrigiert:";
-
-                for (const QString& tFileName : correctedFiles)
-                    detailedText2.append("\n- \"" + tFileName + "\"");
-
-                msgBox2.setDetailedText(detailedText2);
+                msgBox2.setDetailedText("Bei den folgenden Wachberichten wurden Überträge korrigiert:" + changesText + "\n\n" + unchangedText);
 
                 msgBox2.exec();
             }
@@ -650,10 +831,7 @@ int main(int argc, char *argv[])
             //Assume each file exists and is saved report; open each report and show them in individual report windows
 
             if (singleInstance && !singleInstanceMaster)
-            {
-                for (const QString& tFileName : fileNames)
-                    SingleInstanceSynchronizer::sendOpenReport(tFileName);
-            }
+                SingleInstanceSynchronizer::sendOpenReports(fileNames);
             else
             {
                 bool allFailed = true;
@@ -676,14 +854,17 @@ int main(int argc, char *argv[])
     }
 
     //Wait for application being exited and return; in single instance "master" mode additionally
-    //stop the listener thread again; in single instance "slave" mode, instead, exit immediately
+    //stop listening again; in single instance "slave" mode, instead, exit immediately
+
+    //Write startup profile once the first event loop iteration (showing windows etc.) is done, if profiling is enabled
+    if (!singleInstance || singleInstanceMaster)
+        StartupProfiler::writeWhenIdle();
 
     if (singleInstance && singleInstanceMaster)
     {
         int exitCode = a.exec();
 
-        stopListenerThread.store(true);
-        masterListenerThread.join();
+        SingleInstanceSynchronizer::detach();
 
         return exitCode;
     }
@@ -0,0 +1,236 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "namecompletionindex.h"
+
+#include "databasecache.h"
+
+#include <algorithm>
+
+//Initialize static class members
+
+std::mutex NameCompletionIndex::currentMutex;
+std::shared_ptr<const std::vector<Person>> NameCompletionIndex::currentPersonnel;
+std::shared_ptr<const NameCompletionIndex> NameCompletionIndex::currentIndex;
+
+//Public
+
+/*!
+ * \brief Constructor.
+ *
+ * Builds the sorted name arrays and the cross-links between first and last names from \p pPersonnel.
+ *
+ * \param pPersonnel Persons to build the index from.
+ */
+NameCompletionIndex::NameCompletionIndex(const std::vector<Person>& pPersonnel)
+{
+    std::vector<QString> tLastNames, tFirstNames;
+    tLastNames.reserve(pPersonnel.size());
+    tFirstNames.reserve(pPersonnel.size());
+
+    for (const Person& tPerson : pPersonnel)
+    {
+        tLastNames.push_back(tPerson.getLastName());
+        tFirstNames.push_back(tPerson.getFirstName());
+    }
+
+    lastNamesSorted = sortedUnique(std::move(tLastNames));
+    firstNamesSorted = sortedUnique(std::move(tFirstNames));
+
+    //Link each first name to the last names of all persons with that first name and vice versa
+
+    lastNamesByFirstName.resize(firstNamesSorted.size());
+    firstNamesByLastName.resize(lastNamesSorted.size());
+
+    for (const Person& tPerson : pPersonnel)
+    {
+        int tLastNamePos = find(lastNamesSorted, tPerson.getLastName());
+        int tFirstNamePos = find(firstNamesSorted, tPerson.getFirstName());
+
+        lastNamesByFirstName[tFirstNamePos].push_back(tLastNamePos);
+        firstNamesByLastName[tLastNamePos].push_back(tFirstNamePos);
+    }
+
+    //Keep linked positions sorted (i.e. in name order) and distinct
+
+    for (std::vector<int>& tPositions : lastNamesByFirstName)
+    {
+        std::sort(tPositions.begin(), tPositions.end());
+        tPositions.erase(std::unique(tPositions.begin(), tPositions.end()), tPositions.end());
+    }
+    for (std::vector<int>& tPositions : firstNamesByLastName)
+    {
+        std::sort(tPositions.begin(), tPositions.end());
+        tPositions.erase(std::unique(tPositions.begin(), tPositions.end()), tPositions.end());
+    }
+}
+
+//
+
+/*!
+ * \brief Get the shared index for the current personnel.
+ *
+ * Returns an index built from the current personnel snapshot of the database cache (see DatabaseCache::personnel()).
+ * The index is shared by all callers and only rebuilt, if the snapshot has changed since the last call.
+ *
+ * \return Shared name completion index.
+ */
+std::shared_ptr<const NameCompletionIndex> NameCompletionIndex::current()
+{
+    std::shared_ptr<const std::vector<Person>> tPersonnel = DatabaseCache::personnel();
+
+    const std::lock_guard<std::mutex> tLock(currentMutex);
+
+    if (currentIndex == nullptr || tPersonnel != currentPersonnel)
+    {
+        currentIndex = std::make_shared<const NameCompletionIndex>(*tPersonnel);
+        currentPersonnel = std::move(tPersonnel);
+    }
+
+    return currentIndex;
+}
+
+//
+
+/*!
+ * \brief Get all distinct last names (sorted).
+ *
+ * \return Distinct last names sorted by lessThan().
+ */
+const std::vector<QString>& NameCompletionIndex::lastNames() const
+{
+    return lastNamesSorted;
+}
+
+/*!
+ * \brief Get all distinct first names (sorted).
+ *
+ * \return Distinct first names sorted by lessThan().
+ */
+const std::vector<QString>& NameCompletionIndex::firstNames() const
+{
+    return firstNamesSorted;
+}
+
+//
+
+/*!
+ * \brief Find the position of a last name.
+ *
+ * \param pLastName Last name to find (case-sensitive).
+ * \return Position of \p pLastName in lastNames() or -1, if not found.
+ */
+int NameCompletionIndex::findLastName(const QString& pLastName) const
+{
+    return find(lastNamesSorted, pLastName);
+}
+
+/*!
+ * \brief Find the position of a first name.
+ *
+ * \param pFirstName First name to find (case-sensitive).
+ * \return Position of \p pFirstName in firstNames() or -1, if not found.
+ */
+int NameCompletionIndex::findFirstName(const QString& pFirstName) const
+{
+    return find(firstNamesSorted, pFirstName);
+}
+
+//
+
+/*!
+ * \brief Get positions of all last names of persons with a specific first name.
+ *
+ * \param pFirstNamePos Position of the first name in firstNames().
+ * \return Sorted positions in lastNames().
+ */
+const std::vector<int>& NameCompletionIndex::lastNamesForFirstName(int pFirstNamePos) const
+{
+    return lastNamesByFirstName.at(pFirstNamePos);
+}
+
+/*!
+ * \brief Get positions of all first names of persons with a specific last name.
+ *
+ * \param pLastNamePos Position of the last name in lastNames().
+ * \return Sorted positions in firstNames().
+ */
+const std::vector<int>& NameCompletionIndex::firstNamesForLastName(int pLastNamePos) const
+{
+    return firstNamesByLastName.at(pLastNamePos);
+}
+
+//
+
+/*!
+ * \brief Sort order of the names.
+ *
+ * Compares case-insensitively (as required by QCompleter::CaseInsensitivelySortedModel)
+ * and case-sensitively only for names that are equal otherwise.
+ *
+ * \param pFirst First name to compare.
+ * \param pSecond Second name to compare.
+ * \return If \p pFirst is sorted before \p pSecond.
+ */
+bool NameCompletionIndex::lessThan(const QString& pFirst, const QString& pSecond)
+{
+    int tCmp = QString::compare(pFirst, pSecond, Qt::CaseInsensitive);
+
+    if (tCmp != 0)
+        return tCmp < 0;
+
+    return QString::compare(pFirst, pSecond, Qt::CaseSensitive) < 0;
+}
+
+//Private
+
+/*!
+ * \brief Sort names and remove duplicates.
+ *
+ * \param pNames Names to sort.
+ * \return Distinct names sorted by lessThan().
+ */
+std::vector<QString> NameCompletionIndex::sortedUnique(std::vector<QString> pNames)
+{
+    std::sort(pNames.begin(), pNames.end(), &NameCompletionIndex::lessThan);
+    pNames.erase(std::unique(pNames.begin(), pNames.end()), pNames.end());
+    pNames.shrink_to_fit();
+
+    return pNames;
+}
+
+/*!
+ * \brief Find the position of a name.
+ *
+ * \param pNames Names sorted by lessThan().
+ * \param pName Name to find (case-sensitive).
+ * \return Position of \p pName in \p pNames or -1, if not found.
+ */
+int NameCompletionIndex::find(const std::vector<QString>& pNames, const QString& pName)
+{
+    auto it = std::lower_bound(pNames.begin(), pNames.end(), pName, &NameCompletionIndex::lessThan);
+
+    if (it == pNames.end() || *it != pName)
+        return -1;
+
+    return static_cast<int>(it - pNames.begin());
+}
@@ -0,0 +1,83 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef NAMECOMPLETIONINDEX_H
+#define NAMECOMPLETIONINDEX_H
+
+#include "person.h"
+
+#include <QString>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*!
+ * \brief Sorted index of the distinct first and last names of the personnel database for fast name completion.
+ *
+ * Holds the distinct last and first names of a personnel snapshot (see DatabaseCache::personnel()) in
+ * arrays sorted case-insensitively (see lessThan()), such that they can be directly served by a QCompleter
+ * (see NameCompletionModel) using binary search (QCompleter::CaseInsensitivelySortedModel).
+ * Additionally, for each first name the (sorted) positions of all last names of persons with that first name are
+ * stored and vice versa (see lastNamesForFirstName() and firstNamesForLastName()). Exact name lookups
+ * (see findLastName() and findFirstName()) are done by binary search as well.
+ *
+ * The index is immutable once built. Use current() to obtain an index shared by all users, which is rebuilt only
+ * when the personnel snapshot of the database cache has changed (i.e. not on every call).
+ */
+class NameCompletionIndex
+{
+public:
+    explicit NameCompletionIndex(const std::vector<Person>& pPersonnel);    ///< Constructor.
+    //
+    static std::shared_ptr<const NameCompletionIndex> current();            ///< Get the shared index for the current personnel.
+    //
+    const std::vector<QString>& lastNames() const;                          ///< Get all distinct last names (sorted).
+    const std::vector<QString>& firstNames() const;                         ///< Get all distinct first names (sorted).
+    //
+    int findLastName(const QString& pLastName) const;                       ///< Find the position of a last name.
+    int findFirstName(const QString& pFirstName) const;                     ///< Find the position of a first name.
+    //
+    const std::vector<int>& lastNamesForFirstName(int pFirstNamePos) const; ///< \brief Get positions of all last names of persons
+                                                                            ///  with a specific first name.
+    const std::vector<int>& firstNamesForLastName(int pLastNamePos) const;  ///< \brief Get positions of all first names of persons
+                                                                            ///  with a specific last name.
+    //
+    static bool lessThan(const QString& pFirst, const QString& pSecond);    ///< Sort order of the names.
+
+private:
+    static std::vector<QString> sortedUnique(std::vector<QString> pNames);              ///< Sort names and remove duplicates.
+    static int find(const std::vector<QString>& pNames, const QString& pName);          ///< Find the position of a name.
+
+private:
+    std::vector<QString> lastNamesSorted;               //Distinct last names, sorted by lessThan()
+    std::vector<QString> firstNamesSorted;              //Distinct first names, sorted by lessThan()
+    //
+    std::vector<std::vector<int>> lastNamesByFirstName; //Sorted last name positions of persons for each first name position
+    std::vector<std::vector<int>> firstNamesByLastName; //Sorted first name positions of persons for each last name position
+    //
+    static std::mutex currentMutex;                                     //Lock for access to shared index
+    static std::shared_ptr<const std::vector<Person>> currentPersonnel; //Personnel snapshot the shared index was built from
+    static std::shared_ptr<const NameCompletionIndex> currentIndex;     //Shared index
+};
+
+#endif // NAMECOMPLETIONINDEX_H
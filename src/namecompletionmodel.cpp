@@ -0,0 +1,160 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "namecompletionmodel.h"
+
+/*!
+ * \brief Constructor.
+ *
+ * Uses the current shared index (see NameCompletionIndex::current()) and provides all names.
+ *
+ * \param pNameType Provide last or first names.
+ * \param pParent The parent object.
+ */
+NameCompletionModel::NameCompletionModel(NameType pNameType, QObject* pParent) :
+    QAbstractListModel(pParent),
+    nameType(pNameType),
+    index(NameCompletionIndex::current()),
+    linkedPositions(nullptr)
+{
+}
+
+//Public
+
+/*!
+ * \brief Set the index to get the names from.
+ *
+ * Resets the model to provide all names from \p pIndex (see showAllNames()).
+ * Does nothing, if \p pIndex is already used.
+ *
+ * \param pIndex New name completion index.
+ */
+void NameCompletionModel::setIndex(std::shared_ptr<const NameCompletionIndex> pIndex)
+{
+    if (pIndex == nullptr || pIndex == index)
+        return;
+
+    beginResetModel();
+
+    index = std::move(pIndex);
+    linkedPositions = nullptr;
+
+    endResetModel();
+}
+
+//
+
+/*!
+ * \brief Provide all names.
+ *
+ * Does not reset the model, if all names are already provided.
+ */
+void NameCompletionModel::showAllNames()
+{
+    if (linkedPositions == nullptr)
+        return;
+
+    beginResetModel();
+    linkedPositions = nullptr;
+    endResetModel();
+}
+
+/*!
+ * \brief Provide only names linked to a name of the other type.
+ *
+ * Provides e.g. (if last names are provided) only the last names of persons with the first name at position \p pOtherNamePos
+ * in NameCompletionIndex::firstNames(). Provides all names (see showAllNames()), if \p pOtherNamePos is negative.
+ *
+ * Does not reset the model, if the same names are already provided.
+ *
+ * \param pOtherNamePos Position of the name of the other type in the index.
+ */
+void NameCompletionModel::showLinkedNames(int pOtherNamePos)
+{
+    if (pOtherNamePos < 0)
+    {
+        showAllNames();
+        return;
+    }
+
+    const std::vector<int>* tPositions = (nameType == NameType::_LAST) ? &index->lastNamesForFirstName(pOtherNamePos) :
+                                                                         &index->firstNamesForLastName(pOtherNamePos);
+
+    if (tPositions == linkedPositions)
+        return;
+
+    beginResetModel();
+    linkedPositions = tPositions;
+    endResetModel();
+}
+
+//
+
+/*!
+ * \brief Get the number of provided names.
+ *
+ * \param pParent Parent model index (must be invalid for list models).
+ * \return Number of rows.
+ */
+int NameCompletionModel::rowCount(const QModelIndex& pParent) const
+{
+    if (pParent.isValid())
+        return 0;
+
+    if (linkedPositions != nullptr)
+        return static_cast<int>(linkedPositions->size());
+
+    return static_cast<int>(names().size());
+}
+
+/*!
+ * \brief Get a provided name.
+ *
+ * \param pIndex Model index of the row.
+ * \param pRole Item data role (only Qt::DisplayRole and Qt::EditRole supported).
+ * \return Name at row of \p pIndex or invalid QVariant, if \p pIndex or \p pRole invalid.
+ */
+QVariant NameCompletionModel::data(const QModelIndex& pIndex, int pRole) const
+{
+    if (!pIndex.isValid() || pIndex.row() >= rowCount() || (pRole != Qt::DisplayRole && pRole != Qt::EditRole))
+        return QVariant();
+
+    if (linkedPositions != nullptr)
+        return names()[(*linkedPositions)[pIndex.row()]];
+
+    return names()[pIndex.row()];
+}
+
+//Private
+
+/*!
+ * \brief Get all names of the configured type from the index.
+ *
+ * \return Last names or first names from the index.
+ */
+const std::vector<QString>& NameCompletionModel::names() const
+{
+    if (nameType == NameType::_LAST)
+        return index->lastNames();
+    else
+        return index->firstNames();
+}
@@ -0,0 +1,79 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef NAMECOMPLETIONMODEL_H
+#define NAMECOMPLETIONMODEL_H
+
+#include "namecompletionindex.h"
+
+#include <QAbstractListModel>
+#include <QModelIndex>
+#include <QObject>
+#include <QVariant>
+
+#include <memory>
+#include <vector>
+
+/*!
+ * \brief Lightweight list model serving person name completions from a NameCompletionIndex.
+ *
+ * Provides either all last names or all first names of a (shared) NameCompletionIndex (see showAllNames())
+ * or only those names linked to a specific name of the other type (see showLinkedNames()), e.g. all last names
+ * of persons with a specific first name. Names are not copied but directly read from the index.
+ * The rows are sorted case-insensitively such that the model can be used by a QCompleter
+ * with QCompleter::CaseInsensitivelySortedModel.
+ */
+class NameCompletionModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * \brief Type of the provided names.
+     */
+    enum class NameType : int8_t
+    {
+        _LAST = 0,      ///< Last names.
+        _FIRST = 1      ///< First names.
+    };
+
+public:
+    explicit NameCompletionModel(NameType pNameType, QObject* pParent = nullptr);   ///< Constructor.
+    //
+    void setIndex(std::shared_ptr<const NameCompletionIndex> pIndex);   ///< Set the index to get the names from.
+    //
+    void showAllNames();                                    ///< Provide all names.
+    void showLinkedNames(int pOtherNamePos);                ///< Provide only names linked to a name of the other type.
+    //
+    int rowCount(const QModelIndex& pParent = QModelIndex()) const override;                ///< Get the number of provided names.
+    QVariant data(const QModelIndex& pIndex, int pRole = Qt::DisplayRole) const override;   ///< Get a provided name.
+
+private:
+    const std::vector<QString>& names() const;              ///< Get all names of the configured type from the index.
+
+private:
+    const NameType nameType;                            //Provide last or first names?
+    std::shared_ptr<const NameCompletionIndex> index;   //Index to get the names from
+    const std::vector<int>* linkedPositions;            //Positions of provided names in index, if only linked names provided
+};
+
+#endif // NAMECOMPLETIONMODEL_H
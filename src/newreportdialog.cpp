@@ -25,6 +25,7 @@
 
 #include "boatlog.h"
 #include "databasecache.h"
+#include "reportarchiveindex.h"
 #include "settingscache.h"
 
 #include <QCalendarWidget>
@@ -80,8 +81,8 @@ NewReportDialog::NewReportDialog(QWidget *const pParent) :
 
     //Load available stations and boats from database cache
 
-    int defaultStationRowId = SettingsCache::getIntSetting("app_default_station");
-    int defaultBoatRowId = SettingsCache::getIntSetting("app_default_boat");
+    int defaultStationRowId = SettingsCache::getIntSetting(SettingsCache::IntSetting::_DEFAULT_STATION);
+    int defaultBoatRowId = SettingsCache::getIntSetting(SettingsCache::IntSetting::_DEFAULT_BOAT);
 
     //Use station identifier instead of 'rowid' as key
     QString tDefaultStationIdent;
@@ -102,7 +103,7 @@ NewReportDialog::NewReportDialog(QWidget *const pParent) :
 
     QString tDefaultBoatName;
 
-    if (!SettingsCache::getBoolSetting("app_boatLog_disabled"))
+    if (!SettingsCache::getBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED))
     {
         for (const auto& it : DatabaseCache::boats())
         {
@@ -124,8 +125,10 @@ NewReportDialog::NewReportDialog(QWidget *const pParent) :
 
     //Set default values
 
-    ui->dutyTimesBegin_timeEdit->setTime(QTime::fromString(SettingsCache::getStrSetting("app_default_dutyTimeBegin"), "hh:mm"));
-    ui->dutyTimesEnd_timeEdit->setTime(QTime::fromString(SettingsCache::getStrSetting("app_default_dutyTimeEnd"), "hh:mm"));
+    ui->dutyTimesBegin_timeEdit->setTime(QTime::fromString(SettingsCache::getStrSetting(SettingsCache::StrSetting::_DEFAULT_DUTY_TIME_BEGIN),
+                                                           "hh:mm"));
+    ui->dutyTimesEnd_timeEdit->setTime(QTime::fromString(SettingsCache::getStrSetting(SettingsCache::StrSetting::_DEFAULT_DUTY_TIME_END),
+                                                         "hh:mm"));
 
     if (tDefaultStationIdent == "")
         ui->station_comboBox->setCurrentIndex(ui->station_comboBox->count() > 0 ? 0 : -1);
@@ -219,13 +222,11 @@ void NewReportDialog::accept()
 
     if (ui->loadLastReportCarries_radioButton->isChecked())
     {
-        Report oldReport;
-        if (!oldReport.open(ui->lastReportFilename_label->text()))
+        if (!ReportArchiveIndex::loadCarryovers(ui->lastReportFilename_label->text(), report))
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Laden des letzten Wachberichts!", QMessageBox::Ok, this).exec();
             return;
         }
-        report.loadCarryovers(oldReport);
     }
     else
     {
@@ -402,7 +403,8 @@ void NewReportDialog::on_noLoadLastReportCarries_radioButton_toggled(const bool
  * \brief Select a file name to load last report's carryovers from.
  *
  * If \p checked, show file dialog to select last report and set the displayed last report file name,
- * i.e. load last report on dialog accept with displayed file name.
+ * i.e. load last report on dialog accept with displayed file name. The file dialog preselects the latest
+ * known report of the selected station (see ReportArchiveIndex::latestReport()).
  *
  * \param checked Button checked (i.e. pressed)?
  */
@@ -411,7 +413,19 @@ void NewReportDialog::on_loadLastReportCarries_radioButton_toggled(const bool ch
     if (!checked)
         return;
 
-    QString tFileName = QFileDialog::getOpenFileName(this, "[Überträge laden] Letzten Wachbericht öffnen", "", "Wachberichte (*.wbr)");
+    //Preselect the latest known report of the selected station
+
+    QString tPreselectedFileName = "";
+
+    ReportArchiveIndex::Entry tLatestEntry;
+    if (ui->station_comboBox->currentIndex() != -1 &&
+        ReportArchiveIndex::latestReport(Aux::stationIdentFromLabel(ui->station_comboBox->currentText()), tLatestEntry))
+    {
+        tPreselectedFileName = tLatestEntry.fileName;
+    }
+
+    QString tFileName = QFileDialog::getOpenFileName(this, "[Überträge laden] Letzten Wachbericht öffnen", tPreselectedFileName,
+                                                     "Wachberichte (*.wbr)");
 
     if (tFileName == "")
     {
@@ -0,0 +1,160 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "paralleljobs.h"
+
+#include <QThread>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+//Public
+
+/*!
+ * \brief Get the default number of parallel jobs.
+ *
+ * \return Number of processor cores (at least 1).
+ */
+int ParallelJobs::defaultJobCount()
+{
+    return std::max(1, QThread::idealThreadCount());
+}
+
+//
+
+/*!
+ * \brief Run a number of independent tasks in parallel.
+ *
+ * Calls \p pTask for each index from 0 to \p pTotal - 1. The tasks are processed by \p pJobs parallel jobs
+ * (or defaultJobCount() jobs, if \p pJobs is smaller than 1), each in its own thread, such that \p pTask
+ * must be safe to be called concurrently. Each job repeatedly takes the next index not yet taken by any other job.
+ *
+ * \p pTask shall return an error message or an empty string, if the task was successful. \p pErrors is resized
+ * to \p pTotal and each element is set to the message returned for the corresponding index (or left empty,
+ * if the task was not run due to an abort).
+ *
+ * If \p pProgress is set, it is repeatedly called (from the calling thread) with the number of tasks finished so far
+ * and \p pTotal. No further tasks are started, if \p pProgress returns false. Tasks that are already running are finished, though.
+ *
+ * \param pTotal Number of tasks.
+ * \param pJobs Number of parallel jobs.
+ * \param pTask Function executing the task with the passed index.
+ * \param pErrors Error messages returned by the tasks (in the order of the task indices).
+ * \param pProgress Optional function to report the progress and to request an abort.
+ * \return If all tasks were run (i.e. not aborted before).
+ */
+bool ParallelJobs::run(const int pTotal, int pJobs, const std::function<QString(int)>& pTask, std::vector<QString>& pErrors,
+                       const std::function<bool(int, int)>& pProgress)
+{
+    pErrors.assign(static_cast<std::size_t>(std::max(0, pTotal)), QString());
+
+    if (pTotal <= 0)
+        return true;
+
+    if (pJobs < 1)
+        pJobs = defaultJobCount();
+
+    pJobs = std::min(pJobs, pTotal);
+
+    std::atomic_int tNextIndex(0);
+    std::atomic_bool tCanceled(false);
+
+    std::mutex tMutex;
+    std::condition_variable tCondition;
+
+    int tFinished = 0;
+    int tRunningJobs = pJobs;
+
+    //Each job processes the next task not yet taken by any other job until there are no tasks left (or canceled)
+    auto tJob = [pTotal, &pTask, &pErrors, &tNextIndex, &tCanceled, &tMutex, &tCondition, &tFinished, &tRunningJobs]() -> void
+    {
+        while (!tCanceled.load())
+        {
+            const int tIndex = tNextIndex++;
+
+            if (tIndex >= pTotal)
+                break;
+
+            QString tError = pTask(tIndex);
+
+            {
+                const std::lock_guard<std::mutex> tLock(tMutex);
+
+                pErrors[static_cast<std::size_t>(tIndex)] = std::move(tError);
+                ++tFinished;
+            }
+
+            tCondition.notify_one();
+        }
+
+        {
+            const std::lock_guard<std::mutex> tLock(tMutex);
+            --tRunningJobs;
+        }
+
+        tCondition.notify_one();
+    };
+
+    std::vector<std::thread> tThreads;
+    tThreads.reserve(static_cast<std::size_t>(pJobs));
+
+    for (int i = 0; i < pJobs; ++i)
+        tThreads.emplace_back(tJob);
+
+    //Wait for all jobs; wake up regularly to report the progress, such that e.g. a progress dialog stays responsive
+
+    {
+        std::unique_lock<std::mutex> tLock(tMutex);
+
+        while (tRunningJobs > 0)
+        {
+            if (!pProgress)
+            {
+                tCondition.wait(tLock);
+                continue;
+            }
+
+            tCondition.wait_for(tLock, std::chrono::milliseconds(100));
+
+            const int tProgress = tFinished;
+
+            tLock.unlock();
+
+            if (!pProgress(tProgress, pTotal))
+                tCanceled.store(true);
+
+            tLock.lock();
+        }
+    }
+
+    for (std::thread& tThread : tThreads)
+        tThread.join();
+
+    if (pProgress)
+        pProgress(tFinished, pTotal);
+
+    return tFinished == pTotal;
+}
@@ -0,0 +1,49 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef PARALLELJOBS_H
+#define PARALLELJOBS_H
+
+#include <QString>
+
+#include <functional>
+#include <vector>
+
+/*!
+ * \brief Run a number of independent tasks in parallel.
+ *
+ * Distributes indexed tasks to a number of jobs, each running in its own thread (see run()).
+ * Used for batch operations on many reports, such as exporting (see BatchExporter), correcting carryovers
+ * (see CarryoverFixer) and indexing (see ReportArchiveIndex).
+ */
+class ParallelJobs
+{
+public:
+    ParallelJobs() = delete;    ///< Deleted constructor.
+    //
+    static int defaultJobCount();   ///< Get the default number of parallel jobs.
+    //
+    static bool run(int pTotal, int pJobs, const std::function<QString(int)>& pTask, std::vector<QString>& pErrors,
+                    const std::function<bool(int, int)>& pProgress = nullptr);    ///< Run a number of independent tasks in parallel.
+};
+
+#endif // PARALLELJOBS_H
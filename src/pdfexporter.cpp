@@ -29,6 +29,7 @@
 #include "person.h"
 #include "settingscache.h"
 
+#include <QBuffer>
 #include <QFile>
 #include <QFileInfo>
 #include <QImage>
@@ -44,37 +45,86 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
+//Initialize static class members
+
+QString PDFExporter::cachedLogoPath = "";
+QDateTime PDFExporter::cachedLogoLastModified;
+QByteArray PDFExporter::cachedLogoPNG;
+
 //Public
 
+/*!
+ * \brief Capture the current export settings from settings and database cache.
+ *
+ * Reads all export-relevant settings, the available stations and boats and the association logo
+ * (the custom logo, if defined and existing, or the default logo otherwise) into an ExportSettings snapshot,
+ * which can then be passed to exportPDF() in any thread.
+ *
+ * Note: Must be called from the main thread (reads SettingsCache and DatabaseCache).
+ *
+ * \return Snapshot of current export settings.
+ */
+PDFExporter::ExportSettings PDFExporter::currentExportSettings()
+{
+    ExportSettings tSettings;
+
+    tSettings.xelatexPath = SettingsCache::getStrSetting(SettingsCache::StrSetting::_EXPORT_XELATEX_PATH, true);
+    tSettings.fontFamily = SettingsCache::getStrSetting(SettingsCache::StrSetting::_EXPORT_FONT_FAMILY, true);
+    tSettings.twoSidedPrint = SettingsCache::getBoolSetting(SettingsCache::IntSetting::_EXPORT_TWO_SIDED_PRINT, true);
+    tSettings.boatLogDisabled = SettingsCache::getBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED, true);
+
+    //Use station identifier instead of 'rowid' as key
+    for (const auto& it : DatabaseCache::stations())
+    {
+        QString tStationIdent;
+        Aux::stationIdentFromNameLocation(it.second.name, it.second.location, tStationIdent);
+
+        tSettings.stations.insert({std::move(tStationIdent), it.second});
+    }
+
+    //Use boat name instead of 'rowid' as key
+    for (const auto& it : DatabaseCache::boats())
+        tSettings.boats.insert({it.second.name, it.second});
+
+    tSettings.logoPNG = associationLogoPNG();
+
+    return tSettings;
+}
+
+//
+
 /*!
  * \brief Export report as PDF file.
  *
  * Calls reportToLaTeX() to generate LaTeX code from \p pReport, which is then compiled using
  * configured XeLaTeX executable in a temporary directory and copied over to \p pFileName.
- * \p pPersonnelTableMaxLength and \p pBoatDrivesTableMaxLength are passed to reportToLaTeX().
+ * \p pSettings, \p pPersonnelTableMaxLength and \p pBoatDrivesTableMaxLength are passed to reportToLaTeX().
  *
- * Images required for the LaTeX document are copied from compiled resources to temporary directory before compilation.
+ * Images required for the LaTeX document are written to temporary directory before compilation.
  *
  * For compilation of the document a separate process is started, which is killed after 30s (assume compilation error).
  *
+ * The function only uses \p pSettings and does not access SettingsCache or DatabaseCache, so it can be called in any thread.
+ *
  * \param pReport The report to use to create the PDF.
  * \param pFileName Location / file name for the PDF file.
+ * \param pSettings Export settings (see currentExportSettings()).
  * \param pPersonnelTableMaxLength See reportToLaTeX().
  * \param pBoatDrivesTableMaxLength See reportToLaTeX().
  * \return If compilation and copying was successful.
  */
-bool PDFExporter::exportPDF(const Report pReport, const QString& pFileName,
+bool PDFExporter::exportPDF(const Report pReport, const QString& pFileName, const ExportSettings& pSettings,
                             const int pPersonnelTableMaxLength, const int pBoatDrivesTableMaxLength)
 {
     //Generate content of LaTeX document
     QString texString;
-    reportToLaTeX(pReport, texString, pPersonnelTableMaxLength, pBoatDrivesTableMaxLength);
+    reportToLaTeX(pReport, texString, pSettings, pPersonnelTableMaxLength, pBoatDrivesTableMaxLength);
 
     //XeLaTeX application path
-    //Note: Suppressing potential message boxes since this function likely executed in different thread (not possible with QMessageBox)
-    QString texProg = SettingsCache::getStrSetting("app_export_xelatexPath", true);
+    const QString& texProg = pSettings.xelatexPath;
 
     if (!QFileInfo::exists(texProg))
     {
@@ -112,41 +162,25 @@ bool PDFExporter::exportPDF(const Report pReport, const QString& pFileName,
     }
     texFile.close();
 
-    //Write association logo to temporary directory; use custom logo if defined and exists
+    //Write association logo to temporary directory
 
     QString logoFileName = "logo.png";
 
-    QString customLogoPath = SettingsCache::getStrSetting("app_export_customLogoPath", true);
-
-    if (customLogoPath == "" || !QFileInfo::exists(customLogoPath))
+    if (pSettings.logoPNG.isEmpty())
     {
-        if (customLogoPath != "")
-            std::cerr<<"WARNING: User-defined association logo does not exist! Using default logo."<<std::endl;
-
-        QFile defaultLogoFile(":/resources/images/dlrg-logo.png");
-
-        if (!defaultLogoFile.copy(tmpDir.filePath(logoFileName)))
-        {
-            std::cerr<<"ERROR: Could not create association logo file!"<<std::endl;
-            return false;
-        }
+        std::cerr<<"ERROR: No association logo available!"<<std::endl;
+        return false;
     }
-    else
-    {
-        QImage customLogo;
 
-        if (!customLogo.load(customLogoPath))
-        {
-            std::cerr<<"ERROR: Could not open user-defined association logo file!"<<std::endl;
-            return false;
-        }
+    QFile logoFile(tmpDir.filePath(logoFileName));
 
-        if (!customLogo.save(tmpDir.filePath(logoFileName)))
-        {
-            std::cerr<<"ERROR: Could not create association logo file!"<<std::endl;
-            return false;
-        }
+    if (!logoFile.open(QIODevice::WriteOnly) || logoFile.write(pSettings.logoPNG) == -1)
+    {
+        logoFile.close();
+        std::cerr<<"ERROR: Could not create association logo file!"<<std::endl;
+        return false;
     }
+    logoFile.close();
 
     //Compile the document
 
@@ -212,23 +246,109 @@ bool PDFExporter::exportPDF(const Report pReport, const QString& pFileName,
     return true;
 }
 
+/*!
+ * \brief Export report as PDF file using current export settings.
+ *
+ * Calls exportPDF(Report, const QString&, const ExportSettings&, int, int) with export settings from currentExportSettings().
+ *
+ * Note: Must be called from the main thread (see currentExportSettings()).
+ *
+ * \param pReport The report to use to create the PDF.
+ * \param pFileName Location / file name for the PDF file.
+ * \param pPersonnelTableMaxLength See reportToLaTeX().
+ * \param pBoatDrivesTableMaxLength See reportToLaTeX().
+ * \return If compilation and copying was successful.
+ */
+bool PDFExporter::exportPDF(Report pReport, const QString& pFileName,
+                            const int pPersonnelTableMaxLength, const int pBoatDrivesTableMaxLength)
+{
+    return exportPDF(std::move(pReport), pFileName, currentExportSettings(), pPersonnelTableMaxLength, pBoatDrivesTableMaxLength);
+}
+
 //Private
 
+/*!
+ * \brief Get the association logo as PNG image data.
+ *
+ * Uses the custom logo, if defined and existing, and the default logo otherwise.
+ *
+ * Loading and converting the logo is only done again if the logo path or the modification time of the logo file
+ * has changed since the last call. Otherwise the cached logo data is returned.
+ *
+ * Note: Must be called from the main thread (reads SettingsCache and modifies the cached logo).
+ *
+ * \return Association logo as PNG image data (empty, if the logo could not be loaded).
+ */
+QByteArray PDFExporter::associationLogoPNG()
+{
+    QString customLogoPath = SettingsCache::getStrSetting(SettingsCache::StrSetting::_EXPORT_CUSTOM_LOGO_PATH, true);
+
+    bool useDefaultLogo = (customLogoPath == "" || !QFileInfo::exists(customLogoPath));
+
+    if (useDefaultLogo && customLogoPath != "")
+        std::cerr<<"WARNING: User-defined association logo does not exist! Using default logo."<<std::endl;
+
+    const QString logoPath = useDefaultLogo ? ":/resources/images/dlrg-logo.png" : customLogoPath;
+    const QDateTime logoLastModified = QFileInfo(logoPath).lastModified();
+
+    if (!cachedLogoPNG.isEmpty() && logoPath == cachedLogoPath && logoLastModified == cachedLogoLastModified)
+        return cachedLogoPNG;
+
+    QByteArray logoPNG;
+
+    if (useDefaultLogo)
+    {
+        QFile defaultLogoFile(logoPath);
+
+        if (defaultLogoFile.open(QIODevice::ReadOnly))
+            logoPNG = defaultLogoFile.readAll();
+        else
+            std::cerr<<"ERROR: Could not open default association logo file!"<<std::endl;
+    }
+    else
+    {
+        QImage customLogo;
+
+        if (!customLogo.load(logoPath))
+            std::cerr<<"ERROR: Could not open user-defined association logo file!"<<std::endl;
+        else
+        {
+            QBuffer tLogoBuffer(&logoPNG);
+            tLogoBuffer.open(QIODevice::WriteOnly);
+
+            if (!customLogo.save(&tLogoBuffer, "PNG"))
+            {
+                std::cerr<<"ERROR: Could not convert user-defined association logo!"<<std::endl;
+                logoPNG.clear();
+            }
+        }
+    }
+
+    cachedLogoPath = logoPath;
+    cachedLogoLastModified = logoLastModified;
+    cachedLogoPNG = logoPNG;
+
+    return logoPNG;
+}
+
+//
+
 /*!
  * \brief Generate LaTeX document from report.
  *
  * Inserts \p pReport contents into a report LaTeX code template to form a report document.
  *
- * No boat log page is generated if boat log keeping has been disabled via the "app_boatLog_disabled" setting.
+ * No boat log page is generated if boat log keeping has been disabled (see ExportSettings::boatLogDisabled).
  *
  * The generated LaTeX code is assigned to \p pTeXString.
  *
  * \param pReport The report to use to create the PDF.
  * \param pTeXString Destination for the generated LaTeX code.
+ * \param pSettings Export settings (see currentExportSettings()).
  * \param pPersonnelTableMaxLength Row count limit for personnel table. Inserts additional page to continue table if this exceeded.
  * \param pBoatDrivesTableMaxLength Row count limit for boat drives table. Inserts additional page to continue table if this exceeded.
  */
-void PDFExporter::reportToLaTeX(const Report& pReport, QString& pTeXString,
+void PDFExporter::reportToLaTeX(const Report& pReport, QString& pTeXString, const ExportSettings& pSettings,
                                 const int pPersonnelTableMaxLength, const int pBoatDrivesTableMaxLength)
 {
     QString rawTexString0 = "\\documentclass[a4paper, notitlepage, 10pt]{scrreprt}\n"
@@ -271,8 +391,7 @@ void PDFExporter::reportToLaTeX(const Report& pReport, QString& pTeXString,
 
     //Document font
 
-    //Note: Suppressing potential message boxes since this function likely executed in different thread (not possible with QMessageBox)
-    QString tFontFamily = SettingsCache::getStrSetting("app_export_fontFamily", true);
+    QString tFontFamily = pSettings.fontFamily;
     Aux::latexEscapeSpecialChars(tFontFamily);
     Aux::latexFixLineBreaksNoLineBreaks(tFontFamily);
 
@@ -306,14 +425,11 @@ void PDFExporter::reportToLaTeX(const Report& pReport, QString& pTeXString,
     QString tStationLocation = "---";
     QString tStationName = "---";
 
-    //Get station information from database
-    std::map<int, Aux::Station> tStations = DatabaseCache::stations();
-    int tStRowId = 0;
-    QString tStName, tStLoc;
-    if (Aux::stationNameLocationFromIdent(pReport.getStation(), tStName, tStLoc) &&
-        DatabaseCache::stationRowIdFromNameLocation(tStName, tStLoc, tStRowId))
+    //Get station information from export settings
+    auto tStationIt = pSettings.stations.find(pReport.getStation());
+    if (tStationIt != pSettings.stations.end())
     {
-        const Aux::Station& tStation = tStations.at(tStRowId);
+        const Aux::Station& tStation = tStationIt->second;
 
         tLocalGroup = tStation.localGroup;
         tDistrictAssociation = tStation.districtAssociation;
@@ -632,7 +748,8 @@ void PDFExporter::reportToLaTeX(const Report& pReport, QString& pTeXString,
 
     //Enclosures
 
-    bool tEnclosedBoatLog = !SettingsCache::getBoolSetting("app_boatLog_disabled", true);   //Boat log automatically enclosed if enabled
+    //Boat log automatically enclosed if enabled
+    bool tEnclosedBoatLog = !pSettings.boatLogDisabled;
     int tEnclosedOperationProtocols = pReport.getOperationProtocolsCtr();
     int tEnclosedPatientRecords = pReport.getPatientRecordsCtr();
     int tEnclosedRadioCallLogs = pReport.getRadioCallLogsCtr();
@@ -749,8 +866,7 @@ void PDFExporter::reportToLaTeX(const Report& pReport, QString& pTeXString,
 
     QString pagebreakString = "\n\\clearpage\n";
 
-    //Note: Suppressing potential message boxes since this function likely executed in different thread (not possible with QMessageBox)
-    if (SettingsCache::getBoolSetting("app_export_twoSidedPrint", true))
+    if (pSettings.twoSidedPrint)
     {
         pagebreakString.append("\\ifodd\\value{page}\n"
                                "\\else\n"
@@ -768,12 +884,11 @@ void PDFExporter::reportToLaTeX(const Report& pReport, QString& pTeXString,
 
     const BoatLog& boatLog = *pReport.boatLog();
 
-    //Get boat information from database
-    std::map<int, Aux::Boat> tBoats = DatabaseCache::boats();
-    int tBtRowId = 0;
-    if (DatabaseCache::boatRowIdFromName(boatLog.getBoat(), tBtRowId))
+    //Get boat information from export settings
+    auto tBoatIt = pSettings.boats.find(boatLog.getBoat());
+    if (tBoatIt != pSettings.boats.end())
     {
-        const Aux::Boat& tBoat = tBoats.at(tBtRowId);
+        const Aux::Boat& tBoat = tBoatIt->second;
 
         tBoatName = tBoat.name;
         tBoatAcronym = tBoat.acronym;
@@ -1193,7 +1308,7 @@ void PDFExporter::reportToLaTeX(const Report& pReport, QString& pTeXString,
 
     QString texString;
 
-    if (SettingsCache::getBoolSetting("app_boatLog_disabled", true))
+    if (pSettings.boatLogDisabled)
         texString = texStringReport + texStringEnd;
     else
         texString = texStringReport + pagebreakString + texStringBoatLog + texStringEnd;
@@ -23,10 +23,15 @@
 #ifndef PDFEXPORTER_H
 #define PDFEXPORTER_H
 
+#include "auxil.h"
 #include "report.h"
 
+#include <QByteArray>
+#include <QDateTime>
 #include <QString>
 
+#include <map>
+
 /*!
  * \brief Export a Report as a PDF file using LaTeX.
  *
@@ -35,18 +40,52 @@
  * For this the "app_export_xelatexPath" setting must be set and contain a valid path to
  * a XeLaTeX executable. Note that no boat log page will be generated if boat log
  * keeping has been disabled via the "app_boatLog_disabled" setting.
+ *
+ * All settings and database information needed for the export are taken from an ExportSettings snapshot,
+ * which should be obtained via currentExportSettings() in the main thread. The export itself does not access
+ * SettingsCache or DatabaseCache and can hence be run in other threads (also several exports in parallel).
  */
 class PDFExporter
 {
+public:
+    /*!
+     * \brief Snapshot of all settings and database information needed for an export.
+     *
+     * See currentExportSettings().
+     */
+    struct ExportSettings
+    {
+        QString xelatexPath;                        ///< Path of the XeLaTeX executable.
+        QString fontFamily;                         ///< Document font family.
+        QByteArray logoPNG;                         ///< \brief Association logo as PNG image data
+                                                    ///  (empty, if the custom logo could not be loaded).
+        bool twoSidedPrint;                         ///< Insert blank pages for two-sided printing?
+        bool boatLogDisabled;                       ///< Omit the boat log page?
+        std::map<QString, Aux::Station> stations;   ///< Available stations with station identifier as key.
+        std::map<QString, Aux::Boat> boats;         ///< Available boats with boat name as key.
+    };
+
 public:
     PDFExporter() = delete;                                                                         ///< Deleted constructor.
     //
-    static bool exportPDF(Report pReport, const QString& pFileName,
+    static ExportSettings currentExportSettings();          ///< Capture the current export settings from settings and database cache.
+    //
+    static bool exportPDF(Report pReport, const QString& pFileName, const ExportSettings& pSettings,
                           int pPersonnelTableMaxLength = 13, int pBoatDrivesTableMaxLength = 9);    ///< Export report as PDF file.
+    static bool exportPDF(Report pReport, const QString& pFileName,
+                          int pPersonnelTableMaxLength = 13, int pBoatDrivesTableMaxLength = 9);    ///< \brief Export report as PDF file
+                                                                                                    ///  using current export settings.
 
 private:
-    static void reportToLaTeX(const Report& pReport, QString& pTeXString,
+    static QByteArray associationLogoPNG();                                                     ///< Get the association logo as PNG image data.
+    //
+    static void reportToLaTeX(const Report& pReport, QString& pTeXString, const ExportSettings& pSettings,
                               int pPersonnelTableMaxLength, int pBoatDrivesTableMaxLength);     ///< Generate LaTeX document from report.
+
+private:
+    static QString cachedLogoPath;              //Path of the logo file the cached logo was loaded from
+    static QDateTime cachedLogoLastModified;    //Modification time of the logo file when the cached logo was loaded
+    static QByteArray cachedLogoPNG;            //Cached association logo as PNG image data (see associationLogoPNG())
 };
 
 #endif // PDFEXPORTER_H
@@ -24,6 +24,8 @@
 
 #include <QByteArray>
 #include <QCryptographicHash>
+#include <QHash>
+#include <QLatin1String>
 
 /*!
  * \brief Constructor.
@@ -510,42 +512,14 @@ QString Person::createHashedIdent(const QString& pLastName, const QString& pFirs
  * \param pQualifications List of strings containing a single qualification each.
  */
 Person::Qualifications::Qualifications(const QStringList& pQualifications) :
-    eh(false),
-    drsaS(false),
-    sanA(false),
-    faWrd(false),
-    bfA(false),
-    bfB(false),
-    bos(false),
-    sr1(false),
-    et(false),
-    wf(false),
-    zf(false)
+    mask(0)
 {
     for (const QString& quali : pQualifications)
     {
-        if (quali == "EH")
-            eh = true;
-        else if (quali == "DRSA-S")
-            drsaS = true;
-        else if (quali == "SAN-A")
-            sanA = true;
-        else if (quali == "FA-WRD")
-            faWrd = true;
-        else if (quali == "BF-A")
-            bfA = true;
-        else if (quali == "BF-B")
-            bfB = true;
-        else if (quali == "BOS")
-            bos = true;
-        else if (quali == "SR-1")
-            sr1 = true;
-        else if (quali == "ET-1/2")
-            et = true;
-        else if (quali == "WF")
-            wf = true;
-        else if (quali == "ZUGF")
-            zf = true;
+        int tPos = findName(quali, names);
+
+        if (tPos >= 0)
+            mask |= static_cast<Mask>(1u << tPos);
     }
 }
 
@@ -553,13 +527,57 @@ Person::Qualifications::Qualifications(const QStringList& pQualifications) :
  * \brief Constructor.
  *
  * Sets each valid qualification contained in \p pQualifications to true and all others to false.
- * Calls QStringList overload of constructor with list created from \p pQualifications string split at ','.
+ * Parses \p pQualifications in place, i.e. without splitting it into a list first.
  *
  * \param pQualifications Comma-separated list of single qualification strings.
  */
 Person::Qualifications::Qualifications(const QString& pQualifications) :
-    Qualifications(pQualifications.split(','))
+    mask(parseList(pQualifications))
+{
+}
+
+//
+
+/*!
+ * \brief Create qualifications from a bitmask.
+ *
+ * Bits not corresponding to any available qualification are ignored.
+ *
+ * \param pMask Bitmask with bit 'i' set for each possessed qualification 'i' (see Person::Qualification).
+ * \return Qualifications defined by \p pMask.
+ */
+Person::Qualifications Person::Qualifications::fromMask(const Mask pMask)
+{
+    Qualifications tQualis(QStringList{});
+    tQualis.mask = pMask & static_cast<Mask>((1u << count) - 1);
+    return tQualis;
+}
+
+/*!
+ * \brief Parse many comma-separated qualification lists.
+ *
+ * Same as constructing Qualifications from each element of \p pQualifications, but parses
+ * each distinct string only once (typically only few different combinations exist).
+ *
+ * \param pQualifications Comma-separated lists of single qualification strings.
+ * \param pParsed Destination for parsed qualifications (same order as \p pQualifications).
+ */
+void Person::Qualifications::parseBulk(const std::vector<QString>& pQualifications, std::vector<Qualifications>& pParsed)
 {
+    pParsed.clear();
+    pParsed.reserve(pQualifications.size());
+
+    QHash<QString, Mask> tParsedMasks;
+
+    for (const QString& tQualis : pQualifications)
+    {
+        auto it = tParsedMasks.constFind(tQualis);
+
+        if (it == tParsedMasks.constEnd())
+            it = tParsedMasks.insert(tQualis, parseList(tQualis));
+
+        pParsed.push_back(fromMask(it.value()));
+    }
 }
 
 //
@@ -571,7 +589,13 @@ Person::Qualifications::Qualifications(const QString& pQualifications) :
  */
 QStringList Person::Qualifications::listAllQualifications()
 {
-    return {"EH", "DRSA-S", "SAN-A", "FA-WRD", "BF-A", "BF-B", "BOS", "SR-1", "ET-1/2", "WF", "ZUGF"};
+    QStringList tQualis;
+    tQualis.reserve(count);
+
+    for (const char* tName : names)
+        tQualis.push_back(QString::fromLatin1(tName));
+
+    return tQualis;
 }
 
 //
@@ -580,40 +604,29 @@ QStringList Person::Qualifications::listAllQualifications()
  * \brief Convert qualifications from old to new format.
  *
  * Converts a list of qualification strings using the old definitions from the format used in software versions
- * before 1.4.0 to a list using the new definitions from the format that is used since version 1.4.0.
+ * before 1.4.0 to a list using the new definitions from the format that is used since version 1.4.0
+ * (see \ref legacyNames and \ref names).
  *
  * \param pQualifications Comma-separated list of single qualification strings in the format used before version 1.4.0.
  * \return Comma-separated list of single qualification strings in the format used since version 1.4.0.
  */
 QString Person::Qualifications::convertLegacyQualifications(const QString& pQualifications)
 {
-    QStringList tQualis = pQualifications.split(',');
+    Qualifications tQualis(QStringList{});
 
-    for (QString& quali : tQualis)
+    for (QStringView tQuali : QStringView(pQualifications).split(u','))
     {
-        if (quali == "EH")
-        {}
-        else if (quali == "RSA")
-            quali = "DRSA-S";
-        else if (quali == "SAN-A")
-        {}
-        else if (quali == "FA-WRD")
-        {}
-        else if (quali == "BF")
-            quali = "BF-A";
-        else if (quali == "BOS")
-        {}
-        else if (quali == "SR-1")
-        {}
-        else if (quali == "ET")
-            quali = "ET-1/2";
-        else if (quali == "WF")
-        {}
-        else if (quali == "ZUGF")
-        {}
+        int tPos = findName(tQuali, legacyNames);
+
+        //Also accept strings already in new format, as before
+        if (tPos < 0)
+            tPos = findName(tQuali, names);
+
+        if (tPos >= 0)
+            tQualis.mask |= static_cast<Mask>(1u << tPos);
     }
 
-    return Qualifications(tQualis).toString();
+    return tQualis.toString();
 }
 
 //
@@ -625,35 +638,127 @@ QString Person::Qualifications::convertLegacyQualifications(const QString& pQual
  */
 QString Person::Qualifications::toString() const
 {
-    QString retVal;
-
-    //Note: Must not change order of existing qualifications here!
-
-    if (eh)
-        retVal.append("EH,");
-    if (drsaS)
-        retVal.append("DRSA-S,");
-    if (sanA)
-        retVal.append("SAN-A,");
-    if (faWrd)
-        retVal.append("FA-WRD,");
-    if (bfA)
-        retVal.append("BF-A,");
-    if (bfB)
-        retVal.append("BF-B,");
-    if (bos)
-        retVal.append("BOS,");
-    if (sr1)
-        retVal.append("SR-1,");
-    if (et)
-        retVal.append("ET-1/2,");
-    if (wf)
-        retVal.append("WF,");
-    if (zf)
-        retVal.append("ZUGF,");
-
-    if (retVal.endsWith(','))
-        retVal.chop(1);
-
-    return retVal;
+    //Note: Must not change order of existing qualifications here (i.e. in 'names')!
+
+    char tBuffer[count * 8];    //Enough for all names plus separators
+    std::size_t tLength = 0;
+
+    for (int i = 0; i < count; ++i)
+    {
+        if ((mask & (1u << i)) == 0)
+            continue;
+
+        if (tLength > 0)
+            tBuffer[tLength++] = ',';
+
+        for (const char* tChar = names[i]; *tChar != '\0'; ++tChar)
+            tBuffer[tLength++] = *tChar;
+    }
+
+    return QString::fromLatin1(tBuffer, static_cast<qsizetype>(tLength));
+}
+
+//
+
+/*!
+ * \brief Check if a qualification is possessed.
+ *
+ * \param pQualification Qualification to check.
+ * \return If \p pQualification is possessed.
+ */
+bool Person::Qualifications::has(const Qualification pQualification) const
+{
+    return (mask & (1u << static_cast<int>(pQualification))) != 0;
+}
+
+/*!
+ * \brief Set if a qualification is possessed.
+ *
+ * \param pQualification Qualification to set.
+ * \param pPossessed Is \p pQualification possessed?
+ */
+void Person::Qualifications::set(const Qualification pQualification, const bool pPossessed)
+{
+    if (pPossessed)
+        mask |= static_cast<Mask>(1u << static_cast<int>(pQualification));
+    else
+        mask &= static_cast<Mask>(~(1u << static_cast<int>(pQualification)));
+}
+
+/*!
+ * \brief Get the bitmask of possessed qualifications.
+ *
+ * \return Bitmask with bit 'i' set for each possessed qualification 'i' (see Person::Qualification).
+ */
+Person::Qualifications::Mask Person::Qualifications::toMask() const
+{
+    return mask;
+}
+
+//
+
+/*!
+ * \brief Check if possessed qualifications are equal.
+ *
+ * \param pOther Qualifications to compare with.
+ * \return If the same qualifications are possessed.
+ */
+bool Person::Qualifications::operator==(const Qualifications& pOther) const
+{
+    return mask == pOther.mask;
+}
+
+/*!
+ * \brief Check if possessed qualifications are different.
+ *
+ * \param pOther Qualifications to compare with.
+ * \return If different qualifications are possessed.
+ */
+bool Person::Qualifications::operator!=(const Qualifications& pOther) const
+{
+    return mask != pOther.mask;
+}
+
+//Private
+
+/*!
+ * \brief Parse a comma-separated qualification list.
+ *
+ * Unknown qualification strings are ignored. Does not allocate memory.
+ *
+ * \param pQualifications Comma-separated list of single qualification strings.
+ * \return Bitmask of contained qualifications.
+ */
+Person::Qualifications::Mask Person::Qualifications::parseList(const QStringView pQualifications)
+{
+    Mask tMask = 0;
+
+    for (QStringView tQuali : pQualifications.tokenize(u','))
+    {
+        int tPos = findName(tQuali, names);
+
+        if (tPos >= 0)
+            tMask |= static_cast<Mask>(1u << tPos);
+    }
+
+    return tMask;
+}
+
+/*!
+ * \brief Find a qualification string in a name table.
+ *
+ * \param pName Qualification string to find (exact match).
+ * \param pNames Name table (see \ref names or \ref legacyNames).
+ * \return Position of \p pName in \p pNames (i.e. value of Person::Qualification) or -1, if not found.
+ */
+int Person::Qualifications::findName(const QStringView pName, const std::array<const char*, count>& pNames)
+{
+    if (pName.isEmpty())
+        return -1;
+
+    for (int i = 0; i < count; ++i)
+        if (pName == QLatin1String(pNames[i]))
+            return i;
+
+    return -1;
 }
@@ -25,6 +25,11 @@
 
 #include <QString>
 #include <QStringList>
+#include <QStringView>
+
+#include <array>
+#include <cstdint>
+#include <vector>
 
 /*!
  * \brief Information about a person of (internal or external) personnel or non-personnel.
@@ -50,6 +55,7 @@ class Person
 {
 public:
     struct Qualifications;
+    enum class Qualification : int8_t;
     enum class Function : int8_t;
     enum class BoatFunction : int8_t;
 
@@ -104,36 +110,79 @@ private:
                                      char pPrefix, QString pSuffix);            ///< Create a hashed person identifier.
 
 public:
+    /*!
+     * \brief Possible qualifications.
+     *
+     * Each value is the position of the qualification's bit in Qualifications::mask
+     * and of its name in Qualifications::names.
+     *
+     * Note: Must not change order of existing qualifications here (see Qualifications::toString())!
+     */
+    enum class Qualification : int8_t
+    {
+        _EH = 0,        ///< "Erste-Hilfe-Lehrgang".
+        _DRSA_S = 1,    ///< "Deutsches Rettungsschwimmabzeichen Silber".
+        _SAN_A = 2,     ///< "Sanitätshelfer".
+        _FA_WRD = 3,    ///< "Fachausbildung Wasserrettungsdienst".
+        _BF_A = 4,      ///< "Bootsführerschein A (Binnen)".
+        _BF_B = 5,      ///< "Bootsführerschein B (See)".
+        _BOS = 6,       ///< "BOS-Sprechfunker".
+        _SR_1 = 7,      ///< "Strömungsretter 1".
+        _ET = 8,        ///< "Einsatztaucher Stufe 1 oder Stufe 2".
+        _WF = 9,        ///< "Wachführer".
+        _ZUGF = 10      ///< "Zugführer".
+    };
+    //
     /*!
      * \brief %Qualifications of a person.
      *
-     * Defines, which relevant qualifications are possessed by a person.
-     * The struct can be converted to a comma-separated string listing
-     * all possessed qualifications and can also be constructed from
-     * such a string (or an already split list of qualification strings).
+     * Defines, which relevant qualifications (see Person::Qualification) are possessed by a person.
+     * The qualifications are stored as a bitmask. The struct can be converted to a comma-separated string
+     * listing all possessed qualifications and can also be constructed from such a string (or an already
+     * split list of qualification strings). Parsing and formatting use the (constexpr) name table \ref names.
+     * Use parseBulk() to parse many (typically often identical) qualification strings at once.
      */
     struct Qualifications
     {
+        typedef uint16_t Mask;  ///< Bitmask type with one bit per Person::Qualification.
+        //
+        static constexpr int count = 11;                        ///< Number of available qualifications.
+        static constexpr std::array<const char*, count> names =
+            {"EH", "DRSA-S", "SAN-A", "FA-WRD", "BF-A", "BF-B", "BOS", "SR-1", "ET-1/2", "WF", "ZUGF"};
+                                                                ///< \brief Qualification strings indexed by
+                                                                ///  Person::Qualification.
+        static constexpr std::array<const char*, count> legacyNames =
+            {"EH", "RSA", "SAN-A", "FA-WRD", "BF", "", "BOS", "SR-1", "ET", "WF", "ZUGF"};
+                                                                ///< \brief Qualification strings used before version 1.4.0
+                                                                ///  indexed by Person::Qualification (empty if not existing).
+        //
         Qualifications(const QStringList& pQualifications); ///< Constructor.
         Qualifications(const QString& pQualifications);     ///< Constructor.
         //
+        static Qualifications fromMask(Mask pMask);         ///< Create qualifications from a bitmask.
+        static void parseBulk(const std::vector<QString>& pQualifications,
+                              std::vector<Qualifications>& pParsed);    ///< Parse many comma-separated qualification lists.
+        //
         static QStringList listAllQualifications();         ///< List all qualifications in principle available.
         //
         static QString convertLegacyQualifications(const QString& pQualifications); ///< Convert qualifications from old to new format.
         //
         QString toString() const;                           ///< Get a comma-separated list of possessed qualifications.
         //
-        bool eh,    ///< "Erste-Hilfe-Lehrgang".
-             drsaS, ///< "Deutsches Rettungsschwimmabzeichen Silber".
-             sanA,  ///< "Sanitätshelfer".
-             faWrd, ///< "Fachausbildung Wasserrettungsdienst".
-             bfA,   ///< "Bootsführerschein A (Binnen)".
-             bfB,   ///< "Bootsführerschein B (See)".
-             bos,   ///< "BOS-Sprechfunker".
-             sr1,   ///< "Strömungsretter 1".
-             et,    ///< "Einsatztaucher Stufe 1 oder Stufe 2".
-             wf,    ///< "Wachführer".
-             zf;    ///< "Zugführer".
+        bool has(Qualification pQualification) const;                   ///< Check if a qualification is possessed.
+        void set(Qualification pQualification, bool pPossessed = true); ///< Set if a qualification is possessed.
+        Mask toMask() const;                                            ///< Get the bitmask of possessed qualifications.
+        //
+        bool operator==(const Qualifications& pOther) const;            ///< Check if possessed qualifications are equal.
+        bool operator!=(const Qualifications& pOther) const;            ///< Check if possessed qualifications are different.
+
+    private:
+        static Mask parseList(QStringView pQualifications);             ///< Parse a comma-separated qualification list.
+        static int findName(QStringView pName, const std::array<const char*, count>& pNames);
+                                                                        ///< Find a qualification string in a name table.
+
+    private:
+        Mask mask;  //Bit 'i' set if qualification 'i' (see Person::Qualification) possessed
     };
     //
     /*!
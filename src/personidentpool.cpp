@@ -0,0 +1,156 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "personidentpool.h"
+
+#include <mutex>
+#include <stdexcept>
+
+//Initialize static class members
+
+std::shared_mutex PersonIdentPool::poolMutex;
+QHash<QString, PersonIdentPool::Handle> PersonIdentPool::handles;
+std::vector<QString> PersonIdentPool::idents;
+
+//Public
+
+/*!
+ * \brief Get the handle of an identifier, adding it if necessary.
+ *
+ * Returns the handle of \p pIdent, if already interned, and interns it with a new handle otherwise.
+ *
+ * \param pIdent Person identifier.
+ * \return Handle of \p pIdent.
+ */
+PersonIdentPool::Handle PersonIdentPool::intern(const QString& pIdent)
+{
+    Handle tHandle;
+
+    if (lookup(pIdent, tHandle))
+        return tHandle;
+
+    {
+        const std::unique_lock<std::shared_mutex> tLock(poolMutex);
+
+        //Might have been added by another thread in the meantime
+        auto it = handles.constFind(pIdent);
+        if (it != handles.constEnd())
+            tHandle = it.value();
+        else
+        {
+            tHandle = static_cast<Handle>(idents.size());
+
+            idents.push_back(pIdent);
+            handles.insert(pIdent, tHandle);
+        }
+    }
+
+    localHandles().insert(pIdent, tHandle);
+
+    return tHandle;
+}
+
+/*!
+ * \brief Get the handle of an identifier without adding it.
+ *
+ * Can be used for read-only lookups: If \p pIdent was never interned, no data can be keyed on its handle.
+ *
+ * \param pIdent Person identifier.
+ * \param pHandle Destination for the handle of \p pIdent.
+ * \return If \p pIdent is interned.
+ */
+bool PersonIdentPool::lookup(const QString& pIdent, Handle& pHandle)
+{
+    //Handles are never released, so a handle once found can be kept in the thread's local copy without locking
+    QHash<QString, Handle>& tLocalHandles = localHandles();
+
+    auto localIt = tLocalHandles.constFind(pIdent);
+    if (localIt != tLocalHandles.constEnd())
+    {
+        pHandle = localIt.value();
+        return true;
+    }
+
+    {
+        const std::shared_lock<std::shared_mutex> tLock(poolMutex);
+
+        auto it = handles.constFind(pIdent);
+        if (it == handles.constEnd())
+            return false;
+
+        pHandle = it.value();
+    }
+
+    tLocalHandles.insert(pIdent, pHandle);
+
+    return true;
+}
+
+/*!
+ * \brief Get the identifier of a handle.
+ *
+ * \param pHandle Handle obtained from intern() or lookup().
+ * \return Person identifier interned as \p pHandle.
+ *
+ * \throws std::out_of_range \p pHandle is not a valid handle.
+ */
+QString PersonIdentPool::ident(const Handle pHandle)
+{
+    //Identifiers are only ever appended, so the thread's local copy only needs to be extended for new handles
+    std::vector<QString>& tLocalIdents = localIdents();
+
+    if (pHandle >= tLocalIdents.size())
+    {
+        const std::shared_lock<std::shared_mutex> tLock(poolMutex);
+
+        if (pHandle >= idents.size())
+            throw std::out_of_range("Invalid person identifier handle!");
+
+        tLocalIdents.insert(tLocalIdents.end(), idents.begin() + tLocalIdents.size(), idents.end());
+    }
+
+    return tLocalIdents[pHandle];
+}
+
+//Private
+
+/*!
+ * \brief Get the calling thread's local copy of already used handles.
+ *
+ * \return Handles of identifiers already looked up or interned by the calling thread.
+ */
+QHash<QString, PersonIdentPool::Handle>& PersonIdentPool::localHandles()
+{
+    thread_local QHash<QString, Handle> tLocalHandles;
+    return tLocalHandles;
+}
+
+/*!
+ * \brief Get the calling thread's local copy of the interned identifiers.
+ *
+ * \return Identifiers indexed by their handle (up to the largest handle already used by the calling thread).
+ */
+std::vector<QString>& PersonIdentPool::localIdents()
+{
+    thread_local std::vector<QString> tLocalIdents;
+    return tLocalIdents;
+}
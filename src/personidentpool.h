@@ -0,0 +1,71 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef PERSONIDENTPOOL_H
+#define PERSONIDENTPOOL_H
+
+#include <QHash>
+#include <QString>
+
+#include <cstdint>
+#include <shared_mutex>
+#include <vector>
+
+/*!
+ * \brief Intern table mapping person identifiers to small integer handles.
+ *
+ * Each distinct person identifier (see Person) is assigned a unique, stable integer handle by intern(), such that
+ * data keyed on persons (e.g. in Report and BoatDrive) can use cheap integer comparisons instead of string comparisons.
+ * The identifier string is only needed again for I/O and display (see ident()).
+ *
+ * Handles are never released during program runtime, since any Report or BoatDrive may still hold them. The pool hence
+ * grows with the number of distinct identifiers seen since program start. This is bounded by the number
+ * of distinct (internal and external) persons in all opened reports, i.e. even batch processing of many reports
+ * (see BatchExporter, CarryoverFixer) only adds the few persons not seen before, which is why no reset is provided.
+ * Since handles are not stable across program runs, they must never be saved to files.
+ *
+ * All functions are thread-safe. Each thread additionally keeps its own copy of already used handles and identifiers,
+ * such that repeated lookups (e.g. by the identifier based Report interface) do not need to lock the shared pool.
+ */
+class PersonIdentPool
+{
+public:
+    typedef uint32_t Handle;    ///< Handle type for an interned person identifier.
+
+public:
+    PersonIdentPool() = delete;     ///< Deleted constructor.
+    //
+    static Handle intern(const QString& pIdent);                ///< Get the handle of an identifier, adding it if necessary.
+    static bool lookup(const QString& pIdent, Handle& pHandle); ///< Get the handle of an identifier without adding it.
+    static QString ident(Handle pHandle);                       ///< Get the identifier of a handle.
+
+private:
+    static QHash<QString, Handle>& localHandles();  ///< Get the calling thread's local copy of already used handles.
+    static std::vector<QString>& localIdents();     ///< Get the calling thread's local copy of the interned identifiers.
+
+private:
+    static std::shared_mutex poolMutex;             //Lock for access to the pool
+    static QHash<QString, Handle> handles;          //Handles of all interned identifiers
+    static std::vector<QString> idents;             //Interned identifiers indexed by their handle
+};
+
+#endif // PERSONIDENTPOOL_H
@@ -0,0 +1,187 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "personnelcapabilityindex.h"
+
+#include "databasecache.h"
+#include "settingscache.h"
+
+#include <cstdint>
+#include <utility>
+
+//Initialize static class members
+
+std::mutex PersonnelCapabilityIndex::currentMutex;
+std::shared_ptr<const std::vector<Person>> PersonnelCapabilityIndex::currentPersonnel;
+QString PersonnelCapabilityIndex::currentBoatmanSetting;
+std::shared_ptr<const PersonnelCapabilityIndex> PersonnelCapabilityIndex::currentIndex;
+
+//Public
+
+/*!
+ * \brief Constructor.
+ *
+ * Determines the capabilities of all persons in \p pPersonnel by looking up their qualifications in \p pCapabilityTable.
+ *
+ * \param pPersonnel Persons to build the index from.
+ * \param pCapabilityTable Capabilities for all qualification combinations (see QualificationChecker::capabilityTable()).
+ */
+PersonnelCapabilityIndex::PersonnelCapabilityIndex(std::shared_ptr<const std::vector<Person>> pPersonnel,
+                                                   const QualificationChecker::CapabilityTable& pCapabilityTable) :
+    personnel(std::move(pPersonnel))
+{
+    if (personnel == nullptr)
+        personnel = std::make_shared<const std::vector<Person>>();
+
+    capabilities.reserve(personnel->size());
+
+    for (const Person& tPerson : *personnel)
+    {
+        if (tPerson.getActive())
+            capabilities.push_back(pCapabilityTable[tPerson.getQualifications().toMask()]);
+        else
+            capabilities.push_back(0);
+    }
+}
+
+//
+
+/*!
+ * \brief Get the shared index for the current personnel.
+ *
+ * Returns an index built from the current personnel snapshot of the database cache (see DatabaseCache::personnel()).
+ * The index is shared by all callers and only rebuilt, if the snapshot or the boatman qualification setting
+ * ("app_personnel_minQualis_boatman") has changed since the last call.
+ *
+ * \return Shared capability index.
+ */
+std::shared_ptr<const PersonnelCapabilityIndex> PersonnelCapabilityIndex::current()
+{
+    std::shared_ptr<const std::vector<Person>> tPersonnel = DatabaseCache::personnel();
+    QString tBoatmanSetting = SettingsCache::getStrSetting(SettingsCache::StrSetting::_BOATMAN_REQUIRED_LICENSE);
+
+    const std::lock_guard<std::mutex> tLock(currentMutex);
+
+    if (currentIndex == nullptr || tPersonnel != currentPersonnel || tBoatmanSetting != currentBoatmanSetting)
+    {
+        currentIndex = std::make_shared<const PersonnelCapabilityIndex>(tPersonnel, QualificationChecker::capabilityTable());
+        currentPersonnel = std::move(tPersonnel);
+        currentBoatmanSetting = std::move(tBoatmanSetting);
+    }
+
+    return currentIndex;
+}
+
+//
+
+/*!
+ * \brief Find active persons qualified for a personnel function.
+ *
+ * See findPersons(QualificationChecker::Capabilities, const QString&).
+ *
+ * \param pFunction Personnel function.
+ * \param pNamePrefix Only find persons whose last or first name starts with this (case-insensitive; ignored if empty).
+ * \return Matching persons (valid as long as the index exists).
+ */
+std::vector<const Person*> PersonnelCapabilityIndex::findPersons(const Person::Function pFunction, const QString& pNamePrefix) const
+{
+    return findPersons(QualificationChecker::capability(pFunction), pNamePrefix);
+}
+
+/*!
+ * \brief Find active persons qualified for a boat function.
+ *
+ * See findPersons(QualificationChecker::Capabilities, const QString&).
+ *
+ * \param pFunction Boat function.
+ * \param pNamePrefix Only find persons whose last or first name starts with this (case-insensitive; ignored if empty).
+ * \return Matching persons (valid as long as the index exists).
+ */
+std::vector<const Person*> PersonnelCapabilityIndex::findPersons(const Person::BoatFunction pFunction,
+                                                                 const QString& pNamePrefix) const
+{
+    return findPersons(QualificationChecker::capability(pFunction), pNamePrefix);
+}
+
+/*!
+ * \brief Find active persons qualified as boatman.
+ *
+ * See findPersons(QualificationChecker::Capabilities, const QString&).
+ *
+ * \param pNamePrefix Only find persons whose last or first name starts with this (case-insensitive; ignored if empty).
+ * \return Matching persons (valid as long as the index exists).
+ */
+std::vector<const Person*> PersonnelCapabilityIndex::findBoatmen(const QString& pNamePrefix) const
+{
+    return findPersons(QualificationChecker::boatmanCapability(), pNamePrefix);
+}
+
+//
+
+/*!
+ * \brief Find active persons with all of the required capabilities.
+ *
+ * First checks the capabilities of all persons in one pass (without branches, i.e. vectorizable),
+ * then checks the name prefix only for the persons with matching capabilities.
+ *
+ * Note: Nothing is found, if \p pRequired is zero (e.g. for Person::Function::_OTHER).
+ *
+ * \param pRequired Required capabilities (see QualificationChecker::capability()).
+ * \param pNamePrefix Only find persons whose last or first name starts with this (case-insensitive; ignored if empty).
+ * \return Matching persons in personnel order (valid as long as the index exists).
+ */
+std::vector<const Person*> PersonnelCapabilityIndex::findPersons(const QualificationChecker::Capabilities pRequired,
+                                                                 const QString& pNamePrefix) const
+{
+    if (pRequired == 0)
+        return {};
+
+    const std::size_t tCount = capabilities.size();
+
+    std::vector<uint8_t> tQualified(tCount);
+
+    const QualificationChecker::Capabilities* tCapabilities = capabilities.data();
+    uint8_t* tQualifiedPtr = tQualified.data();
+
+    for (std::size_t i = 0; i < tCount; ++i)
+        tQualifiedPtr[i] = static_cast<uint8_t>((tCapabilities[i] & pRequired) == pRequired);
+
+    std::vector<const Person*> tPersons;
+
+    for (std::size_t i = 0; i < tCount; ++i)
+    {
+        if (tQualifiedPtr[i] == 0)
+            continue;
+
+        const Person& tPerson = (*personnel)[i];
+
+        if (pNamePrefix != "" && !tPerson.getLastName().startsWith(pNamePrefix, Qt::CaseInsensitive) &&
+                                 !tPerson.getFirstName().startsWith(pNamePrefix, Qt::CaseInsensitive))
+        {
+            continue;
+        }
+
+        tPersons.push_back(&tPerson);
+    }
+
+    return tPersons;
+}
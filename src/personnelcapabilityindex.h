@@ -0,0 +1,77 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef PERSONNELCAPABILITYINDEX_H
+#define PERSONNELCAPABILITYINDEX_H
+
+#include "person.h"
+#include "qualificationchecker.h"
+
+#include <QString>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*!
+ * \brief Find all active persons of the personnel database that are qualified for a specific function.
+ *
+ * Precomputes the capabilities (see QualificationChecker::capabilities()) of every person of a personnel snapshot
+ * (see DatabaseCache::personnel()) as a bitset, such that all persons qualified for a personnel function,
+ * boat function or for being a boatman can be found in a single pass over a flat array of bitsets
+ * (see findPersons(), findBoatmen()). The results can be limited to persons whose last or first name
+ * starts with a given prefix.
+ *
+ * The index is immutable once built. Use current() to obtain an index shared by all users, which is rebuilt only when
+ * the personnel snapshot of the database cache or the boatman qualification setting has changed (i.e. not on every call).
+ */
+class PersonnelCapabilityIndex
+{
+public:
+    PersonnelCapabilityIndex(std::shared_ptr<const std::vector<Person>> pPersonnel,
+                             const QualificationChecker::CapabilityTable& pCapabilityTable);    ///< Constructor.
+    //
+    static std::shared_ptr<const PersonnelCapabilityIndex> current();   ///< Get the shared index for the current personnel.
+    //
+    std::vector<const Person*> findPersons(Person::Function pFunction,
+                                           const QString& pNamePrefix = "") const;  ///< \brief Find active persons qualified
+                                                                                    ///  for a personnel function.
+    std::vector<const Person*> findPersons(Person::BoatFunction pFunction,
+                                           const QString& pNamePrefix = "") const;  ///< \brief Find active persons qualified
+                                                                                    ///  for a boat function.
+    std::vector<const Person*> findBoatmen(const QString& pNamePrefix = "") const;  ///< Find active persons qualified as boatman.
+    //
+    std::vector<const Person*> findPersons(QualificationChecker::Capabilities pRequired,
+                                           const QString& pNamePrefix = "") const;  ///< \brief Find active persons with all
+                                                                                    ///  of the required capabilities.
+
+private:
+    std::shared_ptr<const std::vector<Person>> personnel;           //Indexed persons
+    std::vector<QualificationChecker::Capabilities> capabilities;   //Capabilities of each person (zero for inactive persons)
+    //
+    static std::mutex currentMutex;                                         //Lock for access to shared index
+    static std::shared_ptr<const std::vector<Person>> currentPersonnel;     //Personnel snapshot the shared index was built from
+    static QString currentBoatmanSetting;                                   //Boatman setting the shared index was built with
+    static std::shared_ptr<const PersonnelCapabilityIndex> currentIndex;    //Shared index
+};
+
+#endif // PERSONNELCAPABILITYINDEX_H
@@ -25,22 +25,30 @@
 
 #include "auxil.h"
 #include "databasecache.h"
+#include "databasewatcher.h"
 #include "person.h"
 #include "personneleditordialog.h"
+#include "personnelimporter.h"
 #include "settingscache.h"
 
 #include <QAbstractItemView>
+#include <QApplication>
+#include <QFileDialog>
 #include <QHeaderView>
 #include <QItemSelectionModel>
 #include <QMessageBox>
 #include <QModelIndexList>
+#include <QProgressDialog>
 #include <QPushButton>
 #include <QString>
+#include <QStringList>
 #include <QTableWidget>
 
 #include <functional>
+#include <memory>
 #include <set>
 #include <thread>
+#include <vector>
 
 /*!
  * \brief Constructor.
@@ -78,8 +86,8 @@ PersonnelDatabaseDialog::PersonnelDatabaseDialog(QWidget *const pParent) :
 
     //Ask for password
 
-    QString hash = SettingsCache::getStrSetting("app_auth_hash");
-    QString salt = SettingsCache::getStrSetting("app_auth_salt");
+    QString hash = SettingsCache::getStrSetting(SettingsCache::StrSetting::_AUTH_HASH);
+    QString salt = SettingsCache::getStrSetting(SettingsCache::StrSetting::_AUTH_SALT);
 
     //Note: this is not intended to be secure...
     if (hash != "" && salt != "")
@@ -111,16 +119,21 @@ PersonnelDatabaseDialog::PersonnelDatabaseDialog(QWidget *const pParent) :
                     QMessageBox::Ok, pParent).exec();
     }
 
-    //Disable add/edit/remove buttons, if read-only or wrong password
+    //Disable add/edit/remove/import buttons, if read-only or wrong password
     if (editDisabled)
     {
         ui->add_pushButton->setEnabled(false);
         ui->edit_pushButton->setEnabled(false);
         ui->remove_pushButton->setEnabled(false);
+        ui->import_pushButton->setEnabled(false);
     }
 
     //Load personnel records into the table widget
     updatePersonnelTable();
+
+    //Update the table whenever the personnel database is changed by another application instance
+    if (DatabaseWatcher* databaseWatcher = DatabaseWatcher::instance())
+        connect(databaseWatcher, &DatabaseWatcher::personnelChanged, this, &PersonnelDatabaseDialog::updatePersonnelTable);
 }
 
 /*!
@@ -167,32 +180,29 @@ void PersonnelDatabaseDialog::updatePersonnelTable()
     };
 
     //Get available personnel from database cache
-    std::vector<Person> tPersonnel;
-    DatabaseCache::getPersonnel(tPersonnel);
+    std::shared_ptr<const std::vector<Person>> tPersonnel = DatabaseCache::personnel();
 
     //Use temporary set to sort persons using above custom sort lambda
 
     std::set<std::reference_wrapper<const Person>, decltype(cmp)> tPersonnelSorted(cmp);
 
-    for (const Person& tPerson : tPersonnel)
+    for (const Person& tPerson : *tPersonnel)
         tPersonnelSorted.insert(std::cref(tPerson));
 
-    //Clear
+    //Clear and allocate all rows at once (inserting rows one by one is slow for large personnel)
     ui->personnel_tableWidget->setRowCount(0);
+    ui->personnel_tableWidget->setRowCount(static_cast<int>(tPersonnelSorted.size()));
 
+    int tRow = 0;
     for (const Person& tPerson : tPersonnelSorted)
     {
-        QString tIdent = tPerson.getIdent();
-
-        int tOldRowCount = ui->personnel_tableWidget->rowCount();
-
-        ui->personnel_tableWidget->insertRow(tOldRowCount);
+        ui->personnel_tableWidget->setItem(tRow, 0, new QTableWidgetItem(tPerson.getIdent()));
+        ui->personnel_tableWidget->setItem(tRow, 1, new QTableWidgetItem(tPerson.getLastName()));
+        ui->personnel_tableWidget->setItem(tRow, 2, new QTableWidgetItem(tPerson.getFirstName()));
+        ui->personnel_tableWidget->setItem(tRow, 3, new QTableWidgetItem(tPerson.getQualifications().toString()));
+        ui->personnel_tableWidget->setItem(tRow, 4, new QTableWidgetItem(!tPerson.getActive() ? "Deaktiviert" : ""));
 
-        ui->personnel_tableWidget->setItem(tOldRowCount, 0, new QTableWidgetItem(tIdent));
-        ui->personnel_tableWidget->setItem(tOldRowCount, 1, new QTableWidgetItem(tPerson.getLastName()));
-        ui->personnel_tableWidget->setItem(tOldRowCount, 2, new QTableWidgetItem(tPerson.getFirstName()));
-        ui->personnel_tableWidget->setItem(tOldRowCount, 3, new QTableWidgetItem(tPerson.getQualifications().toString()));
-        ui->personnel_tableWidget->setItem(tOldRowCount, 4, new QTableWidgetItem(!tPerson.getActive() ? "Deaktiviert" : ""));
+        ++tRow;
     }
 }
 
@@ -359,6 +369,100 @@ void PersonnelDatabaseDialog::on_remove_pushButton_pressed()
     updatePersonnelTable();
 }
 
+/*!
+ * \brief Import many persons from a file into personnel.
+ *
+ * Asks for a CSV or JSON file with internal personnel records (see PersonnelImporter::readFile()),
+ * reads all records from the file and adds the persons all at once to the personnel database
+ * (see DatabaseCache::addPersons()). Reading the file shows a progress dialog, which allows to abort the import.
+ * Finally a summary is shown, whose details list all records that were skipped, including the reason.
+ *
+ * Updates the displayed personnel table afterwards.
+ *
+ * Returns immediately, if editing was disabled due to wrong password or if database is read-only.
+ */
+void PersonnelDatabaseDialog::on_import_pushButton_pressed()
+{
+    if (editDisabled || DatabaseCache::isPersonnelReadOnly())
+        return;
+
+    QString fileName = QFileDialog::getOpenFileName(this, "Personal importieren", "",
+                                                    "Personal-Listen (*.csv *.json);;Alle Dateien (*)");
+
+    if (fileName == "")
+        return;
+
+    //Read the records from the file
+
+    QProgressDialog progressDialog("Lese Datei...", "Abbrechen", 0, 1000, this);
+    progressDialog.setWindowModality(Qt::WindowModal);
+    progressDialog.setMinimumDuration(500);
+
+    auto tProgress = [&progressDialog](qint64 pDone, qint64 pTotal) -> bool
+    {
+        if (pTotal > 0)
+            progressDialog.setValue(static_cast<int>(1000 * pDone / pTotal));
+
+        return !progressDialog.wasCanceled();
+    };
+
+    std::vector<Person> tPersons;
+    std::vector<int> tRecordNumbers;
+    QStringList tErrors;
+
+    if (!PersonnelImporter::readFile(fileName, tPersons, tRecordNumbers, tErrors, tProgress))
+    {
+        progressDialog.reset();
+
+        QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Lesen der Datei!\n" + tErrors.join('\n'),
+                    QMessageBox::Ok, this).exec();
+        return;
+    }
+
+    //Add all persons at once
+
+    progressDialog.setLabelText("Schreibe Datenbank...");
+    progressDialog.setCancelButton(nullptr);
+    progressDialog.setRange(0, 0);
+    QApplication::processEvents();
+
+    std::vector<std::size_t> tInvalidPersons, tDuplicatePersons;
+
+    bool tWriteSuccess = DatabaseCache::addPersons(tPersons, tInvalidPersons, tDuplicatePersons);
+
+    progressDialog.reset();
+
+    for (std::size_t tIdx : tInvalidPersons)
+        tErrors.push_back(QString("Eintrag %1 (%2, %3): Ungültiger Name oder ungültige Mitgliedsnummer.").
+                          arg(tRecordNumbers[tIdx]).arg(tPersons[tIdx].getLastName(), tPersons[tIdx].getFirstName()));
+    for (std::size_t tIdx : tDuplicatePersons)
+        tErrors.push_back(QString("Eintrag %1 (%2, %3): Mitgliedsnummer existiert bereits.").
+                          arg(tRecordNumbers[tIdx]).arg(tPersons[tIdx].getLastName(), tPersons[tIdx].getFirstName()));
+
+    //Show summary
+
+    if (!tWriteSuccess)
+    {
+        QMessageBox msgBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Datenbank!\nEs wurde kein Personal importiert.",
+                           QMessageBox::Ok, this);
+        msgBox.setDetailedText(tErrors.join('\n'));
+        msgBox.exec();
+    }
+    else
+    {
+        std::size_t tNumImported = tPersons.size() - tInvalidPersons.size() - tDuplicatePersons.size();
+
+        QMessageBox msgBox(tErrors.isEmpty() ? QMessageBox::Information : QMessageBox::Warning, "Import",
+                           QString("%1 Personen importiert.\n%2 Einträge übersprungen.").arg(tNumImported).arg(tErrors.size()),
+                           QMessageBox::Ok, this);
+        if (!tErrors.isEmpty())
+            msgBox.setDetailedText(tErrors.join('\n'));
+        msgBox.exec();
+    }
+
+    updatePersonnelTable();
+}
+
 /*!
  * \brief Edit the selected persons.
  *
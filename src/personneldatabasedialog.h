@@ -35,7 +35,8 @@ class PersonnelDatabaseDialog;
  *
  * Displays a table containing all personnel data.
  * New persons can be added and selected existing
- * persons can be edited or removed.
+ * persons can be edited or removed. Many new persons
+ * can also be imported at once from a CSV or JSON file.
  */
 class PersonnelDatabaseDialog : public QDialog
 {
@@ -52,6 +53,7 @@ private slots:
     void on_add_pushButton_pressed();                                   ///< Add a new person to personnel.
     void on_edit_pushButton_pressed();                                  ///< Edit the selected persons.
     void on_remove_pushButton_pressed();                                ///< Remove a person from personnel.
+    void on_import_pushButton_pressed();                                ///< Import many persons from a file into personnel.
     void on_personnel_tableWidget_cellDoubleClicked(int, int);          ///< Edit the selected persons.
 
 private:
@@ -0,0 +1,365 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "personnelimporter.h"
+
+#include <QFileInfo>
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+#include <QJsonValue>
+#include <QRegularExpression>
+#include <QTextStream>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+/*!
+ * \brief Read personnel records from a CSV or JSON file.
+ *
+ * Reads all internal personnel records from file \p pFileName. The file format is chosen by the file suffix ('.json' or else CSV).
+ *
+ * A CSV file must start with a header line naming the columns, which may appear in any order. Required columns are
+ * "Nachname", "Vorname" and "Mitgliedsnummer" (or "LastName", "FirstName", "MembershipNumber"). Optional columns are
+ * "Qualifikationen"/"Qualifications" and "Status". Semicolon, comma or tab are allowed as separator (detected from the header line)
+ * and fields may be enclosed in double quotes. The file is read line by line, so quoted fields must not contain line breaks.
+ *
+ * A JSON file must contain an array of objects with string values "lastName", "firstName", "membershipNumber",
+ * optional "qualifications" (comma-separated string or array of strings) and optional boolean "active".
+ *
+ * Qualifications are specified as in Person::Qualifications::listAllQualifications(); unknown qualifications are ignored.
+ * The status is interpreted by parseStatus(). Persons are active by default.
+ *
+ * For each parsed record a Person is appended to \p pPersons and the corresponding line number (CSV) or
+ * array position (JSON, starting at 1) is appended to \p pRecordNumbers. Records that cannot be parsed are skipped
+ * and a message is appended to \p pErrors. Note that the persons' formatting is not validated here (see DatabaseCache::addPersons()).
+ *
+ * If \p pProgress is set, it is repeatedly called with the number of bytes processed so far and the total number
+ * of bytes of the file. Reading is aborted (and false returned), if \p pProgress returns false.
+ *
+ * \param pFileName Path to the file to read.
+ * \param pPersons Parsed persons.
+ * \param pRecordNumbers Record numbers of the parsed persons.
+ * \param pErrors Messages for skipped records (and for the reason of failure, if false is returned).
+ * \param pProgress Optional function to report the progress and to request an abort.
+ * \return If the file could be read (regardless of skipped records).
+ */
+bool PersonnelImporter::readFile(const QString& pFileName, std::vector<Person>& pPersons, std::vector<int>& pRecordNumbers,
+                                 QStringList& pErrors, const std::function<bool(qint64, qint64)>& pProgress)
+{
+    QFile file(pFileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        std::cerr<<"ERROR: Could not open file for reading!"<<std::endl;
+        pErrors.push_back("Datei konnte nicht geöffnet werden.");
+        return false;
+    }
+
+    bool tSuccess = false;
+
+    if (QFileInfo(pFileName).suffix().toLower() == "json")
+        tSuccess = readJSON(file, pPersons, pRecordNumbers, pErrors, pProgress);
+    else
+        tSuccess = readCSV(file, pPersons, pRecordNumbers, pErrors, pProgress);
+
+    file.close();
+
+    return tSuccess;
+}
+
+//Private
+
+/*!
+ * \brief Read personnel records from a CSV file.
+ *
+ * See readFile().
+ *
+ * \param pFile Opened CSV file.
+ * \param pPersons Parsed persons.
+ * \param pRecordNumbers Line numbers of the parsed persons.
+ * \param pErrors Messages for skipped records (and for the reason of failure, if false is returned).
+ * \param pProgress Optional function to report the progress and to request an abort.
+ * \return If the file could be read.
+ */
+bool PersonnelImporter::readCSV(QFile& pFile, std::vector<Person>& pPersons, std::vector<int>& pRecordNumbers,
+                                QStringList& pErrors, const std::function<bool(qint64, qint64)>& pProgress)
+{
+    static const QRegularExpression qualisSeparatorRegEx("[,;\\s]+");
+
+    QTextStream tStream(&pFile);
+
+    //Read header line and detect the separator
+
+    QString tLine;
+    if (!tStream.readLineInto(&tLine))
+    {
+        pErrors.push_back("Datei ist leer.");
+        return false;
+    }
+
+    QChar tSeparator = ';';
+    for (QChar tChar : {QChar(','), QChar('\t')})
+        if (tLine.count(tChar) > tLine.count(tSeparator))
+            tSeparator = tChar;
+
+    //Find the columns (last name, first name, membership number, qualifications, status)
+
+    std::array<int, 5> tColumns = {-1, -1, -1, -1, -1};
+    const std::array<QStringList, 5> tColumnNames = {QStringList{"nachname", "lastname"},
+                                                     QStringList{"vorname", "firstname"},
+                                                     QStringList{"mitgliedsnummer", "membershipnumber"},
+                                                     QStringList{"qualifikationen", "qualifications"},
+                                                     QStringList{"status"}};
+
+    QStringList tHeader = splitCSVLine(tLine, tSeparator);
+    for (int i = 0; i < tHeader.size(); ++i)
+        for (std::size_t j = 0; j < tColumnNames.size(); ++j)
+            if (tColumns[j] == -1 && tColumnNames[j].contains(tHeader[i].trimmed().toLower()))
+                tColumns[j] = i;
+
+    if (tColumns[0] == -1 || tColumns[1] == -1 || tColumns[2] == -1)
+    {
+        pErrors.push_back("Spalten \"Nachname\", \"Vorname\" oder \"Mitgliedsnummer\" fehlen.");
+        return false;
+    }
+
+    int tMinColumns = 1 + *std::max_element(tColumns.begin(), tColumns.end());
+
+    //Read the records line by line
+
+    int tLineNumber = 1;
+    while (tStream.readLineInto(&tLine))
+    {
+        ++tLineNumber;
+
+        if (pProgress && tLineNumber % 1000 == 0 && !pProgress(pFile.pos(), pFile.size()))
+        {
+            pErrors.push_back("Import abgebrochen.");
+            return false;
+        }
+
+        if (tLine.trimmed().isEmpty())
+            continue;
+
+        QStringList tFields = splitCSVLine(tLine, tSeparator);
+
+        if (tFields.size() < tMinColumns)
+        {
+            pErrors.push_back(QString("Zeile %1: Zu wenige Spalten.").arg(tLineNumber));
+            continue;
+        }
+
+        bool tActive = true;
+        if (tColumns[4] != -1 && !parseStatus(tFields[tColumns[4]], tActive))
+        {
+            pErrors.push_back(QString("Zeile %1: Unbekannter Status \"%2\".").arg(tLineNumber).arg(tFields[tColumns[4]]));
+            continue;
+        }
+
+        QStringList tQualis;
+        if (tColumns[3] != -1)
+            tQualis = tFields[tColumns[3]].split(qualisSeparatorRegEx, Qt::SkipEmptyParts);
+
+        pPersons.push_back(createPerson(tFields[tColumns[0]], tFields[tColumns[1]], tFields[tColumns[2]], tQualis, tActive));
+        pRecordNumbers.push_back(tLineNumber);
+    }
+
+    if (pProgress)
+        pProgress(pFile.size(), pFile.size());
+
+    return true;
+}
+
+/*!
+ * \brief Read personnel records from a JSON file.
+ *
+ * See readFile().
+ *
+ * \param pFile Opened JSON file.
+ * \param pPersons Parsed persons.
+ * \param pRecordNumbers Array positions (starting at 1) of the parsed persons.
+ * \param pErrors Messages for skipped records (and for the reason of failure, if false is returned).
+ * \param pProgress Optional function to report the progress and to request an abort.
+ * \return If the file could be read.
+ */
+bool PersonnelImporter::readJSON(QFile& pFile, std::vector<Person>& pPersons, std::vector<int>& pRecordNumbers,
+                                 QStringList& pErrors, const std::function<bool(qint64, qint64)>& pProgress)
+{
+    if (pProgress && !pProgress(0, pFile.size()))
+    {
+        pErrors.push_back("Import abgebrochen.");
+        return false;
+    }
+
+    QJsonParseError tParseError;
+    QJsonDocument jsonDoc = QJsonDocument::fromJson(pFile.readAll(), &tParseError);
+
+    if (tParseError.error != QJsonParseError::NoError || !jsonDoc.isArray())
+    {
+        std::cerr<<"ERROR: Could not read personnel from file!"<<std::endl;
+        pErrors.push_back("Datei enthält keine gültige Personal-Liste.");
+        return false;
+    }
+
+    const QJsonArray jsonArray = jsonDoc.array();
+
+    for (int i = 0; i < jsonArray.size(); ++i)
+    {
+        int tRecordNumber = i + 1;
+
+        if (pProgress && tRecordNumber % 1000 == 0 &&
+            !pProgress(pFile.size() * tRecordNumber / jsonArray.size(), pFile.size()))
+        {
+            pErrors.push_back("Import abgebrochen.");
+            return false;
+        }
+
+        QJsonObject jsonObj = jsonArray.at(i).toObject();
+
+        if (!jsonObj.value("lastName").isString() || !jsonObj.value("firstName").isString() ||
+            !jsonObj.value("membershipNumber").isString())
+        {
+            pErrors.push_back(QString("Eintrag %1: Name oder Mitgliedsnummer fehlt.").arg(tRecordNumber));
+            continue;
+        }
+
+        QStringList tQualis;
+        if (jsonObj.value("qualifications").isString())
+            tQualis = jsonObj.value("qualifications").toString().split(',', Qt::SkipEmptyParts);
+        else if (jsonObj.value("qualifications").isArray())
+        {
+            for (const QJsonValue& tQuali : jsonObj.value("qualifications").toArray())
+                tQualis.push_back(tQuali.toString());
+        }
+
+        bool tActive = jsonObj.value("active").toBool(true);
+
+        pPersons.push_back(createPerson(jsonObj.value("lastName").toString(), jsonObj.value("firstName").toString(),
+                                        jsonObj.value("membershipNumber").toString(), tQualis, tActive));
+        pRecordNumbers.push_back(tRecordNumber);
+    }
+
+    if (pProgress)
+        pProgress(pFile.size(), pFile.size());
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Split a CSV line into its (unquoted) fields.
+ *
+ * Splits \p pLine at each \p pSeparator that is not enclosed in double quotes.
+ * Enclosing double quotes are removed from the fields and escaped double quotes ("") are unescaped.
+ *
+ * \param pLine CSV line.
+ * \param pSeparator Field separator.
+ * \return List of fields.
+ */
+QStringList PersonnelImporter::splitCSVLine(const QString& pLine, const QChar pSeparator)
+{
+    QStringList tFields;
+    QString tField;
+
+    bool tQuoted = false;
+
+    for (int i = 0; i < pLine.size(); ++i)
+    {
+        QChar tChar = pLine.at(i);
+
+        if (tChar == '"')
+        {
+            if (tQuoted && i + 1 < pLine.size() && pLine.at(i + 1) == '"')
+            {
+                tField.append('"');
+                ++i;
+            }
+            else
+                tQuoted = !tQuoted;
+        }
+        else if (tChar == pSeparator && !tQuoted)
+        {
+            tFields.push_back(tField);
+            tField.clear();
+        }
+        else
+            tField.append(tChar);
+    }
+
+    tFields.push_back(tField);
+
+    return tFields;
+}
+
+/*!
+ * \brief Interpret a person's status field.
+ *
+ * An empty status as well as "0", "aktiv" and "active" mean active.
+ * "1", "deaktiviert", "inaktiv" and "inactive" mean not active.
+ *
+ * \param pStatus Status field.
+ * \param pActive Is the person active?
+ * \return If \p pStatus could be interpreted.
+ */
+bool PersonnelImporter::parseStatus(const QString& pStatus, bool& pActive)
+{
+    QString tStatus = pStatus.trimmed().toLower();
+
+    if (tStatus == "" || tStatus == "0" || tStatus == "aktiv" || tStatus == "active")
+        pActive = true;
+    else if (tStatus == "1" || tStatus == "deaktiviert" || tStatus == "inaktiv" || tStatus == "inactive")
+        pActive = false;
+    else
+        return false;
+
+    return true;
+}
+
+/*!
+ * \brief Create a person from the record fields.
+ *
+ * Leading and trailing spaces are removed from all fields.
+ *
+ * \param pLastName Last name.
+ * \param pFirstName First name.
+ * \param pMembershipNumber Membership number.
+ * \param pQualifications List of qualifications.
+ * \param pActive Is the person active?
+ * \return New internal person.
+ */
+Person PersonnelImporter::createPerson(const QString& pLastName, const QString& pFirstName, const QString& pMembershipNumber,
+                                       const QStringList& pQualifications, const bool pActive)
+{
+    QString tLastName = pLastName.trimmed();
+    QString tFirstName = pFirstName.trimmed();
+
+    QStringList tQualis;
+    for (const QString& tQuali : pQualifications)
+        tQualis.push_back(tQuali.trimmed().toUpper());
+
+    return Person(tLastName, tFirstName, Person::createInternalIdent(tLastName, tFirstName, pMembershipNumber.trimmed()),
+                  Person::Qualifications(tQualis), pActive);
+}
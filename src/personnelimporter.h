@@ -0,0 +1,67 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef PERSONNELIMPORTER_H
+#define PERSONNELIMPORTER_H
+
+#include "person.h"
+
+#include <QChar>
+#include <QFile>
+#include <QString>
+#include <QStringList>
+
+#include <functional>
+#include <vector>
+
+/*!
+ * \brief Read many internal personnel records from a CSV or JSON file for a bulk import.
+ *
+ * Parses a personnel list exported e.g. from the association's membership management and creates
+ * a Person for each valid record, which can then be added to the personnel database all at once
+ * via DatabaseCache::addPersons(). Records that cannot be parsed are skipped and reported.
+ * See readFile() for the supported file formats.
+ */
+class PersonnelImporter
+{
+public:
+    PersonnelImporter() = delete;   ///< Deleted constructor.
+    //
+    static bool readFile(const QString& pFileName, std::vector<Person>& pPersons, std::vector<int>& pRecordNumbers,
+                         QStringList& pErrors, const std::function<bool(qint64, qint64)>& pProgress = nullptr);
+                                                                                    ///< Read personnel records from a CSV or JSON file.
+
+private:
+    static bool readCSV(QFile& pFile, std::vector<Person>& pPersons, std::vector<int>& pRecordNumbers,
+                        QStringList& pErrors, const std::function<bool(qint64, qint64)>& pProgress);
+                                                                                    ///< Read personnel records from a CSV file.
+    static bool readJSON(QFile& pFile, std::vector<Person>& pPersons, std::vector<int>& pRecordNumbers,
+                         QStringList& pErrors, const std::function<bool(qint64, qint64)>& pProgress);
+                                                                                    ///< Read personnel records from a JSON file.
+    //
+    static QStringList splitCSVLine(const QString& pLine, QChar pSeparator);        ///< Split a CSV line into its (unquoted) fields.
+    static bool parseStatus(const QString& pStatus, bool& pActive);                 ///< Interpret a person's status field.
+    static Person createPerson(const QString& pLastName, const QString& pFirstName, const QString& pMembershipNumber,
+                               const QStringList& pQualifications, bool pActive);   ///< Create a person from the record fields.
+};
+
+#endif // PERSONNELIMPORTER_H
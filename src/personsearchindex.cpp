@@ -0,0 +1,291 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "personsearchindex.h"
+
+#include "databasecache.h"
+
+#include <algorithm>
+#include <utility>
+
+//Initialize static class members
+
+std::mutex PersonSearchIndex::currentMutex;
+std::shared_ptr<const std::vector<Person>> PersonSearchIndex::currentPersonnel;
+std::shared_ptr<const PersonSearchIndex> PersonSearchIndex::currentIndex;
+
+//Public
+
+/*!
+ * \brief Constructor.
+ *
+ * Builds the inverted trigram index for all persons in \p pPersonnel (names and, for internal persons, membership numbers).
+ *
+ * \param pPersonnel Persons to build the index from.
+ */
+PersonSearchIndex::PersonSearchIndex(std::shared_ptr<const std::vector<Person>> pPersonnel) :
+    personnel(std::move(pPersonnel))
+{
+    if (personnel == nullptr)
+        personnel = std::make_shared<const std::vector<Person>>();
+
+    //Collect (trigram, person) pairs of all persons; sort them afterwards instead of using a hash map of growing lists
+
+    std::vector<std::pair<uint64_t, uint32_t>> tPairs;
+    tPairs.reserve(personnel->size() * 16);
+
+    trigramCounts.reserve(personnel->size());
+
+    std::vector<uint64_t> tTrigrams;
+
+    for (std::size_t i = 0; i < personnel->size(); ++i)
+    {
+        const Person& tPerson = (*personnel)[i];
+
+        QString tText = tPerson.getLastName() + ' ' + tPerson.getFirstName();
+
+        if (Person::isInternalIdent(tPerson.getIdent()))
+            tText.append(' ' + Person::extractMembershipNumber(tPerson.getIdent()));
+
+        tTrigrams.clear();
+        appendTrigrams(tText, tTrigrams, true);
+
+        std::sort(tTrigrams.begin(), tTrigrams.end());
+        tTrigrams.erase(std::unique(tTrigrams.begin(), tTrigrams.end()), tTrigrams.end());
+
+        trigramCounts.push_back(static_cast<uint16_t>(std::min<std::size_t>(tTrigrams.size(), UINT16_MAX)));
+
+        for (uint64_t tTrigram : tTrigrams)
+            tPairs.push_back({tTrigram, static_cast<uint32_t>(i)});
+    }
+
+    std::sort(tPairs.begin(), tPairs.end());
+
+    //Store postings contiguously per trigram
+
+    postings.reserve(tPairs.size());
+
+    for (std::size_t i = 0; i < tPairs.size(); ++i)
+    {
+        if (i == 0 || tPairs[i].first != tPairs[i-1].first)
+        {
+            trigramKeys.push_back(tPairs[i].first);
+            postingOffsets.push_back(static_cast<uint32_t>(i));
+        }
+
+        postings.push_back(tPairs[i].second);
+    }
+
+    postingOffsets.push_back(static_cast<uint32_t>(postings.size()));
+}
+
+//
+
+/*!
+ * \brief Get the shared index for the current personnel.
+ *
+ * Returns an index built from the current personnel snapshot of the database cache (see DatabaseCache::personnel()).
+ * The index is shared by all callers and only rebuilt, if the snapshot has changed since the last call.
+ *
+ * \return Shared person search index.
+ */
+std::shared_ptr<const PersonSearchIndex> PersonSearchIndex::current()
+{
+    std::shared_ptr<const std::vector<Person>> tPersonnel = DatabaseCache::personnel();
+
+    const std::lock_guard<std::mutex> tLock(currentMutex);
+
+    if (currentIndex == nullptr || tPersonnel != currentPersonnel)
+    {
+        currentIndex = std::make_shared<const PersonSearchIndex>(tPersonnel);
+        currentPersonnel = std::move(tPersonnel);
+    }
+
+    return currentIndex;
+}
+
+//
+
+/*!
+ * \brief Find the persons most similar to a query.
+ *
+ * Ranks all persons sharing at least one trigram with \p pQuery and returns the best \p pMaxResults persons
+ * with a score of at least \p pMinScore (in order of descending score). The score is mainly given by the fraction
+ * of the query's trigrams found for the person (such that a short query matching only one of several words of
+ * the person still ranks high) and to a smaller part by the Dice coefficient of the query's and the person's
+ * trigram sets (preferring persons without additional, non-matching words). The query may contain (parts of)
+ * last name, first name and membership number in any order. See also the class description.
+ *
+ * \param pQuery Search text.
+ * \param pMaxResults Maximum number of returned matches.
+ * \param pActiveOnly Only return persons set active.
+ * \param pMinScore Minimum score of returned matches.
+ * \return Matching persons ordered by descending score.
+ */
+std::vector<PersonSearchIndex::Match> PersonSearchIndex::search(const QString& pQuery, const std::size_t pMaxResults,
+                                                                const bool pActiveOnly, const double pMinScore) const
+{
+    std::vector<uint64_t> tQueryTrigrams;
+    appendTrigrams(pQuery, tQueryTrigrams, false);
+
+    std::sort(tQueryTrigrams.begin(), tQueryTrigrams.end());
+    tQueryTrigrams.erase(std::unique(tQueryTrigrams.begin(), tQueryTrigrams.end()), tQueryTrigrams.end());
+
+    if (tQueryTrigrams.empty() || pMaxResults == 0)
+        return {};
+
+    //Count shared trigrams for each person that shares any trigram with the query
+
+    std::vector<uint16_t> tHits(personnel->size(), 0);
+    std::vector<uint32_t> tCandidates;
+
+    for (uint64_t tTrigram : tQueryTrigrams)
+    {
+        auto it = std::lower_bound(trigramKeys.begin(), trigramKeys.end(), tTrigram);
+
+        if (it == trigramKeys.end() || *it != tTrigram)
+            continue;
+
+        std::size_t tKeyPos = static_cast<std::size_t>(it - trigramKeys.begin());
+
+        for (uint32_t i = postingOffsets[tKeyPos]; i < postingOffsets[tKeyPos+1]; ++i)
+        {
+            uint32_t tPersonPos = postings[i];
+
+            if (tHits[tPersonPos]++ == 0)
+                tCandidates.push_back(tPersonPos);
+        }
+    }
+
+    //Rank candidates by query coverage and Dice coefficient
+
+    std::vector<Match> tMatches;
+
+    for (uint32_t tPersonPos : tCandidates)
+    {
+        const Person& tPerson = (*personnel)[tPersonPos];
+
+        if (pActiveOnly && !tPerson.getActive())
+            continue;
+
+        double tCoverage = static_cast<double>(tHits[tPersonPos]) / tQueryTrigrams.size();
+        double tDice = 2.0 * tHits[tPersonPos] / (tQueryTrigrams.size() + trigramCounts[tPersonPos]);
+
+        double tScore = 0.8 * tCoverage + 0.2 * tDice;
+
+        if (tScore >= pMinScore)
+            tMatches.push_back({&tPerson, tScore});
+    }
+
+    auto tCompare = [](const Match& pFirst, const Match& pSecond) -> bool
+    {
+        if (pFirst.score != pSecond.score)
+            return pFirst.score > pSecond.score;
+
+        if (pFirst.person->getLastName() != pSecond.person->getLastName())
+            return pFirst.person->getLastName() < pSecond.person->getLastName();
+
+        return pFirst.person->getFirstName() < pSecond.person->getFirstName();
+    };
+
+    std::size_t tNumResults = std::min(pMaxResults, tMatches.size());
+
+    std::partial_sort(tMatches.begin(), tMatches.begin() + tNumResults, tMatches.end(), tCompare);
+    tMatches.resize(tNumResults);
+
+    return tMatches;
+}
+
+//
+
+/*!
+ * \brief Normalize text for comparison.
+ *
+ * Folds case, replaces "ß" by "ss" and removes diacritics (e.g. "Müller" becomes "muller").
+ *
+ * \param pText Text to normalize.
+ * \return Normalized text.
+ */
+QString PersonSearchIndex::normalize(const QString& pText)
+{
+    QString tDecomposed = pText.toCaseFolded().replace(QChar(0x00DF), "ss").normalized(QString::NormalizationForm_D);
+
+    QString tNormalized;
+    tNormalized.reserve(tDecomposed.size());
+
+    for (QChar tChar : tDecomposed)
+        if (tChar.category() != QChar::Mark_NonSpacing)
+            tNormalized.append(tChar);
+
+    return tNormalized;
+}
+
+//Private
+
+/*!
+ * \brief Add all (padded) trigrams of the words of a text.
+ *
+ * Normalizes \p pText (see normalize()) and splits it into words of letters and digits. Each word is padded
+ * by two blanks at the front and one blank at the end (except for the last word, if \p pLastWordComplete is false)
+ * and all trigrams of the padded word are appended to \p pTrigrams (three UTF-16 code units packed into an integer).
+ *
+ * \param pText Text to split into trigrams.
+ * \param pTrigrams Destination for trigrams (appended).
+ * \param pLastWordComplete Pad the last word at its end.
+ */
+void PersonSearchIndex::appendTrigrams(const QString& pText, std::vector<uint64_t>& pTrigrams, const bool pLastWordComplete)
+{
+    const QString tText = normalize(pText);
+
+    auto tPack = [](char16_t pFirst, char16_t pSecond, char16_t pThird) -> uint64_t
+    {
+        return (static_cast<uint64_t>(pFirst) << 32) | (static_cast<uint64_t>(pSecond) << 16) | static_cast<uint64_t>(pThird);
+    };
+
+    int tPos = 0;
+    while (tPos < tText.size())
+    {
+        if (!tText[tPos].isLetterOrNumber())
+        {
+            ++tPos;
+            continue;
+        }
+
+        int tEnd = tPos;
+        while (tEnd < tText.size() && tText[tEnd].isLetterOrNumber())
+            ++tEnd;
+
+        bool tPadEnd = pLastWordComplete || tEnd < tText.size();
+
+        //Word with padding: "  " + word + " "
+        std::vector<char16_t> tPadded = {u' ', u' '};
+        for (int i = tPos; i < tEnd; ++i)
+            tPadded.push_back(tText[i].unicode());
+        if (tPadEnd)
+            tPadded.push_back(u' ');
+
+        for (std::size_t i = 0; i + 2 < tPadded.size(); ++i)
+            pTrigrams.push_back(tPack(tPadded[i], tPadded[i+1], tPadded[i+2]));
+
+        tPos = tEnd;
+    }
+}
@@ -0,0 +1,88 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef PERSONSEARCHINDEX_H
+#define PERSONSEARCHINDEX_H
+
+#include "person.h"
+
+#include <QString>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*!
+ * \brief Typo-tolerant (trigram based) search index over the names and membership numbers of the personnel database.
+ *
+ * Splits the last name, first name and membership number of every person of a personnel snapshot
+ * (see DatabaseCache::personnel()) into words, normalizes them (see normalize()) and stores all trigrams
+ * (i.e. all sequences of three characters of each word, padded by blanks) in an inverted index.
+ * A search (see search()) splits the query in the same way and ranks all persons sharing trigrams with the query
+ * by their similarity (mainly the fraction of the query's trigrams found), such that e.g. "Meier" also finds "Maier" or "Mayer".
+ * The last word of the query is treated as incomplete (not padded at its end), such that results are useful
+ * already while the user is still typing.
+ *
+ * The index is immutable once built. Use current() to obtain an index shared by all users, which is rebuilt only
+ * when the personnel snapshot of the database cache has changed (i.e. not on every call).
+ */
+class PersonSearchIndex
+{
+public:
+    /*!
+     * \brief A search result.
+     */
+    struct Match
+    {
+        const Person* person;   ///< Matching person (valid as long as the index exists).
+        double score;           ///< Similarity between 0 (no match) and 1 (identical trigrams).
+    };
+
+public:
+    explicit PersonSearchIndex(std::shared_ptr<const std::vector<Person>> pPersonnel);  ///< Constructor.
+    //
+    static std::shared_ptr<const PersonSearchIndex> current();          ///< Get the shared index for the current personnel.
+    //
+    std::vector<Match> search(const QString& pQuery, std::size_t pMaxResults, bool pActiveOnly,
+                              double pMinScore = 0.3) const;           ///< Find the persons most similar to a query.
+    //
+    static QString normalize(const QString& pText);                     ///< Normalize text for comparison.
+
+private:
+    static void appendTrigrams(const QString& pText, std::vector<uint64_t>& pTrigrams,
+                               bool pLastWordComplete);                 ///< Add all (padded) trigrams of the words of a text.
+
+private:
+    std::shared_ptr<const std::vector<Person>> personnel;   //Indexed persons
+    //
+    std::vector<uint64_t> trigramKeys;      //Distinct trigrams (sorted)
+    std::vector<uint32_t> postingOffsets;   //Begin of postings of each trigram in 'postings' (plus end)
+    std::vector<uint32_t> postings;         //Positions of persons (in 'personnel') containing the trigrams
+    std::vector<uint16_t> trigramCounts;    //Number of distinct trigrams of each person
+    //
+    static std::mutex currentMutex;                                     //Lock for access to shared index
+    static std::shared_ptr<const std::vector<Person>> currentPersonnel; //Personnel snapshot the shared index was built from
+    static std::shared_ptr<const PersonSearchIndex> currentIndex;       //Shared index
+};
+
+#endif // PERSONSEARCHINDEX_H
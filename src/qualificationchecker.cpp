@@ -29,54 +29,78 @@
 /*!
  * \brief Check if a person is qualified for a certain personnel function.
  *
+ * Note: Reads the boatman setting "app_personnel_minQualis_boatman" for Person::Function::_SL and Person::Function::_BF
+ * (see checkBoatman(const Person::Qualifications&)).
+ *
  * \param pFunction Requested personnel function.
  * \param pQualifications Qualifications of concerned person.
  * \return If \p pFunction is allowed according to \p pQualifications.
  */
 bool QualificationChecker::checkPersonnelFunction(const Person::Function pFunction, const Person::Qualifications& pQualifications)
+{
+    //Only look up the boatman setting, if actually needed
+    if (pFunction == Person::Function::_SL || pFunction == Person::Function::_BF)
+        return checkBoatman(pQualifications);
+
+    return checkPersonnelFunction(pFunction, pQualifications, "");
+}
+
+/*!
+ * \brief Check if a person is qualified for a certain personnel function.
+ *
+ * Same as checkPersonnelFunction(Person::Function, const Person::Qualifications&) but with the required boat license
+ * for boatman-dependent functions explicitly passed instead of read from the settings. Hence this can be called from any thread.
+ *
+ * \param pFunction Requested personnel function.
+ * \param pQualifications Qualifications of concerned person.
+ * \param pBoatmanRequiredLicense Required boat license for boatman (see checkBoatman(const Person::Qualifications&, const QString&)).
+ * \return If \p pFunction is allowed according to \p pQualifications.
+ */
+bool QualificationChecker::checkPersonnelFunction(const Person::Function pFunction, const Person::Qualifications& pQualifications,
+                                                  const QString& pBoatmanRequiredLicense)
 {
     switch (pFunction)
     {
         case Person::Function::_WF:
-            if (pQualifications.wf)
+            if (pQualifications.has(Person::Qualification::_WF))
                 return true;
             return false;
         case Person::Function::_SL:
-            if (checkBoatman(pQualifications))
+            if (checkBoatman(pQualifications, pBoatmanRequiredLicense))
                 return true;
             return false;
         case Person::Function::_BF:
-            if (checkBoatman(pQualifications))
+            if (checkBoatman(pQualifications, pBoatmanRequiredLicense))
                 return true;
             return false;
         case Person::Function::_WR:
-            if (pQualifications.faWrd)
+            if (pQualifications.has(Person::Qualification::_FA_WRD))
                 return true;
             return false;
         case Person::Function::_RS:
-            if (pQualifications.drsaS)
+            if (pQualifications.has(Person::Qualification::_DRSA_S))
                 return true;
             return false;
         case Person::Function::_PR:
             return true;
         case Person::Function::_SAN:
-            if (pQualifications.sanA)
+            if (pQualifications.has(Person::Qualification::_SAN_A))
                 return true;
             return false;
         case Person::Function::_FU:
-            if (pQualifications.bos)
+            if (pQualifications.has(Person::Qualification::_BOS))
                 return true;
             return false;
         case Person::Function::_SR:
-            if (pQualifications.sr1)
+            if (pQualifications.has(Person::Qualification::_SR_1))
                 return true;
             return false;
         case Person::Function::_ET:
-            if (pQualifications.et)
+            if (pQualifications.has(Person::Qualification::_ET))
                 return true;
             return false;
         case Person::Function::_FUD:
-            if (pQualifications.zf)
+            if (pQualifications.has(Person::Qualification::_ZUGF))
                 return true;
             return false;
         case Person::Function::_OTHER:
@@ -98,25 +122,25 @@ bool QualificationChecker::checkBoatFunction(const Person::BoatFunction pFunctio
     switch (pFunction)
     {
         case Person::BoatFunction::_BG:
-            if (pQualifications.faWrd)
+            if (pQualifications.has(Person::Qualification::_FA_WRD))
                 return true;
             return false;
         case Person::BoatFunction::_RS:
-            if (pQualifications.drsaS)
+            if (pQualifications.has(Person::Qualification::_DRSA_S))
                 return true;
             return false;
         case Person::BoatFunction::_PR:
             return true;
         case Person::BoatFunction::_SAN:
-            if (pQualifications.sanA)
+            if (pQualifications.has(Person::Qualification::_SAN_A))
                 return true;
             return false;
         case Person::BoatFunction::_SR:
-            if (pQualifications.sr1)
+            if (pQualifications.has(Person::Qualification::_SR_1))
                 return true;
             return false;
         case Person::BoatFunction::_ET:
-            if (pQualifications.et)
+            if (pQualifications.has(Person::Qualification::_ET))
                 return true;
             return false;
         case Person::BoatFunction::_OTHER:
@@ -134,16 +158,166 @@ bool QualificationChecker::checkBoatFunction(const Person::BoatFunction pFunctio
  */
 bool QualificationChecker::checkBoatman(const Person::Qualifications& pQualifications)
 {
-    QString boatmanRequiredLicense = SettingsCache::getStrSetting("app_personnel_minQualis_boatman");
+    return checkBoatman(pQualifications, boatmanRequiredLicense());
+}
 
-    if (boatmanRequiredLicense == "A")
-        return pQualifications.bfA;
-    else if (boatmanRequiredLicense == "B")
-        return pQualifications.bfB;
-    else if (boatmanRequiredLicense == "A&B")
-        return pQualifications.bfA && pQualifications.bfB;
-    else if (boatmanRequiredLicense == "A|B")
-        return pQualifications.bfA || pQualifications.bfB;
+/*!
+ * \brief Check if a person is qualified to be a boatman.
+ *
+ * Same as checkBoatman(const Person::Qualifications&) but with the required boat license explicitly passed
+ * instead of read from the settings. Hence this can be called from any thread.
+ *
+ * \param pQualifications Qualifications of concerned person.
+ * \param pRequiredLicense Required boat license ("A", "B", "A&B" or "A|B"; see setting "app_personnel_minQualis_boatman").
+ * \return If person is allowed to be a boatman according to \p pQualifications.
+ */
+bool QualificationChecker::checkBoatman(const Person::Qualifications& pQualifications, const QString& pRequiredLicense)
+{
+    if (pRequiredLicense == "A")
+        return pQualifications.has(Person::Qualification::_BF_A);
+    else if (pRequiredLicense == "B")
+        return pQualifications.has(Person::Qualification::_BF_B);
+    else if (pRequiredLicense == "A&B")
+        return pQualifications.has(Person::Qualification::_BF_A) && pQualifications.has(Person::Qualification::_BF_B);
+    else if (pRequiredLicense == "A|B")
+        return pQualifications.has(Person::Qualification::_BF_A) || pQualifications.has(Person::Qualification::_BF_B);
 
     return false;
 }
+
+/*!
+ * \brief Get the boat license required for being a boatman.
+ *
+ * Reads the setting "app_personnel_minQualis_boatman" (see SettingsCache::getStrSetting()).
+ *
+ * Note: Must be called from the main thread, since the setting may need to be (re-)written to the database.
+ * Code running in other threads should get the license beforehand and use the functions taking it as argument
+ * (e.g. checkBoatman(const Person::Qualifications&, const QString&)).
+ *
+ * \param pNoMsgBox Suppress warning message boxes.
+ * \return Required boat license ("A", "B", "A&B" or "A|B").
+ */
+QString QualificationChecker::boatmanRequiredLicense(const bool pNoMsgBox)
+{
+    return SettingsCache::getStrSetting(SettingsCache::StrSetting::_BOATMAN_REQUIRED_LICENSE, pNoMsgBox);
+}
+
+//
+
+/*!
+ * \brief Get the capability bit of a personnel function.
+ *
+ * \param pFunction Personnel function.
+ * \return Bit set in capabilities() if a person is qualified for \p pFunction (zero for Person::Function::_OTHER).
+ */
+QualificationChecker::Capabilities QualificationChecker::capability(const Person::Function pFunction)
+{
+    if (pFunction == Person::Function::_OTHER)
+        return 0;
+
+    //Bits 0 to 15 (functions have values 0 to 10)
+    return static_cast<Capabilities>(1u << static_cast<int>(pFunction));
+}
+
+/*!
+ * \brief Get the capability bit of a boat function.
+ *
+ * \param pFunction Boat function.
+ * \return Bit set in capabilities() if a person is qualified for \p pFunction
+ *         (zero for Person::BoatFunction::_EXT and Person::BoatFunction::_OTHER).
+ */
+QualificationChecker::Capabilities QualificationChecker::capability(const Person::BoatFunction pFunction)
+{
+    if (pFunction == Person::BoatFunction::_EXT || pFunction == Person::BoatFunction::_OTHER)
+        return 0;
+
+    //Bits 16 to 30 (boat functions have values 1 to 6)
+    return static_cast<Capabilities>(1u << (16 + static_cast<int>(pFunction)));
+}
+
+/*!
+ * \brief Get the capability bit of being a boatman.
+ *
+ * \return Bit set in capabilities() if a person is qualified to be a boatman (see checkBoatman()).
+ */
+QualificationChecker::Capabilities QualificationChecker::boatmanCapability()
+{
+    return static_cast<Capabilities>(1u << 31);
+}
+
+//
+
+/*!
+ * \brief Get all functions a person is qualified for.
+ *
+ * Combines the capability bits (see capability() and boatmanCapability()) of all personnel functions and boat
+ * functions a person with qualifications \p pQualifications is qualified for and of being a boatman.
+ *
+ * \param pQualifications Qualifications of concerned person.
+ * \return Capabilities bitset.
+ */
+QualificationChecker::Capabilities QualificationChecker::capabilities(const Person::Qualifications& pQualifications)
+{
+    return capabilities(pQualifications, boatmanRequiredLicense());
+}
+
+/*!
+ * \brief Get the capabilities for all qualification combinations.
+ *
+ * Computes capabilities() for every possible qualifications bitmask (see Person::Qualifications::toMask()),
+ * such that the capabilities of many persons can be determined by simple table lookups.
+ *
+ * Note: The table depends on the boatman setting "app_personnel_minQualis_boatman" and needs to be recomputed, if that changes.
+ *
+ * \return Capabilities indexed by qualifications bitmask.
+ */
+QualificationChecker::CapabilityTable QualificationChecker::capabilityTable()
+{
+    const QString tBoatmanRequiredLicense = boatmanRequiredLicense();
+
+    CapabilityTable tTable;
+
+    for (std::size_t i = 0; i < tTable.size(); ++i)
+    {
+        Person::Qualifications tQualis = Person::Qualifications::fromMask(static_cast<Person::Qualifications::Mask>(i));
+        tTable[i] = capabilities(tQualis, tBoatmanRequiredLicense);
+    }
+
+    return tTable;
+}
+
+//Private
+
+/*!
+ * \brief Get all functions a person is qualified for.
+ *
+ * See capabilities(const Person::Qualifications&).
+ *
+ * \param pQualifications Qualifications of concerned person.
+ * \param pBoatmanRequiredLicense Required boat license for boatman (see checkBoatman()).
+ * \return Capabilities bitset.
+ */
+QualificationChecker::Capabilities QualificationChecker::capabilities(const Person::Qualifications& pQualifications,
+                                                                      const QString& pBoatmanRequiredLicense)
+{
+    const bool tBoatman = checkBoatman(pQualifications, pBoatmanRequiredLicense);
+
+    Capabilities tCapabilities = 0;
+
+    Person::iterateFunctions([&pQualifications, &pBoatmanRequiredLicense, &tCapabilities](Person::Function pFunction) -> void
+                             {
+                                 if (checkPersonnelFunction(pFunction, pQualifications, pBoatmanRequiredLicense))
+                                     tCapabilities |= capability(pFunction);
+                             });
+
+    Person::iterateBoatFunctions([&pQualifications, &tCapabilities](Person::BoatFunction pFunction) -> void
+                                 {
+                                     if (checkBoatFunction(pFunction, pQualifications))
+                                         tCapabilities |= capability(pFunction);
+                                 });
+
+    if (tBoatman)
+        tCapabilities |= boatmanCapability();
+
+    return tCapabilities;
+}
@@ -25,6 +25,11 @@
 
 #include "person.h"
 
+#include <QString>
+
+#include <array>
+#include <cstdint>
+
 /*!
  * \brief Check, if a Person has sufficient qualifications for a specific function.
  *
@@ -33,20 +38,52 @@
  * Which qualifications are required for which function, is defined by this class and can be checked
  * with checkPersonnelFunction() and checkBoatFunction().
  * To check whether a person can be a boat drive's boatman the function checkBoatman() should be used.
+ *
+ * For checking many persons at once, all functions a person is qualified for can be combined
+ * into a Capabilities bitset (see capabilities()). Since there is only a small number of different
+ * qualification combinations, the bitsets for all of them can be precomputed (see capabilityTable()).
+ *
+ * The required boat license for boatmen is a program setting (see boatmanRequiredLicense()), which must only be read
+ * in the main thread. Code running in other threads must use the overloads taking the required license as argument.
  */
 class QualificationChecker
 {
+public:
+    typedef uint32_t Capabilities;      ///< Bitset of functions a person is qualified for (see capability()).
+    typedef std::array<Capabilities, (1u << Person::Qualifications::count)> CapabilityTable;
+                                        ///< \brief Capabilities for every possible qualifications
+                                        ///  bitmask (see Person::Qualifications::toMask()).
+
 public:
     QualificationChecker() = delete;    ///< Deleted constructor.
     //
     static bool checkPersonnelFunction(Person::Function pFunction,
                                        const Person::Qualifications& pQualifications);  ///< \brief Check if a person is qualified
                                                                                         ///  for a certain personnel function.
+    static bool checkPersonnelFunction(Person::Function pFunction, const Person::Qualifications& pQualifications,
+                                       const QString& pBoatmanRequiredLicense);         ///< \brief Check if a person is qualified
+                                                                                        ///  for a certain personnel function.
     static bool checkBoatFunction(Person::BoatFunction pFunction,
                                   const Person::Qualifications& pQualifications);       ///< \brief Check if a person is qualified
                                                                                         ///  for a certain boat function.
     static bool checkBoatman(const Person::Qualifications& pQualifications);            ///< \brief Check if a person is qualified
                                                                                         ///  to be a boatman.
+    static bool checkBoatman(const Person::Qualifications& pQualifications,
+                             const QString& pRequiredLicense);                          ///< \brief Check if a person is qualified
+                                                                                        ///  to be a boatman.
+    static QString boatmanRequiredLicense(bool pNoMsgBox = false);                      ///< Get the boat license required for being a boatman.
+    //
+    static Capabilities capability(Person::Function pFunction);         ///< Get the capability bit of a personnel function.
+    static Capabilities capability(Person::BoatFunction pFunction);     ///< Get the capability bit of a boat function.
+    static Capabilities boatmanCapability();                            ///< Get the capability bit of being a boatman.
+    //
+    static Capabilities capabilities(const Person::Qualifications& pQualifications);    ///< \brief Get all functions a person
+                                                                                        ///  is qualified for.
+    static CapabilityTable capabilityTable();                           ///< Get the capabilities for all qualification combinations.
+
+private:
+    static Capabilities capabilities(const Person::Qualifications& pQualifications,
+                                     const QString& pBoatmanRequiredLicense);   ///< Get all functions a person is qualified for.
 };
 
 #endif // QUALIFICATIONCHECKER_H
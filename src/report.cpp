@@ -34,6 +34,7 @@
 #include <QSaveFile>
 #include <QStringList>
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <list>
@@ -94,8 +95,70 @@ Report::Report() :
     iterateRescueOperations(tRescOpFunc, rescueOperationsCounts);
 }
 
+/*!
+ * \brief Copy constructor.
+ *
+ * Copies all report data from \p pReport. In contrast to a member-wise copy, the boat log is copied as well
+ * instead of only sharing it, such that the copy can e.g. be safely used in another thread while \p pReport
+ * (and its boat log) is further edited.
+ *
+ * Note: New member variables must also be added here.
+ *
+ * \param pReport Report to copy.
+ */
+Report::Report(const Report& pReport) :
+    fileName(pReport.fileName),
+    number(pReport.number),
+    station(pReport.station),
+    radioCallName(pReport.radioCallName),
+    comments(pReport.comments),
+    dutyPurpose(pReport.dutyPurpose),
+    dutyPurposeComment(pReport.dutyPurposeComment),
+    date(pReport.date),
+    begin(pReport.begin),
+    end(pReport.end),
+    precipitation(pReport.precipitation),
+    cloudiness(pReport.cloudiness),
+    windStrength(pReport.windStrength),
+    windDirection(pReport.windDirection),
+    temperatureAir(pReport.temperatureAir),
+    temperatureWater(pReport.temperatureWater),
+    weatherComments(pReport.weatherComments),
+    operationProtocolsCtr(pReport.operationProtocolsCtr),
+    patientRecordsCtr(pReport.patientRecordsCtr),
+    radioCallLogsCtr(pReport.radioCallLogsCtr),
+    otherEnclosures(pReport.otherEnclosures),
+    personnelMinutesCarry(pReport.personnelMinutesCarry),
+    internalPersonnelMap(pReport.internalPersonnelMap),
+    externalPersonnelMap(pReport.externalPersonnelMap),
+    personnelFunctionTimesMap(pReport.personnelFunctionTimesMap),
+    boatLogPtr(std::make_shared<BoatLog>(*pReport.boatLogPtr)),
+    rescueOperationsCounts(pReport.rescueOperationsCounts),
+    assignmentNumber(pReport.assignmentNumber),
+    resources(pReport.resources)
+{
+}
+
 //Public
 
+/*!
+ * \brief Copy assignment operator.
+ *
+ * Copies all report data from \p pReport including its boat log (see Report(const Report&)).
+ *
+ * \param pReport Report to copy.
+ * \return Reference to this report.
+ */
+Report& Report::operator=(const Report& pReport)
+{
+    if (this != &pReport)
+        *this = Report(pReport);
+
+    return *this;
+}
+
+//
+
 /*!
  * \brief Reset to the state of a newly constructed report.
  *
@@ -123,10 +186,29 @@ void Report::reset()
  * Note: All persons of report's personnel are saved with and loaded from report file, such that handling of these
  * persons will be independent of the personnel database unless they are removed from and added to the loaded report again.
  *
+ * Note: Reads the boatman setting (see QualificationChecker::boatmanRequiredLicense()) and hence must be called
+ * from the main thread. Use open(const QString&, const QString&) to load reports from other threads.
+ *
  * \param pFileName Path to the file to load the report from.
  * \return If successful.
  */
 bool Report::open(const QString& pFileName)
+{
+    return open(pFileName, QualificationChecker::boatmanRequiredLicense());
+}
+
+/*!
+ * \brief Load report from file.
+ *
+ * Same as open(const QString&) but with the boat license required for being a boatman explicitly passed
+ * instead of read from the settings (see QualificationChecker::boatmanRequiredLicense()).
+ * Since no settings are accessed, this can be called from any thread.
+ *
+ * \param pFileName Path to the file to load the report from.
+ * \param pBoatmanRequiredLicense Required boat license for boatman (see QualificationChecker::checkBoatman()).
+ * \return If successful.
+ */
+bool Report::open(const QString& pFileName, const QString& pBoatmanRequiredLicense)
 {
     //First make sure that all maps etc. are empty
     reset();
@@ -647,7 +729,7 @@ bool Report::open(const QString& pFileName)
         const Person& tPerson = getIntOrExtPersonnel(tIdent);
 
         //Person must be qualified for stated function
-        if (!QualificationChecker::checkPersonnelFunction(tFunction, tPerson.getQualifications()))
+        if (!QualificationChecker::checkPersonnelFunction(tFunction, tPerson.getQualifications(), pBoatmanRequiredLicense))
         {
             std::cerr<<"ERROR: Insufficient qualification for personnel function!"<<std::endl;
             return false;
@@ -780,7 +862,8 @@ bool Report::open(const QString& pFileName)
                 std::cerr<<"ERROR: Boatman not in personnel list!"<<std::endl;
                 return false;
             }
-            if (!QualificationChecker::checkBoatman(getIntOrExtPersonnel(tBoatmanIdent).getQualifications()))
+            if (!QualificationChecker::checkBoatman(getIntOrExtPersonnel(tBoatmanIdent).getQualifications(),
+                                                    pBoatmanRequiredLicense))
             {
                 std::cerr<<"ERROR: Insufficient qualification for boatman!"<<std::endl;
                 return false;
@@ -986,11 +1069,20 @@ bool Report::save(const QString& pFileName, const bool pTempFile)
 
     //Store internal personnel data in report to be independent of future personnel (database) changes
 
-    QJsonArray internalPersonnelArray;
+    //Note: Write persons ordered by identifier (not by handle) to get reproducible files
+
+    std::map<QString, std::reference_wrapper<const Person>> tSortedInternalPersonnel, tSortedExternalPersonnel;
 
     for (const auto& it : internalPersonnelMap)
+        tSortedInternalPersonnel.insert({it.second.getIdent(), std::cref(it.second)});
+    for (const auto& it : externalPersonnelMap)
+        tSortedExternalPersonnel.insert({it.second.getIdent(), std::cref(it.second)});
+
+    QJsonArray internalPersonnelArray;
+
+    for (const auto& it : tSortedInternalPersonnel)
     {
-        const Person& tPerson(it.second);
+        const Person& tPerson(it.second.get());
 
         QJsonObject personObj;
         personObj.insert("lastName", tPerson.getLastName());
@@ -1005,9 +1097,9 @@ bool Report::save(const QString& pFileName, const bool pTempFile)
 
     QJsonArray externalPersonnelArray;
 
-    for (const auto& it : externalPersonnelMap)
+    for (const auto& it : tSortedExternalPersonnel)
     {
-        const Person& tPerson(it.second);
+        const Person& tPerson(it.second.get());
 
         QJsonObject personObj;
         personObj.insert("lastName", tPerson.getLastName());
@@ -1028,7 +1120,12 @@ bool Report::save(const QString& pFileName, const bool pTempFile)
 
     QJsonArray personnelArray;
 
+    std::map<QString, std::pair<Person::Function, std::pair<QTime, QTime>>> tSortedFunctionTimes;
+
     for (const auto& it : personnelFunctionTimesMap)
+        tSortedFunctionTimes.insert({PersonIdentPool::ident(it.first), it.second});
+
+    for (const auto& it : tSortedFunctionTimes)
     {
         const QString& tIdent = it.first;
         Person::Function tFunction = it.second.first;
@@ -1180,21 +1277,47 @@ QString Report::getFileName() const
  *
  * Additionally the report serial number is set to last report's serial number plus one.
  *
+ * See also calculateCarryovers().
+ *
  * \param pLastReport Last report to load/calculate carryovers from.
  * \return If previous carryovers were changed.
  */
 bool Report::loadCarryovers(const Report& pLastReport)
 {
-    //Need to include old carryovers from last report
-    int oldPersonnelCarry = pLastReport.personnelMinutesCarry;
-    int oldBoatCarry = pLastReport.boatLogPtr->getBoatMinutesCarry();
+    CarryoverSummary summary = getCarryoverSummary();
 
-    //Sum up gained personnel hours for each person's arrival/leaving times from last report
+    bool valuesChanged = calculateCarryovers(pLastReport.getCarryoverSummary(), summary);
 
-    int oldTotalPersonnelMinutes = 0;
-    const auto& oldFuncsTimes = pLastReport.personnelFunctionTimesMap;
+    //Copy loaded/calculated values to this report
+    setCarryovers(summary);
 
-    for (const auto& it : oldFuncsTimes)
+    return valuesChanged;
+}
+
+//
+
+/*!
+ * \brief Get the values that carryovers are calculated from/for.
+ *
+ * Sums up the personnel hours gained in this report from each person's arrival/leaving times
+ * and the boat drive hours gained in this report from each boat drive's begin/end times.
+ * The other values of the summary are the report's current carryovers and serial number.
+ *
+ * \return Carryover summary of this report.
+ */
+Report::CarryoverSummary Report::getCarryoverSummary() const
+{
+    CarryoverSummary summary;
+
+    summary.number = number;
+    summary.personnelMinutesCarry = personnelMinutesCarry;
+    summary.boatMinutesCarry = boatLogPtr->getBoatMinutesCarry();
+    summary.engineHoursInitial = boatLogPtr->getEngineHoursInitial();
+    summary.engineHoursFinal = boatLogPtr->getEngineHoursFinal();
+
+    //Sum up gained personnel hours for each person's arrival/leaving times
+
+    for (const auto& it : personnelFunctionTimesMap)
     {
         const QTime& tBeginTime = it.second.second.first;
         const QTime& tEndTime = it.second.second.second;
@@ -1204,15 +1327,14 @@ bool Report::loadCarryovers(const Report& pLastReport)
         if (dMinutes < 0)
             dMinutes += 24 * 60;
 
-        oldTotalPersonnelMinutes += dMinutes;
+        summary.personnelMinutes += dMinutes;
     }
 
-    //Sum up gained boat hours for each boat drive's begin/end times from last report
+    //Sum up gained boat hours for each boat drive's begin/end times
 
-    int oldTotalBoatMinutes = 0;
-    auto oldDrives = pLastReport.boatLogPtr->getDrives();
+    auto drives = boatLogPtr->getDrives();
 
-    for (const auto& it : oldDrives)
+    for (const auto& it : drives)
     {
         const QTime& tBeginTime = it.get().getBeginTime();
         const QTime& tEndTime = it.get().getEndTime();
@@ -1222,37 +1344,68 @@ bool Report::loadCarryovers(const Report& pLastReport)
         if (dMinutes < 0)
             dMinutes += 24 * 60;
 
-        oldTotalBoatMinutes += dMinutes;
+        summary.boatMinutes += dMinutes;
     }
 
+    return summary;
+}
+
+/*!
+ * \brief Set the carryover values from a summary.
+ *
+ * Sets the serial number, the personnel and boat drive hours carries and the initial and final
+ * boat engine hours to the values from \p pSummary. The gained hours of the summary are ignored.
+ *
+ * \param pSummary Carryover summary to take the values from.
+ */
+void Report::setCarryovers(const CarryoverSummary& pSummary)
+{
+    number = pSummary.number;
+    personnelMinutesCarry = pSummary.personnelMinutesCarry;
+    boatLogPtr->setBoatMinutesCarry(pSummary.boatMinutesCarry);
+    boatLogPtr->setEngineHoursInitial(pSummary.engineHoursInitial);
+    boatLogPtr->setEngineHoursFinal(pSummary.engineHoursFinal);
+}
+
+/*!
+ * \brief Calculate carryovers of a summary from the last report's summary.
+ *
+ * Calculates the carryovers of \p pSummary from \p pLastSummary exactly like loadCarryovers() does for whole reports.
+ * Since only summaries are needed, a long chain of reports can be processed without keeping all reports loaded.
+ *
+ * \param pLastSummary Carryover summary of the last report.
+ * \param pSummary Carryover summary to update.
+ * \return If previous carryovers were changed.
+ */
+bool Report::calculateCarryovers(const CarryoverSummary& pLastSummary, CarryoverSummary& pSummary)
+{
     //Set new carryovers to sum of old carryovers plus summed gained time from last report
-    int newPersonnelCarry = oldTotalPersonnelMinutes + oldPersonnelCarry;
-    int newBoatCarry = oldTotalBoatMinutes + oldBoatCarry;
+    int newPersonnelCarry = pLastSummary.personnelMinutes + pLastSummary.personnelMinutesCarry;
+    int newBoatCarry = pLastSummary.boatMinutes + pLastSummary.boatMinutesCarry;
 
     //Use final engine hours from last report as new initial value
-    double newEngineHoursInitial = pLastReport.boatLogPtr->getEngineHoursFinal();
+    double newEngineHoursInitial = pLastSummary.engineHoursFinal;
 
     //If final engine hours are still zero (prevent unwanted destructive overwrite), set them equal to the new initial value
-    double newEngineHoursFinal = boatLogPtr->getEngineHoursFinal();
+    double newEngineHoursFinal = pSummary.engineHoursFinal;
     if (newEngineHoursFinal == 0)
         newEngineHoursFinal = newEngineHoursInitial;
 
     //Increment serial number
-    int newSerialNumber = pLastReport.number + 1;
+    int newSerialNumber = pLastSummary.number + 1;
 
     //Check if new carryovers are different from old ones
-    bool valuesChanged = number != newSerialNumber ||
-                         personnelMinutesCarry != newPersonnelCarry ||
-                         boatLogPtr->getBoatMinutesCarry() != newBoatCarry ||
-                         boatLogPtr->getEngineHoursInitial() != newEngineHoursInitial ||
-                         boatLogPtr->getEngineHoursFinal() != newEngineHoursFinal;
-
-    //Copy loaded/calculated values to this report
-    number = newSerialNumber;
-    personnelMinutesCarry = newPersonnelCarry;
-    boatLogPtr->setBoatMinutesCarry(newBoatCarry);
-    boatLogPtr->setEngineHoursInitial(newEngineHoursInitial);
-    boatLogPtr->setEngineHoursFinal(newEngineHoursFinal);
+    bool valuesChanged = pSummary.number != newSerialNumber ||
+                         pSummary.personnelMinutesCarry != newPersonnelCarry ||
+                         pSummary.boatMinutesCarry != newBoatCarry ||
+                         pSummary.engineHoursInitial != newEngineHoursInitial ||
+                         pSummary.engineHoursFinal != newEngineHoursFinal;
+
+    pSummary.number = newSerialNumber;
+    pSummary.personnelMinutesCarry = newPersonnelCarry;
+    pSummary.boatMinutesCarry = newBoatCarry;
+    pSummary.engineHoursInitial = newEngineHoursInitial;
+    pSummary.engineHoursFinal = newEngineHoursFinal;
 
     return valuesChanged;
 }
@@ -1720,8 +1873,13 @@ std::vector<QString> Report::getPersonnel(const bool pSorted) const
 
     if (!pSorted)
     {
+        tIdents.reserve(personnelFunctionTimesMap.size());
+
         for (const auto& it : personnelFunctionTimesMap)
-            tIdents.push_back(it.first);
+            tIdents.push_back(PersonIdentPool::ident(it.first));
+
+        //Keep order by identifier independent of handle order
+        std::sort(tIdents.begin(), tIdents.end());
     }
     else
     {
@@ -1774,7 +1932,14 @@ std::vector<QString> Report::getPersonnel(const bool pSorted) const
         std::set<std::tuple<std::reference_wrapper<const Person>, Person::Function, QTime, QTime>, decltype(cmp)> tSet(cmp);
 
         for (const auto& it : personnelFunctionTimesMap)
-            tSet.insert({std::cref(getIntOrExtPersonnel(it.first)), it.second.first, it.second.second.first, it.second.second.second});
+        {
+            const Person* tPerson = findPersonnel(it.first);
+
+            if (tPerson == nullptr)
+                throw std::out_of_range("Could not find person with this identifier!");
+
+            tSet.insert({std::cref(*tPerson), it.second.first, it.second.second.first, it.second.second.second});
+        }
 
         for (const auto& it : tSet)
             tIdents.push_back(std::get<0>(it).get().getIdent());
@@ -1798,6 +1963,19 @@ bool Report::personExists(const QString& pIdent) const
     return personInPersonnel(pIdent) && personnelExists(pIdent);
 }
 
+/*!
+ * \brief Check, if a person is part of personnel.
+ *
+ * Checks, if a person with interned identifier handle \p pHandle (see PersonIdentPool) is found in this report's personnel list.
+ *
+ * \param pHandle Person's identifier handle.
+ * \return If person found.
+ */
+bool Report::personExists(const PersonIdentPool::Handle pHandle) const
+{
+    return personnelFunctionTimesMap.find(pHandle) != personnelFunctionTimesMap.end() && findPersonnel(pHandle) != nullptr;
+}
+
 /*!
  * \brief Check, if the person name is ambiguous.
  *
@@ -1900,8 +2078,8 @@ void Report::removePerson(const QString& pIdent)
  */
 Person::Function Report::getPersonFunction(const QString& pIdent) const
 {
-    if (personnelFunctionTimesMap.find(pIdent) != personnelFunctionTimesMap.end())
-        return personnelFunctionTimesMap.at(pIdent).first;
+    if (const auto* tFunctionTimes = findPersonFunctionTimes(pIdent))
+        return tFunctionTimes->first;
 
     std::cerr<<"ERROR: Could not find person in personnel list! Returning dummy function."<<std::endl;
 
@@ -1916,8 +2094,8 @@ Person::Function Report::getPersonFunction(const QString& pIdent) const
  */
 void Report::setPersonFunction(const QString& pIdent, const Person::Function pFunction)
 {
-    if (personnelFunctionTimesMap.find(pIdent) != personnelFunctionTimesMap.end())
-        personnelFunctionTimesMap.at(pIdent).first = pFunction;
+    if (auto* tFunctionTimes = findPersonFunctionTimes(pIdent))
+        tFunctionTimes->first = pFunction;
     else
         std::cerr<<"ERROR: Could not find person in personnel list!"<<std::endl;
 }
@@ -1932,8 +2110,8 @@ void Report::setPersonFunction(const QString& pIdent, const Person::Function pFu
  */
 QTime Report::getPersonBeginTime(const QString& pIdent) const
 {
-    if (personnelFunctionTimesMap.find(pIdent) != personnelFunctionTimesMap.end())
-        return personnelFunctionTimesMap.at(pIdent).second.first;
+    if (const auto* tFunctionTimes = findPersonFunctionTimes(pIdent))
+        return tFunctionTimes->second.first;
 
     std::cerr<<"ERROR: Could not find person in personnel list! Returning 00:00 time."<<std::endl;
 
@@ -1948,8 +2126,8 @@ QTime Report::getPersonBeginTime(const QString& pIdent) const
  */
 void Report::setPersonBeginTime(const QString& pIdent, const QTime pTime)
 {
-    if (personnelFunctionTimesMap.find(pIdent) != personnelFunctionTimesMap.end())
-        personnelFunctionTimesMap.at(pIdent).second.first = pTime;
+    if (auto* tFunctionTimes = findPersonFunctionTimes(pIdent))
+        tFunctionTimes->second.first = pTime;
     else
         std::cerr<<"ERROR: Could not find person in personnel list!"<<std::endl;
 }
@@ -1964,8 +2142,8 @@ void Report::setPersonBeginTime(const QString& pIdent, const QTime pTime)
  */
 QTime Report::getPersonEndTime(const QString& pIdent) const
 {
-    if (personnelFunctionTimesMap.find(pIdent) != personnelFunctionTimesMap.end())
-        return personnelFunctionTimesMap.at(pIdent).second.second;
+    if (const auto* tFunctionTimes = findPersonFunctionTimes(pIdent))
+        return tFunctionTimes->second.second;
 
     std::cerr<<"ERROR: Could not find person in personnel list! Returning 00:00 time."<<std::endl;
 
@@ -1980,8 +2158,8 @@ QTime Report::getPersonEndTime(const QString& pIdent) const
  */
 void Report::setPersonEndTime(const QString& pIdent, const QTime pTime)
 {
-    if (personnelFunctionTimesMap.find(pIdent) != personnelFunctionTimesMap.end())
-        personnelFunctionTimesMap.at(pIdent).second.second = pTime;
+    if (auto* tFunctionTimes = findPersonFunctionTimes(pIdent))
+        tFunctionTimes->second.second = pTime;
     else
         std::cerr<<"ERROR: Could not find person in personnel list!"<<std::endl;
 }
@@ -2381,7 +2559,7 @@ std::set<Report::RescueOperation> Report::getAvailableRescueOperations()
  */
 bool Report::personInPersonnel(const QString& pIdent) const
 {
-    if (personnelFunctionTimesMap.find(pIdent) != personnelFunctionTimesMap.end())
+    if (findPersonFunctionTimes(pIdent) != nullptr)
         return true;
 
     return false;
@@ -2397,11 +2575,10 @@ bool Report::personInPersonnel(const QString& pIdent) const
  */
 bool Report::personnelExists(const QString& pIdent) const
 {
-    if (internalPersonnelMap.find(pIdent) != internalPersonnelMap.end() ||
-        externalPersonnelMap.find(pIdent) != externalPersonnelMap.end())
-    {
+    PersonIdentPool::Handle tHandle;
+
+    if (PersonIdentPool::lookup(pIdent, tHandle) && findPersonnel(tHandle) != nullptr)
         return true;
-    }
 
     return false;
 }
@@ -2418,14 +2595,70 @@ bool Report::personnelExists(const QString& pIdent) const
  */
 const Person& Report::getIntOrExtPersonnel(const QString& pIdent) const
 {
-    if (internalPersonnelMap.find(pIdent) != internalPersonnelMap.end())
-        return internalPersonnelMap.at(pIdent);
-    else if (externalPersonnelMap.find(pIdent) != externalPersonnelMap.end())
-        return externalPersonnelMap.at(pIdent);
+    PersonIdentPool::Handle tHandle;
+
+    if (PersonIdentPool::lookup(pIdent, tHandle))
+        if (const Person* tPerson = findPersonnel(tHandle))
+            return *tPerson;
 
     throw std::out_of_range("Could not find person with this identifier!");
 }
 
+/*!
+ * \brief Find person in report-internal personnel archive.
+ *
+ * Searches for a person with interned identifier handle \p pHandle (see PersonIdentPool)
+ * in both internal and external personnel maps.
+ *
+ * \param pHandle Person's identifier handle.
+ * \return Pointer to the person or nullptr, if not found.
+ */
+const Person* Report::findPersonnel(const PersonIdentPool::Handle pHandle) const
+{
+    auto it = internalPersonnelMap.find(pHandle);
+    if (it != internalPersonnelMap.end())
+        return &it->second;
+
+    it = externalPersonnelMap.find(pHandle);
+    if (it != externalPersonnelMap.end())
+        return &it->second;
+
+    return nullptr;
+}
+
+//
+
+/*!
+ * \brief Find a person's personnel function and times in the personnel list.
+ *
+ * \param pIdent Person's identifier.
+ * \return Pointer to personnel function and arrival/leaving times or nullptr, if not found.
+ */
+const std::pair<Person::Function, std::pair<QTime, QTime>>* Report::findPersonFunctionTimes(const QString& pIdent) const
+{
+    PersonIdentPool::Handle tHandle;
+    if (!PersonIdentPool::lookup(pIdent, tHandle))
+        return nullptr;
+
+    auto it = personnelFunctionTimesMap.find(tHandle);
+    if (it == personnelFunctionTimesMap.end())
+        return nullptr;
+
+    return &it->second;
+}
+
+/*!
+ * \brief Find a person's personnel function and times in the personnel list.
+ *
+ * \param pIdent Person's identifier.
+ * \return Pointer to personnel function and arrival/leaving times or nullptr, if not found.
+ */
+std::pair<Person::Function, std::pair<QTime, QTime>>* Report::findPersonFunctionTimes(const QString& pIdent)
+{
+    return const_cast<std::pair<Person::Function, std::pair<QTime, QTime>>*>(
+                static_cast<const Report*>(this)->findPersonFunctionTimes(pIdent));
+}
+
 //
 
 /*!
@@ -2438,12 +2671,12 @@ const Person& Report::getIntOrExtPersonnel(const QString& pIdent) const
  */
 void Report::addPersonnel(Person&& pPerson)
 {
-    QString ident = pPerson.getIdent();
+    const QString& ident = pPerson.getIdent();
 
     if (Person::isInternalIdent(ident))
-        internalPersonnelMap.insert({std::move(ident), std::move(pPerson)});
+        internalPersonnelMap.insert({PersonIdentPool::intern(ident), std::move(pPerson)});
     else if (Person::isExternalIdent(ident))
-        externalPersonnelMap.insert({std::move(ident), std::move(pPerson)});
+        externalPersonnelMap.insert({PersonIdentPool::intern(ident), std::move(pPerson)});
 }
 
 /*!
@@ -2455,10 +2688,14 @@ void Report::addPersonnel(Person&& pPerson)
  */
 void Report::removePersonnel(const QString& pIdent)
 {
-    if (internalPersonnelMap.find(pIdent) != internalPersonnelMap.end())
-        internalPersonnelMap.erase(pIdent);
-    else if (externalPersonnelMap.find(pIdent) != externalPersonnelMap.end())
-        externalPersonnelMap.erase(pIdent);
+    PersonIdentPool::Handle tHandle;
+    if (!PersonIdentPool::lookup(pIdent, tHandle))
+        return;
+
+    if (internalPersonnelMap.find(tHandle) != internalPersonnelMap.end())
+        internalPersonnelMap.erase(tHandle);
+    else if (externalPersonnelMap.find(tHandle) != externalPersonnelMap.end())
+        externalPersonnelMap.erase(tHandle);
 }
 
 //
@@ -2476,7 +2713,7 @@ void Report::removePersonnel(const QString& pIdent)
  */
 void Report::addPersonFunctionTimes(const QString& pIdent, const Person::Function pFunction, const QTime pBegin, const QTime pEnd)
 {
-    personnelFunctionTimesMap.insert({pIdent, {pFunction, {pBegin, pEnd}}});
+    personnelFunctionTimesMap.insert({PersonIdentPool::intern(pIdent), {pFunction, {pBegin, pEnd}}});
 }
 
 /*!
@@ -2486,6 +2723,8 @@ void Report::addPersonFunctionTimes(const QString& pIdent, const Person::Functio
  */
 void Report::removePersonFunctionTimes(const QString& pIdent)
 {
-    if (personnelFunctionTimesMap.find(pIdent) != personnelFunctionTimesMap.end())
-        personnelFunctionTimesMap.erase(pIdent);
+    PersonIdentPool::Handle tHandle;
+
+    if (PersonIdentPool::lookup(pIdent, tHandle))
+        personnelFunctionTimesMap.erase(tHandle);
 }
@@ -26,6 +26,7 @@
 #include "auxil.h"
 #include "boatlog.h"
 #include "person.h"
+#include "personidentpool.h"
 
 #include <QDate>
 #include <QString>
@@ -57,19 +58,30 @@ class Report
 public:
     enum class DutyPurpose : int8_t;
     enum class RescueOperation : int8_t;
+    struct CarryoverSummary;
 
 public:
     Report();                                                       ///< Constructor.
+    Report(const Report& pReport);                                  ///< Copy constructor.
+    Report(Report&& pReport) = default;                             ///< Default move constructor.
+    Report& operator=(const Report& pReport);                       ///< Copy assignment operator.
+    Report& operator=(Report&& pReport) = default;                  ///< Default move assignment operator.
     //
     void reset();                                                   ///< Reset to the state of a newly constructed report.
     //
     bool open(const QString& pFileName);                            ///< Load report from file.
+    bool open(const QString& pFileName, const QString& pBoatmanRequiredLicense);   ///< Load report from file.
     bool save(const QString& pFileName, bool pTempFile = false);    ///< Save report to file.
     //
     QString getFileName() const;                                    ///< Get the file name of opened/saved report file.
     //
     bool loadCarryovers(const Report& pLastReport);                 ///< Load/calculate carryovers from the last report.
     //
+    CarryoverSummary getCarryoverSummary() const;                   ///< Get the values that carryovers are calculated from/for.
+    void setCarryovers(const CarryoverSummary& pSummary);           ///< Set the carryover values from a summary.
+    static bool calculateCarryovers(const CarryoverSummary& pLastSummary,
+                                    CarryoverSummary& pSummary);    ///< Calculate carryovers of a summary from the last report's summary.
+    //
     int getNumber() const;                                          ///< Get the report's serial number.
     void setNumber(int pNumber);                                    ///< Set the report's serial number.
     //
@@ -123,6 +135,7 @@ public:
     std::vector<QString> getPersonnel(bool pSorted = false) const;  ///< Get all personnel identifiers.
     //
     bool personExists(const QString& pIdent) const;                                     ///< Check, if a person is part of personnel.
+    bool personExists(PersonIdentPool::Handle pHandle) const;                           ///< Check, if a person is part of personnel.
     bool personIsAmbiguous(const QString& pLastName, const QString& pFirstName) const;  ///< Check, if the person name is ambiguous.
     //
     Person getPerson(const QString& pIdent) const;                                          ///< Get a specific person from personnel.
@@ -165,6 +178,14 @@ private:
     bool personnelExists(const QString& pIdent) const;                  ///< \brief Check, if person exists in report-internal
                                                                         ///  personnel archive.
     const Person& getIntOrExtPersonnel(const QString& pIdent) const;    ///< Get person in report-internal personnel archive.
+    const Person* findPersonnel(PersonIdentPool::Handle pHandle) const; ///< Find person in report-internal personnel archive.
+    //
+    const std::pair<Person::Function, std::pair<QTime, QTime>>* findPersonFunctionTimes(const QString& pIdent) const;
+                                                                        ///< \brief Find a person's personnel function and times
+                                                                        ///  in the personnel list.
+    std::pair<Person::Function, std::pair<QTime, QTime>>* findPersonFunctionTimes(const QString& pIdent);
+                                                                        ///< \brief Find a person's personnel function and times
+                                                                        ///  in the personnel list.
     //
     void addPersonnel(Person&& pPerson);                                ///< Add person to the report-internal personnel archive.
     void removePersonnel(const QString& pIdent);                        ///< Remove person from the report-internal personnel archive.
@@ -215,6 +236,23 @@ public:
         _MORTAL_DANGER_INVOLVED = 100   ///< "... davon Rettung aus Lebensgefahr".
     };
 
+    /*!
+     * \brief Carryover-related values of a report.
+     *
+     * Contains everything that is needed to calculate the carryovers of the next report (see calculateCarryovers())
+     * and the carryovers of the report itself. Much cheaper to keep around than the whole report.
+     */
+    struct CarryoverSummary
+    {
+        int number = 0;                     ///< Report serial number.
+        int personnelMinutesCarry = 0;      ///< Carry for personnel hours from last report as minutes.
+        int boatMinutesCarry = 0;           ///< Carry for boat drive hours from last report as minutes.
+        double engineHoursInitial = 0;      ///< Boat engine hours counter at begin of duty.
+        double engineHoursFinal = 0;        ///< Boat engine hours counter at end of duty.
+        int personnelMinutes = 0;           ///< Total personnel hours gained in this report as minutes.
+        int boatMinutes = 0;                ///< Total boat drive hours gained in this report as minutes.
+    };
+
 private:
     static constexpr int8_t RescueOperation_CAPSIZE_deprecated = 4; //Replacement for deprecated RescueOperation::_CAPSIZE
 
@@ -319,12 +357,13 @@ private:
     //
     int personnelMinutesCarry;          //Carry of (current season's) total personnel hours from last report (measured in minutes!)
     //
-    std::map<QString, Person> internalPersonnelMap;  //Save database personell locally along with report for archival purposes
-    std::map<QString, Person> externalPersonnelMap;  //Also save external personnel locally along with report
+    //Note: Persons are keyed on their interned identifier handles (see PersonIdentPool)
+    std::map<PersonIdentPool::Handle, Person> internalPersonnelMap;  //Save database personell locally along with report for archival purposes
+    std::map<PersonIdentPool::Handle, Person> externalPersonnelMap;  //Also save external personnel locally along with report
     //
-    std::map<QString, std::pair<Person::Function, std::pair<QTime, QTime>>> personnelFunctionTimesMap;  //Personnel functions and times
+    std::map<PersonIdentPool::Handle, std::pair<Person::Function, std::pair<QTime, QTime>>> personnelFunctionTimesMap;  //Functions and times
     //
-    std::shared_ptr<BoatLog> boatLogPtr;                    //The boat log (which is handled by a separate class)
+    std::shared_ptr<BoatLog> boatLogPtr;                    //The boat log (which is handled by a separate class; deep-copied by Report(const Report&))
     //
     std::map<RescueOperation, int> rescueOperationsCounts;  //Counts of different types of rescue operations
     //
@@ -0,0 +1,740 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "reportarchiveindex.h"
+
+#include "paralleljobs.h"
+#include "qualificationchecker.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QVariant>
+#include <QtSql/QSqlDatabase>
+
+#include <iostream>
+#include <map>
+#include <utility>
+
+//Initialize static class members
+
+bool ReportArchiveIndex::opened = false;
+const QString ReportArchiveIndex::connectionName = "archiveDb";
+
+//Public
+
+/*!
+ * \brief Open (or create) the index database.
+ *
+ * Opens the SQLite database \p pFileName (usually "archive.sqlite3" in the configuration directory) as a separate
+ * database connection and creates the index tables, if necessary (see createTables()). An already opened index is closed first.
+ *
+ * \param pFileName File name of the index database.
+ * \return If successful.
+ */
+bool ReportArchiveIndex::open(const QString& pFileName)
+{
+    close();
+
+    bool tSuccess = false;
+
+    {
+        QSqlDatabase archiveDb = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+        archiveDb.setDatabaseName(pFileName);
+
+        //Multiple program instances may update the index at the same time
+        archiveDb.setConnectOptions("QSQLITE_BUSY_TIMEOUT=1000");
+
+        tSuccess = archiveDb.open();
+    }
+
+    if (!tSuccess)
+    {
+        std::cerr<<"ERROR: Could not open report archive index database!"<<std::endl;
+        QSqlDatabase::removeDatabase(connectionName);
+        return false;
+    }
+
+    if (!createTables())
+    {
+        std::cerr<<"ERROR: Could not create report archive index tables!"<<std::endl;
+        QSqlDatabase::database(connectionName).close();
+        QSqlDatabase::removeDatabase(connectionName);
+        return false;
+    }
+
+    opened = true;
+
+    return true;
+}
+
+/*!
+ * \brief Close the index database.
+ *
+ * Does nothing, if the index is not open.
+ */
+void ReportArchiveIndex::close()
+{
+    if (!opened)
+        return;
+
+    opened = false;
+
+    QSqlDatabase::database(connectionName).close();
+    QSqlDatabase::removeDatabase(connectionName);
+}
+
+/*!
+ * \brief Check, if the index database is open.
+ *
+ * \return If open() was successful (and close() not called since).
+ */
+bool ReportArchiveIndex::isOpen()
+{
+    return opened;
+}
+
+//
+
+/*!
+ * \brief Add or refresh the entry of a loaded/saved report.
+ *
+ * Uses the file name of \p pReport (see Report::getFileName()) and the current modification time of this file.
+ * Should be called right after the report was opened or saved, such that the report matches the file.
+ *
+ * \param pReport Report that was just opened from or saved to its file.
+ * \return If successful.
+ */
+bool ReportArchiveIndex::updateReport(const Report& pReport)
+{
+    if (!opened || pReport.getFileName() == "" || !QFileInfo::exists(pReport.getFileName()))
+        return false;
+
+    return writeEntry(entryFromReport(pReport, pReport.getFileName()));
+}
+
+/*!
+ * \brief Add or refresh the entries of report files, if changed.
+ *
+ * Skips each file whose modification time and size still match its index entry. All other files are loaded
+ * in parallel with \p pJobs parallel jobs (see ParallelJobs::run()) and their entries are written
+ * in a single transaction. Entries of files that do not exist (anymore) are removed.
+ *
+ * For each file that cannot be loaded a message is appended to \p pErrors and its (outdated) entry is removed.
+ * If the index database cannot be written, nothing is written and a message is appended to \p pErrors as well.
+ *
+ * Note: Must be called from the main thread (see QualificationChecker::boatmanRequiredLicense()).
+ *
+ * \param pFileNames Report file names.
+ * \param pErrors Messages for report files that could not be loaded or indexed.
+ * \param pJobs Number of parallel jobs.
+ * \return Number of added or refreshed entries.
+ */
+int ReportArchiveIndex::update(const QStringList& pFileNames, QStringList& pErrors, const int pJobs)
+{
+    if (!opened || pFileNames.isEmpty())
+        return 0;
+
+    QSqlDatabase archiveDb = QSqlDatabase::database(connectionName);
+
+    //Fetch modification times and sizes of all indexed files at once
+
+    std::map<QString, std::pair<qint64, qint64>> indexedFiles;
+
+    {
+        QSqlQuery query("SELECT Path, MTime, Size FROM Reports;", archiveDb);
+
+        while (query.next())
+            indexedFiles[query.value(0).toString()] = {query.value(1).toLongLong(), query.value(2).toLongLong()};
+    }
+
+    QStringList tChangedFiles;
+
+    for (const QString& tFileName : pFileNames)
+    {
+        QFileInfo fileInfo(tFileName);
+        const QString tPath = fileInfo.absoluteFilePath();
+
+        auto it = indexedFiles.find(tPath);
+
+        if (!fileInfo.exists())
+        {
+            if (it != indexedFiles.end())
+                remove(tPath);
+
+            continue;
+        }
+
+        if (it != indexedFiles.end() && it->second.first == fileInfo.lastModified().toMSecsSinceEpoch() &&
+            it->second.second == fileInfo.size())
+        {
+            continue;
+        }
+
+        tChangedFiles.append(tPath);
+    }
+
+    if (tChangedFiles.isEmpty())
+        return 0;
+
+    //Load changed files in parallel
+
+    std::vector<Entry> tEntries(static_cast<std::size_t>(tChangedFiles.size()));
+
+    //Read the setting once here such that the jobs do not need to access the settings cache
+    const QString tBoatmanRequiredLicense = QualificationChecker::boatmanRequiredLicense();
+
+    auto tTask = [&tChangedFiles, &tEntries, &tBoatmanRequiredLicense](int pIndex) -> QString
+    {
+        const QString& tFileName = tChangedFiles[pIndex];
+
+        Report tReport;
+
+        if (!tReport.open(tFileName, tBoatmanRequiredLicense))
+        {
+            std::cerr<<"ERROR: Could not load report \""<<tFileName.toStdString()<<"\"!"<<std::endl;
+            return "Konnte Wachbericht \"" + tFileName + "\" nicht laden!";
+        }
+
+        tEntries[static_cast<std::size_t>(pIndex)] = entryFromReport(tReport, tFileName);
+
+        return "";
+    };
+
+    std::vector<QString> tErrors;
+
+    ParallelJobs::run(tChangedFiles.size(), pJobs, tTask, tErrors);
+
+    //Write all new entries at once
+
+    int tUpdated = 0;
+
+    if (!archiveDb.transaction())
+    {
+        std::cerr<<"ERROR: Could not start report archive index transaction!"<<std::endl;
+        pErrors.push_back("Konnte Wachberichtsarchiv-Index nicht aktualisieren!");
+        return 0;
+    }
+
+    for (std::size_t i = 0; i < tEntries.size(); ++i)
+    {
+        if (tErrors[i] != "")
+        {
+            pErrors.push_back(tErrors[i]);
+
+            //Do not keep the outdated entry of a file that changed but cannot be loaded anymore
+            remove(tChangedFiles[static_cast<int>(i)]);
+
+            continue;
+        }
+
+        if (writeEntry(tEntries[i]))
+            ++tUpdated;
+    }
+
+    if (!archiveDb.commit())
+    {
+        std::cerr<<"ERROR: Could not write report archive index!"<<std::endl;
+        pErrors.push_back("Konnte Wachberichtsarchiv-Index nicht aktualisieren!");
+        archiveDb.rollback();
+        return 0;
+    }
+
+    return tUpdated;
+}
+
+/*!
+ * \brief Add or refresh the entries of all report files in a directory and remove entries of deleted files.
+ *
+ * Updates the entries of all "*.wbr" files in directory \p pDirName (and its subdirectories, if \p pRecursive is true)
+ * using update(). Removes the entries of files that were in this directory (or its subdirectories) but do not exist anymore.
+ *
+ * \param pDirName Directory to search for report files.
+ * \param pRecursive Also search subdirectories?
+ * \param pErrors Messages for report files that could not be loaded.
+ * \param pJobs Number of parallel jobs.
+ * \return Number of added or refreshed entries.
+ */
+int ReportArchiveIndex::updateDirectory(const QString& pDirName, const bool pRecursive, QStringList& pErrors, const int pJobs)
+{
+    if (!opened)
+        return 0;
+
+    const QString tDirPath = QDir(pDirName).absolutePath();
+
+    QStringList tFileNames;
+
+    QDirIterator dirIt(tDirPath, {"*.wbr"}, QDir::Files,
+                       pRecursive ? QDirIterator::Subdirectories : QDirIterator::NoIteratorFlags);
+
+    while (dirIt.hasNext())
+        tFileNames.append(dirIt.next());
+
+    //Remove entries of files that were deleted from the directory
+
+    QStringList tDeletedFiles;
+
+    {
+        QSqlQuery query(QSqlDatabase::database(connectionName));
+        query.prepare("SELECT Path FROM Reports WHERE substr(Path, 1, length(:dir)) = :dir;");
+        query.bindValue(":dir", tDirPath + "/");
+
+        if (query.exec())
+        {
+            while (query.next())
+            {
+                const QString tPath = query.value(0).toString();
+
+                if (!pRecursive && QFileInfo(tPath).absolutePath() != tDirPath)
+                    continue;
+
+                if (!QFileInfo::exists(tPath))
+                    tDeletedFiles.append(tPath);
+            }
+        }
+    }
+
+    for (const QString& tPath : tDeletedFiles)
+        remove(tPath);
+
+    return update(tFileNames, pErrors, pJobs);
+}
+
+/*!
+ * \brief Remove the entry of a report file.
+ *
+ * \param pFileName Report file name.
+ * \return If successful (also, if there was no entry).
+ */
+bool ReportArchiveIndex::remove(const QString& pFileName)
+{
+    if (!opened)
+        return false;
+
+    QSqlQuery query(QSqlDatabase::database(connectionName));
+    query.prepare("DELETE FROM Reports WHERE Path=:path;");
+    query.bindValue(":path", QFileInfo(pFileName).absoluteFilePath());
+
+    if (!query.exec())
+    {
+        std::cerr<<"ERROR: Could not remove report from archive index!"<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Get the entry of a report file.
+ *
+ * Note: The entry may be outdated (see isCurrent()).
+ *
+ * \param pFileName Report file name.
+ * \param pEntry Destination for the entry.
+ * \return If the file is indexed.
+ */
+bool ReportArchiveIndex::find(const QString& pFileName, Entry& pEntry)
+{
+    if (!opened)
+        return false;
+
+    QSqlQuery query(QSqlDatabase::database(connectionName));
+    query.prepare("SELECT * FROM Reports WHERE Path=:path;");
+    query.bindValue(":path", QFileInfo(pFileName).absoluteFilePath());
+
+    if (!query.exec() || !query.next())
+        return false;
+
+    pEntry = entryFromQuery(query);
+
+    return true;
+}
+
+/*!
+ * \brief Check, if an entry matches the current file on disk.
+ *
+ * \param pEntry Index entry.
+ * \return If the file exists and its modification time and size did not change since it was indexed.
+ */
+bool ReportArchiveIndex::isCurrent(const Entry& pEntry)
+{
+    QFileInfo fileInfo(pEntry.fileName);
+
+    return fileInfo.exists() && fileInfo.size() == pEntry.fileSize &&
+           fileInfo.lastModified().toMSecsSinceEpoch() == pEntry.lastModified.toMSecsSinceEpoch();
+}
+
+/*!
+ * \brief Get the latest existing report of a station.
+ *
+ * Searches the indexed reports of station \p pStation by descending date (and serial number) for the first file
+ * that still exists (see searchLatestReport()).
+ *
+ * \param pStation Station identifier.
+ * \param pEntry Destination for the entry of the latest report.
+ * \return If a report was found.
+ */
+bool ReportArchiveIndex::latestReport(const QString& pStation, Entry& pEntry)
+{
+    return searchLatestReport(pStation, nullptr, pEntry);
+}
+
+/*!
+ * \brief Get the latest existing report of a station preceding a report.
+ *
+ * Like latestReport() but only considers reports of the station of \p pReport that precede \p pReport,
+ * i.e. reports dated before the report date or, for the same date, with a lower serial number
+ * or an earlier duty begin time. The file of \p pReport itself is never returned.
+ *
+ * \param pReport The report to find the predecessor of.
+ * \param pEntry Destination for the entry of the preceding report.
+ * \return If a report was found.
+ */
+bool ReportArchiveIndex::previousReport(const Report& pReport, Entry& pEntry)
+{
+    return searchLatestReport(pReport.getStation(), &pReport, pEntry);
+}
+
+/*!
+ * \brief Get all reports within a date range.
+ *
+ * Note: The entries may be outdated or refer to deleted files (see isCurrent()).
+ *
+ * \param pFrom First date of the range.
+ * \param pTo Last date of the range.
+ * \param pStation Only get reports of this station (all stations, if empty).
+ * \return Entries of all matching reports, sorted by date and duty begin time.
+ */
+std::vector<ReportArchiveIndex::Entry> ReportArchiveIndex::reports(const QDate pFrom, const QDate pTo, const QString& pStation)
+{
+    std::vector<Entry> tEntries;
+
+    if (!opened)
+        return tEntries;
+
+    QSqlQuery query(QSqlDatabase::database(connectionName));
+
+    if (pStation == "")
+        query.prepare("SELECT * FROM Reports WHERE Date BETWEEN :from AND :to ORDER BY Date, BeginTime;");
+    else
+    {
+        query.prepare("SELECT * FROM Reports WHERE Station=:station AND Date BETWEEN :from AND :to ORDER BY Date, BeginTime;");
+        query.bindValue(":station", pStation);
+    }
+
+    query.bindValue(":from", pFrom.toString(Qt::ISODate));
+    query.bindValue(":to", pTo.toString(Qt::ISODate));
+
+    if (!query.exec())
+    {
+        std::cerr<<"ERROR: Could not query report archive index!"<<std::endl;
+        return tEntries;
+    }
+
+    while (query.next())
+        tEntries.push_back(entryFromQuery(query));
+
+    return tEntries;
+}
+
+//
+
+/*!
+ * \brief Load/calculate carryovers of a report from the last report file, using the index if possible.
+ *
+ * If \p pLastReportFileName is indexed and its entry is current (see isCurrent()), the carryovers of \p pReport
+ * are calculated from the indexed carryover summary (see Report::calculateCarryovers()) without loading the file.
+ * Otherwise the last report is loaded, indexed (see updateReport()) and used via Report::loadCarryovers().
+ *
+ * \param pLastReportFileName File name of the last report.
+ * \param pReport Report to load the carryovers for.
+ * \return If successful (i.e. false only, if the last report could not be loaded).
+ */
+bool ReportArchiveIndex::loadCarryovers(const QString& pLastReportFileName, Report& pReport)
+{
+    Entry tEntry;
+
+    if (find(pLastReportFileName, tEntry) && isCurrent(tEntry))
+    {
+        Report::CarryoverSummary tSummary = pReport.getCarryoverSummary();
+        Report::calculateCarryovers(tEntry.carryovers, tSummary);
+        pReport.setCarryovers(tSummary);
+
+        return true;
+    }
+
+    Report tLastReport;
+
+    if (!tLastReport.open(pLastReportFileName))
+        return false;
+
+    updateReport(tLastReport);
+
+    pReport.loadCarryovers(tLastReport);
+
+    return true;
+}
+
+//Private
+
+/*!
+ * \brief Create the index tables, if they do not exist.
+ *
+ * The index is only a cache of the report files. Hence, if the stored schema version differs
+ * from the current one, the tables are simply dropped and created again (i.e. emptied).
+ *
+ * The check and the changes are done in a single "BEGIN IMMEDIATE" transaction, such that multiple program
+ * instances opening the index at the same time cannot interfere with each other.
+ *
+ * \return If successful.
+ */
+bool ReportArchiveIndex::createTables()
+{
+    QSqlQuery query(QSqlDatabase::database(connectionName));
+
+    //Allow reading while another program instance writes to the index
+    query.exec("PRAGMA journal_mode=WAL;");
+
+    //Take the write lock before checking the version such that another program instance
+    //cannot drop or create the tables in between (it waits for the lock instead, see open())
+    if (!query.exec("BEGIN IMMEDIATE;"))
+        return false;
+
+    if (!query.exec("PRAGMA user_version;") || !query.next())
+    {
+        query.exec("ROLLBACK;");
+        return false;
+    }
+
+    if (query.value(0).toInt() == schemaVersion)
+        return query.exec("COMMIT;");
+
+    bool success = true;
+
+    success &= query.exec("DROP TABLE IF EXISTS Reports;");
+    success &= query.exec("CREATE TABLE IF NOT EXISTS Reports ("
+                          "Path TEXT PRIMARY KEY,"
+                          "MTime INT,"
+                          "Size INT,"
+                          "Number INT,"
+                          "Station TEXT,"
+                          "Date TEXT,"
+                          "BeginTime TEXT,"
+                          "EndTime TEXT,"
+                          "PersonnelSize INT,"
+                          "DrivesCount INT,"
+                          "PersonnelMinutes INT,"
+                          "BoatMinutes INT,"
+                          "PersonnelMinutesCarry INT,"
+                          "BoatMinutesCarry INT,"
+                          "EngineHoursInitial REAL,"
+                          "EngineHoursFinal REAL"
+                          ");");
+    success &= query.exec("CREATE INDEX IF NOT EXISTS ReportsStationDate ON Reports (Station, Date);");
+    success &= query.exec("CREATE INDEX IF NOT EXISTS ReportsDate ON Reports (Date);");
+    success &= query.exec("PRAGMA user_version=" + QString::number(schemaVersion) + ";");
+
+    if (!success || !query.exec("COMMIT;"))
+    {
+        query.exec("ROLLBACK;");
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Insert or replace an index entry.
+ *
+ * \param pEntry Index entry.
+ * \return If successful.
+ */
+bool ReportArchiveIndex::writeEntry(const Entry& pEntry)
+{
+    QSqlQuery query(QSqlDatabase::database(connectionName));
+
+    query.prepare("INSERT OR REPLACE INTO Reports (Path, MTime, Size, Number, Station, Date, BeginTime, EndTime, "
+                  "PersonnelSize, DrivesCount, PersonnelMinutes, BoatMinutes, PersonnelMinutesCarry, BoatMinutesCarry, "
+                  "EngineHoursInitial, EngineHoursFinal) "
+                  "VALUES (:path, :mtime, :size, :number, :station, :date, :begin, :end, :personnelSize, :drivesCount, "
+                  ":personnelMinutes, :boatMinutes, :personnelCarry, :boatCarry, :engineInitial, :engineFinal);");
+
+    query.bindValue(":path", pEntry.fileName);
+    query.bindValue(":mtime", pEntry.lastModified.toMSecsSinceEpoch());
+    query.bindValue(":size", pEntry.fileSize);
+    query.bindValue(":number", pEntry.carryovers.number);
+    query.bindValue(":station", pEntry.station);
+    query.bindValue(":date", pEntry.date.toString(Qt::ISODate));
+    query.bindValue(":begin", pEntry.beginTime.toString("hh:mm"));
+    query.bindValue(":end", pEntry.endTime.toString("hh:mm"));
+    query.bindValue(":personnelSize", pEntry.personnelSize);
+    query.bindValue(":drivesCount", pEntry.drivesCount);
+    query.bindValue(":personnelMinutes", pEntry.carryovers.personnelMinutes);
+    query.bindValue(":boatMinutes", pEntry.carryovers.boatMinutes);
+    query.bindValue(":personnelCarry", pEntry.carryovers.personnelMinutesCarry);
+    query.bindValue(":boatCarry", pEntry.carryovers.boatMinutesCarry);
+    query.bindValue(":engineInitial", pEntry.carryovers.engineHoursInitial);
+    query.bindValue(":engineFinal", pEntry.carryovers.engineHoursFinal);
+
+    if (!query.exec())
+    {
+        std::cerr<<"ERROR: Could not write report \""<<pEntry.fileName.toStdString()<<"\" to archive index!"<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Create an index entry from a loaded report.
+ *
+ * Takes the modification time and size from the current file \p pFileName.
+ *
+ * \param pReport Report loaded from (or saved to) \p pFileName.
+ * \param pFileName File name of the report.
+ * \return Index entry.
+ */
+ReportArchiveIndex::Entry ReportArchiveIndex::entryFromReport(const Report& pReport, const QString& pFileName)
+{
+    QFileInfo fileInfo(pFileName);
+
+    Entry tEntry;
+
+    tEntry.fileName = fileInfo.absoluteFilePath();
+    tEntry.lastModified = fileInfo.lastModified();
+    tEntry.fileSize = fileInfo.size();
+    tEntry.station = pReport.getStation();
+    tEntry.date = pReport.getDate();
+    tEntry.beginTime = pReport.getBeginTime();
+    tEntry.endTime = pReport.getEndTime();
+    tEntry.personnelSize = pReport.getPersonnelSize();
+    tEntry.drivesCount = pReport.boatLog()->getDrivesCount();
+    tEntry.carryovers = pReport.getCarryoverSummary();
+
+    return tEntry;
+}
+
+/*!
+ * \brief Get the latest existing report of a station, optionally preceding a report.
+ *
+ * Searches the indexed reports of station \p pStation by descending date (and serial number) for the first file
+ * that still exists. If \p pSuccessor is not nullptr, only reports preceding \p pSuccessor are considered
+ * (see previousReport()). Entries of deleted files are removed. Entries of changed files are refreshed
+ * (see update()) and the search is repeated once, since a changed report may have a different date now.
+ *
+ * \param pStation Station identifier.
+ * \param pSuccessor Only consider reports preceding this report (or all reports, if nullptr).
+ * \param pEntry Destination for the entry of the found report.
+ * \return If a report was found.
+ */
+bool ReportArchiveIndex::searchLatestReport(const QString& pStation, const Report* pSuccessor, Entry& pEntry)
+{
+    if (!opened)
+        return false;
+
+    for (int tAttempt = 0; tAttempt < 2; ++tAttempt)
+    {
+        bool tFound = false;
+        QStringList tDeletedFiles, tChangedFiles;
+
+        {
+            QSqlQuery query(QSqlDatabase::database(connectionName));
+
+            if (pSuccessor == nullptr)
+                query.prepare("SELECT * FROM Reports WHERE Station=:station ORDER BY Date DESC, Number DESC;");
+            else
+            {
+                query.prepare("SELECT * FROM Reports WHERE Station=:station AND Path<>:path AND "
+                              "(Date<:date OR (Date=:date AND (Number<:number OR BeginTime<:begin))) "
+                              "ORDER BY Date DESC, Number DESC, BeginTime DESC;");
+                query.bindValue(":path", QFileInfo(pSuccessor->getFileName()).absoluteFilePath());
+                query.bindValue(":date", pSuccessor->getDate().toString(Qt::ISODate));
+                query.bindValue(":number", pSuccessor->getNumber());
+                query.bindValue(":begin", pSuccessor->getBeginTime().toString("hh:mm"));
+            }
+            query.bindValue(":station", pStation);
+
+            if (!query.exec())
+                return false;
+
+            while (query.next())
+            {
+                Entry tEntry = entryFromQuery(query);
+
+                if (!QFileInfo::exists(tEntry.fileName))
+                    tDeletedFiles.append(tEntry.fileName);
+                else if (!isCurrent(tEntry))
+                    tChangedFiles.append(tEntry.fileName);
+                else
+                {
+                    pEntry = std::move(tEntry);
+                    tFound = true;
+                    break;
+                }
+            }
+        }
+
+        for (const QString& tPath : tDeletedFiles)
+            remove(tPath);
+
+        if (tChangedFiles.isEmpty() || tAttempt == 1)
+            return tFound;
+
+        QStringList tErrors;
+        update(tChangedFiles, tErrors);
+    }
+
+    return false;
+}
+
+/*!
+ * \brief Create an index entry from a selected table row.
+ *
+ * \param pQuery Query positioned on a row selected with "SELECT *" from the reports table.
+ * \return Index entry.
+ */
+ReportArchiveIndex::Entry ReportArchiveIndex::entryFromQuery(const QSqlQuery& pQuery)
+{
+    Entry tEntry;
+
+    tEntry.fileName = pQuery.value("Path").toString();
+    tEntry.lastModified = QDateTime::fromMSecsSinceEpoch(pQuery.value("MTime").toLongLong());
+    tEntry.fileSize = pQuery.value("Size").toLongLong();
+    tEntry.station = pQuery.value("Station").toString();
+    tEntry.date = QDate::fromString(pQuery.value("Date").toString(), Qt::ISODate);
+    tEntry.beginTime = QTime::fromString(pQuery.value("BeginTime").toString(), "hh:mm");
+    tEntry.endTime = QTime::fromString(pQuery.value("EndTime").toString(), "hh:mm");
+    tEntry.personnelSize = pQuery.value("PersonnelSize").toInt();
+    tEntry.drivesCount = pQuery.value("DrivesCount").toInt();
+
+    tEntry.carryovers.number = pQuery.value("Number").toInt();
+    tEntry.carryovers.personnelMinutes = pQuery.value("PersonnelMinutes").toInt();
+    tEntry.carryovers.boatMinutes = pQuery.value("BoatMinutes").toInt();
+    tEntry.carryovers.personnelMinutesCarry = pQuery.value("PersonnelMinutesCarry").toInt();
+    tEntry.carryovers.boatMinutesCarry = pQuery.value("BoatMinutesCarry").toInt();
+    tEntry.carryovers.engineHoursInitial = pQuery.value("EngineHoursInitial").toDouble();
+    tEntry.carryovers.engineHoursFinal = pQuery.value("EngineHoursFinal").toDouble();
+
+    return tEntry;
+}
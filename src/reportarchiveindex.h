@@ -0,0 +1,120 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef REPORTARCHIVEINDEX_H
+#define REPORTARCHIVEINDEX_H
+
+#include "report.h"
+
+#include <QDate>
+#include <QDateTime>
+#include <QString>
+#include <QStringList>
+#include <QTime>
+#include <QtSql/QSqlQuery>
+
+#include <vector>
+
+/*!
+ * \brief Persistent index of saved report files for fast search and listing.
+ *
+ * Keeps a summary of each known report file in a separate SQLite database "archive.sqlite3" next to the
+ * configuration database (see open()). For each file its path, modification time and size are recorded together
+ * with the serial number, station, date, duty times, personnel strength, number of boat drives and the carryover
+ * summary (see Report::CarryoverSummary), which also contains the gained personnel and boat drive hours.
+ *
+ * The index is only a cache of the report files. Entries are added or refreshed whenever a report is opened or saved
+ * (see updateReport()) or explicitly for a list of files or a whole directory (see update() and updateDirectory()).
+ * Files whose modification time and size did not change are skipped, so repeated updates are cheap. Changed files
+ * are loaded in parallel (see ParallelJobs::run()). Since each query result is checked against the current file
+ * modification time before it is used (see isCurrent()), an outdated entry never leads to wrong carryovers.
+ *
+ * Queries like latestReport() ("latest report of a station") or reports() ("all reports in June") are answered
+ * from indexed columns without loading any report file. loadCarryovers() uses the indexed carryover summary of the
+ * last report instead of loading the whole report, if the entry is current.
+ *
+ * All functions must be called from the main thread. If the index could not be opened, queries return
+ * no results and updates do nothing, i.e. the program falls back to loading report files directly.
+ */
+class ReportArchiveIndex
+{
+public:
+    /*!
+     * \brief Indexed summary of a report file.
+     */
+    struct Entry
+    {
+        QString fileName;                       ///< Absolute path of the report file.
+        QDateTime lastModified;                 ///< Modification time of the file when it was indexed.
+        qint64 fileSize = 0;                    ///< Size of the file when it was indexed.
+        QString station;                        ///< Station identifier.
+        QDate date;                             ///< Report date.
+        QTime beginTime;                        ///< Duty begin time.
+        QTime endTime;                          ///< Duty end time.
+        int personnelSize = 0;                  ///< Personnel strength.
+        int drivesCount = 0;                    ///< Number of boat drives.
+        Report::CarryoverSummary carryovers;    ///< Serial number, carryovers and gained hours.
+    };
+
+public:
+    ReportArchiveIndex() = delete;  ///< Deleted constructor.
+    //
+    static bool open(const QString& pFileName);     ///< Open (or create) the index database.
+    static void close();                            ///< Close the index database.
+    static bool isOpen();                           ///< Check, if the index database is open.
+    //
+    static bool updateReport(const Report& pReport);                    ///< Add or refresh the entry of a loaded/saved report.
+    static int update(const QStringList& pFileNames, QStringList& pErrors,
+                      int pJobs = 0);                                   ///< Add or refresh the entries of report files, if changed.
+    static int updateDirectory(const QString& pDirName, bool pRecursive,
+                               QStringList& pErrors, int pJobs = 0);    ///< \brief Add or refresh the entries of all report files
+                                                                        ///  in a directory and remove entries of deleted files.
+    static bool remove(const QString& pFileName);                       ///< Remove the entry of a report file.
+    //
+    static bool find(const QString& pFileName, Entry& pEntry);          ///< Get the entry of a report file.
+    static bool isCurrent(const Entry& pEntry);                         ///< Check, if an entry matches the current file on disk.
+    static bool latestReport(const QString& pStation, Entry& pEntry);   ///< Get the latest existing report of a station.
+    static bool previousReport(const Report& pReport, Entry& pEntry);   ///< Get the latest existing report of a station preceding a report.
+    static std::vector<Entry> reports(QDate pFrom, QDate pTo,
+                                      const QString& pStation = "");    ///< Get all reports within a date range.
+    //
+    static bool loadCarryovers(const QString& pLastReportFileName,
+                               Report& pReport);                        ///< \brief Load/calculate carryovers of a report from the
+                                                                        ///  last report file, using the index if possible.
+
+private:
+    static bool createTables();                                         ///< Create the index tables, if they do not exist.
+    static bool writeEntry(const Entry& pEntry);                        ///< Insert or replace an index entry.
+    static Entry entryFromReport(const Report& pReport,
+                                 const QString& pFileName);             ///< Create an index entry from a loaded report.
+    static Entry entryFromQuery(const QSqlQuery& pQuery);               ///< Create an index entry from a selected table row.
+    static bool searchLatestReport(const QString& pStation, const Report* pSuccessor,
+                                   Entry& pEntry);                      ///< \brief Get the latest existing report of a station,
+                                                                        ///  optionally preceding a report.
+
+private:
+    static bool opened;                             //Index database opened by open()?
+    static const QString connectionName;            //Name of the index database connection
+    static constexpr int schemaVersion = 1;         //Version of the index tables (stored as SQLite 'user_version')
+};
+
+#endif // REPORTARCHIVEINDEX_H
@@ -25,9 +25,12 @@
 
 #include "boatdrive.h"
 #include "databasecache.h"
+#include "databasewatcher.h"
 #include "pdfexporter.h"
 #include "personneleditordialog.h"
+#include "personsearchindex.h"
 #include "qualificationchecker.h"
+#include "reportarchiveindex.h"
 #include "settingscache.h"
 #include "updatereportpersonentrydialog.h"
 
@@ -56,8 +59,6 @@
 #include <QPlainTextEdit>
 #include <QRegularExpressionValidator>
 #include <QShortcut>
-#include <QStandardItem>
-#include <QStandardItemModel>
 #include <QStandardPaths>
 #include <QStatusBar>
 #include <QTableWidget>
@@ -67,6 +68,7 @@
 
 #include <chrono>
 #include <functional>
+#include <memory>
 #include <set>
 #include <thread>
 
@@ -120,7 +122,13 @@ ReportWindow::ReportWindow(Report&& pReport, QWidget *const pParent) :
     loadedStationRadioCallName(""),
     loadedBoat(""),
     loadedBoatRadioCallName(""),
-    selectedBoatmanIdent("")
+    selectedBoatmanIdent(""),
+    nameCompletionIndex(NameCompletionIndex::current()),
+    lastNameCompletionModel(nullptr),
+    firstNameCompletionModel(nullptr),
+    personSuggestionsTimer(new QTimer(this)),
+    personSuggestionsCompleter(new QCompleter(this)),
+    personSuggestionsModel(new QStringListModel(personSuggestionsCompleter))
 {
     ui->setupUi(this);
 
@@ -203,7 +211,7 @@ ReportWindow::ReportWindow(Report&& pReport, QWidget *const pParent) :
     QGridLayout* tDocsGroupBoxLayout = new QGridLayout(ui->documents_groupBox);
 
     std::vector<std::pair<QString, QString>> tDocs = Aux::parseDocumentListString(
-                                                         SettingsCache::getStrSetting("app_documentLinks_documentList"));
+                                                         SettingsCache::getStrSetting(SettingsCache::StrSetting::_DOCUMENT_LINK_LIST));
 
     for (const std::pair<QString, QString>& tPair : tDocs)
     {
@@ -380,28 +388,43 @@ ReportWindow::ReportWindow(Report&& pReport, QWidget *const pParent) :
     lastNameCompleter->setCompletionMode(QCompleter::PopupCompletion);
     firstNameCompleter->setCompletionMode(QCompleter::PopupCompletion);
 
+    //Serve names directly from the (shared, case-insensitively sorted) name completion index to allow binary search
+
+    lastNameCompletionModel = new NameCompletionModel(NameCompletionModel::NameType::_LAST, lastNameCompleter);
+    firstNameCompletionModel = new NameCompletionModel(NameCompletionModel::NameType::_FIRST, firstNameCompleter);
+
+    lastNameCompleter->setModel(lastNameCompletionModel);
+    firstNameCompleter->setModel(firstNameCompletionModel);
+
+    lastNameCompleter->setModelSorting(QCompleter::CaseInsensitivelySortedModel);
+    firstNameCompleter->setModelSorting(QCompleter::CaseInsensitivelySortedModel);
+
     ui->personLastName_lineEdit->setCompleter(lastNameCompleter);
     ui->personFirstName_lineEdit->setCompleter(firstNameCompleter);
 
-    std::vector<Person> dbPersonnel;
-    DatabaseCache::getPersonnel(dbPersonnel);
+    //Get available first and last names from personnel database and fill completers with these names
+    updateDatabasePersonNames();
 
-    //Collect available first and last names from personnel database
-    for (const Person& tPerson : dbPersonnel)
-    {
-        const QString& tLastName = tPerson.getLastName();
-        const QString& tFirstName = tPerson.getFirstName();
+    //Suggest similar persons (typo-tolerant) if the entered name does not match any person; wait until typing paused
 
-        if (!databaseLastNames.contains(tLastName))
-            databaseLastNames.push_back(tLastName);
+    personSuggestionsCompleter->setModel(personSuggestionsModel);
+    personSuggestionsCompleter->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    personSuggestionsCompleter->setMaxVisibleItems(10);
 
-        if (!databaseFirstNames.contains(tFirstName))
-            databaseFirstNames.push_back(tFirstName);
-    }
+    connect(personSuggestionsCompleter, QOverload<const QModelIndex&>::of(&QCompleter::activated),
+            this, &ReportWindow::on_personSuggestionActivated);
 
-    //Fill completers with collected names
-    updatePersonLastNameCompletions();
-    updatePersonFirstNameCompletions();
+    personSuggestionsTimer->setSingleShot(true);
+    personSuggestionsTimer->setInterval(250);
+    connect(personSuggestionsTimer, &QTimer::timeout, this, &ReportWindow::on_personSuggestionsTimerTimeout);
+
+    //Update the collected names or the selectable stations and boats whenever the personnel or configuration database
+    //is changed by another application instance
+    if (DatabaseWatcher* databaseWatcher = DatabaseWatcher::instance())
+    {
+        connect(databaseWatcher, &DatabaseWatcher::personnelChanged, this, &ReportWindow::on_databasePersonnelChanged);
+        connect(databaseWatcher, &DatabaseWatcher::configChanged, this, &ReportWindow::on_databaseConfigChanged);
+    }
 
     //Enable drag and drop in order to open further reports being dropped on the window
     setAcceptDrops(true);
@@ -418,7 +441,7 @@ ReportWindow::ReportWindow(Report&& pReport, QWidget *const pParent) :
         addResourcesTableRow("", report.getBeginTime(), report.getEndTime());
 
     //Disable and hide whole boat tab if boat log keeping is disabled as it is not needed in that case
-    if (SettingsCache::getBoolSetting("app_boatLog_disabled"))
+    if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED))
     {
         ui->boat_tab->setEnabled(false);
         ui->report_tabWidget->setTabVisible(1, false);
@@ -734,7 +757,7 @@ void ReportWindow::loadReportData()
     setUnsavedChanges(false);
 
     //Warn about having loaded non-empty boat log although boat log keeping is disabled in settings
-    if (SettingsCache::getBoolSetting("app_boatLog_disabled"))
+    if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED))
     {
         if (boatLogPtr->getBoat() != "" || boatLogPtr->getRadioCallName() != "" || boatLogPtr->getComments() != "" ||
                 boatLogPtr->getSlippedInitial() || boatLogPtr->getSlippedFinal() ||
@@ -766,7 +789,8 @@ void ReportWindow::loadReportData()
  * to check its report date and thus to prevent accidentally overwriting it if the report dates differ.
  * A warning message will be displayed if they differ or if loading the existing file fails for some reason.
  *
- * If writing the file was successful, the displayed file name is updated and the 'unsaved changes' switch is reset.
+ * If writing the file was successful, the displayed file name is updated, the 'unsaved changes' switch is reset
+ * and the report archive index is updated (see ReportArchiveIndex::updateReport()).
  * Also, if an automatic export on save is configured in the settings, autoExport() will be called at the end of the function.
  *
  * \param pFileName Path to write the report file to.
@@ -776,7 +800,7 @@ void ReportWindow::saveReport(const QString& pFileName)
     //Not include newest boat drive changes?
     if (unappliedBoatDriveChanges)
     {
-        if (SettingsCache::getBoolSetting("app_reportWindow_autoApplyBoatDriveChanges"))
+        if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES))
             on_applyBoatDriveChanges_pushButton_pressed();
         else
         {
@@ -823,7 +847,7 @@ void ReportWindow::saveReport(const QString& pFileName)
         return;
 
     //Automatically export as PDF after saving?
-    bool tAutoExport = SettingsCache::getBoolSetting("app_export_autoOnSave");
+    bool tAutoExport = SettingsCache::getBoolSetting(SettingsCache::IntSetting::_EXPORT_AUTO_ON_SAVE);
 
     ui->statusbar->showMessage("Speichere als \"" + pFileName + "\"...");
 
@@ -847,6 +871,9 @@ void ReportWindow::saveReport(const QString& pFileName)
         //Show file name in status bar on success
         statusBarLabel->setText("Datei: " + pFileName);
 
+        //Keep report archive index up to date with each saved report
+        ReportArchiveIndex::updateReport(report);
+
         //No unsaved changes anymore...
         setUnsavedChanges(false);
 
@@ -924,7 +951,7 @@ void ReportWindow::exportReportToFileName(const QString& pFileName, const bool p
 
     if (unappliedBoatDriveChanges)
     {
-        if (SettingsCache::getBoolSetting("app_reportWindow_autoApplyBoatDriveChanges"))
+        if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES))
             on_applyBoatDriveChanges_pushButton_pressed();
         else
         {
@@ -956,11 +983,15 @@ void ReportWindow::exportReportToFileName(const QString& pFileName, const bool p
 
     exporting.store(true);
 
-    //Call export function (and clearing of status bar label) in detached thread to keep UI responsive
+    //Call export function (and clearing of status bar label) in detached thread to keep UI responsive;
+    //report (deep copy including its boat log, see Report::Report(const Report&)) and export settings are copied here,
+    //such that the export itself does not access any report or settings data that the UI may change meanwhile
     std::thread exportThread(
-                [this, pFileName]() -> void
+                [this, pFileName, tReport = report, tSettings = PDFExporter::currentExportSettings(),
+                 tPersonnelTableMaxLength = exportPersonnelTableMaxLength,
+                 tBoatDrivesTableMaxLength = exportBoatDrivesTableMaxLength]() -> void
                 {
-                    if (!PDFExporter::exportPDF(report, pFileName, exportPersonnelTableMaxLength, exportBoatDrivesTableMaxLength))
+                    if (!PDFExporter::exportPDF(tReport, pFileName, tSettings, tPersonnelTableMaxLength, tBoatDrivesTableMaxLength))
                     {
                         latestExportFailed.store(true);
                         emit exportFailed();
@@ -1067,7 +1098,7 @@ void ReportWindow::exportReport(const bool pOpenPDF)
  */
 void ReportWindow::autoExport()
 {
-    if (SettingsCache::getBoolSetting("app_export_autoOnSave_askForFileName") || report.getFileName() == "")
+    if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_EXPORT_AUTO_ON_SAVE_ASK_FILE_NAME) || report.getFileName() == "")
         on_exportFile_action_triggered();
     else
     {
@@ -1144,7 +1175,7 @@ bool ReportWindow::checkInvalidValues()
     }
 
     //Only warn about empty boat name if boat log is enabled
-    if (boatLogPtr->getBoat() == "" && !SettingsCache::getBoolSetting("app_boatLog_disabled"))
+    if (boatLogPtr->getBoat() == "" && !SettingsCache::getBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED))
     {
         QMessageBox msgBox(QMessageBox::Warning, "Kein Boot", "Boot nicht gesetzt.\nTrotzdem fortfahren?",
                            QMessageBox::Abort | QMessageBox::Yes, this);
@@ -1155,7 +1186,7 @@ bool ReportWindow::checkInvalidValues()
     }
 
     //Only warn about empty boat radio call name if boat log is enabled
-    if (boatLogPtr->getRadioCallName() == "" && !SettingsCache::getBoolSetting("app_boatLog_disabled"))
+    if (boatLogPtr->getRadioCallName() == "" && !SettingsCache::getBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED))
     {
         QMessageBox msgBox(QMessageBox::Warning, "Kein Funkrufname", "Boots-Funkrufname nicht gesetzt.\nTrotzdem fortfahren?",
                            QMessageBox::Abort | QMessageBox::Yes, this);
@@ -1191,7 +1222,8 @@ bool ReportWindow::checkInvalidValues()
         }
     }
 
-    if (!SettingsCache::getBoolSetting("app_boatLog_disabled")) //Do not warn about boat log contents if boat log is disabled
+    //Do not warn about boat log contents if boat log is disabled
+    if (!SettingsCache::getBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED))
     {
         if (boatLogPtr->getReadyUntil() != QTime(0, 0) && boatLogPtr->getReadyFrom().secsTo(boatLogPtr->getReadyUntil()) < 0)
         {
@@ -1364,7 +1396,8 @@ bool ReportWindow::checkImplausibleValues()
             return false;
     }
 
-    if (!SettingsCache::getBoolSetting("app_boatLog_disabled")) //Do not warn about boat log contents if boat log is disabled
+    //Do not warn about boat log contents if boat log is disabled
+    if (!SettingsCache::getBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED))
     {
         if (boatLogPtr->getBoatMinutesCarry() == 0)
         {
@@ -1630,6 +1663,23 @@ void ReportWindow::updateWindowTitle()
     setWindowTitle(title);
 }
 
+/*!
+ * \brief Collect first and last names from personnel database for the name completions.
+ *
+ * Gets the (shared) index of all available first and last names from the personnel database cache
+ * (see NameCompletionIndex::current()) and updates the last and first name completions afterwards.
+ */
+void ReportWindow::updateDatabasePersonNames()
+{
+    nameCompletionIndex = NameCompletionIndex::current();
+
+    lastNameCompletionModel->setIndex(nameCompletionIndex);
+    firstNameCompletionModel->setIndex(nameCompletionIndex);
+
+    updatePersonLastNameCompletions();
+    updatePersonFirstNameCompletions();
+}
+
 /*!
  * \brief Update last name completions according to currently entered first name.
  *
@@ -1641,36 +1691,9 @@ void ReportWindow::updateWindowTitle()
  */
 void ReportWindow::updatePersonLastNameCompletions()
 {
-    QStringList filteredLastNameCompletions;
-
     //If current first name matches at least one person from personnel database, use those persons' last names as completions;
-    //use all existing persons' last names as completions otherwise
-
-    if (databaseFirstNames.contains(ui->personFirstName_lineEdit->text()))
-    {
-        std::vector<Person> dbPersonnel;
-        DatabaseCache::getPersonnel(dbPersonnel);
-
-        for (const Person& tPerson : dbPersonnel)
-        {
-            if (tPerson.getFirstName() == ui->personFirstName_lineEdit->text())
-            {
-                if (!filteredLastNameCompletions.contains(tPerson.getLastName()))
-                    filteredLastNameCompletions.push_back(tPerson.getLastName());
-            }
-        }
-    }
-    else
-        filteredLastNameCompletions = databaseLastNames;
-
-    //Apply prepared list of last name completions to completer
-
-    QStandardItemModel* lastNameModel = new QStandardItemModel(ui->personLastName_lineEdit->completer());
-
-    for (const QString& tLastName : filteredLastNameCompletions)
-        lastNameModel->appendRow(new QStandardItem(tLastName));
-
-    ui->personLastName_lineEdit->completer()->setModel(lastNameModel);
+    //use all existing persons' last names as completions otherwise (negative position)
+    lastNameCompletionModel->showLinkedNames(nameCompletionIndex->findFirstName(ui->personFirstName_lineEdit->text()));
 }
 
 /*!
@@ -1684,36 +1707,9 @@ void ReportWindow::updatePersonLastNameCompletions()
  */
 void ReportWindow::updatePersonFirstNameCompletions()
 {
-    QStringList filteredFirstNameCompletions;
-
     //If current last name matches at least one person from personnel database, use those persons' first names as completions;
-    //use all existing persons' first names as completions otherwise
-
-    if (databaseLastNames.contains(ui->personLastName_lineEdit->text()))
-    {
-        std::vector<Person> dbPersonnel;
-        DatabaseCache::getPersonnel(dbPersonnel);
-
-        for (const Person& tPerson : dbPersonnel)
-        {
-            if (tPerson.getLastName() == ui->personLastName_lineEdit->text())
-            {
-                if (!filteredFirstNameCompletions.contains(tPerson.getFirstName()))
-                    filteredFirstNameCompletions.push_back(tPerson.getFirstName());
-            }
-        }
-    }
-    else
-        filteredFirstNameCompletions = databaseFirstNames;
-
-    //Apply prepared list of first name completions to completer
-
-    QStandardItemModel* firstNameModel = new QStandardItemModel(ui->personFirstName_lineEdit->completer());
-
-    for (const QString& tFirstName : filteredFirstNameCompletions)
-        firstNameModel->appendRow(new QStandardItem(tFirstName));
-
-    ui->personFirstName_lineEdit->completer()->setModel(firstNameModel);
+    //use all existing persons' first names as completions otherwise (negative position)
+    firstNameCompletionModel->showLinkedNames(nameCompletionIndex->findLastName(ui->personLastName_lineEdit->text()));
 }
 
 /*!
@@ -1937,13 +1933,16 @@ void ReportWindow::updateBoatDriveAvailablePersons()
     ui->boatDriveBoatman_comboBox->clear();
     ui->boatCrewMember_comboBox->clear();
 
+    //Read required boatman license only once instead of for each person
+    const QString tBoatmanRequiredLicense = QualificationChecker::boatmanRequiredLicense();
+
     for (const QString& tIdent : report.getPersonnel(true))
     {
         QString tLabel = personLabelFromIdent(tIdent);
 
         ui->boatCrewMember_comboBox->insertItem(ui->boatCrewMember_comboBox->count(), tLabel);
 
-        if (QualificationChecker::checkBoatman(report.getPerson(tIdent).getQualifications()))
+        if (QualificationChecker::checkBoatman(report.getPerson(tIdent).getQualifications(), tBoatmanRequiredLicense))
             ui->boatDriveBoatman_comboBox->insertItem(ui->boatDriveBoatman_comboBox->count(), tLabel);
     }
 
@@ -2175,6 +2174,9 @@ void ReportWindow::checkPersonInputs()
 
     ui->addPerson_pushButton->setEnabled(false);
 
+    personSuggestionsTimer->stop();
+    personSuggestionsCompleter->popup()->hide();
+
     if (ui->personLastName_lineEdit->text() == "" && ui->personFirstName_lineEdit->text() == "")
         return;
 
@@ -2186,10 +2188,13 @@ void ReportWindow::checkPersonInputs()
         //Highlight line edits in red as name does not match any person; do *not* highlight, though,
         //if either of first/last name is OK but no match just because last/first name is (still) empty
 
-        if (ui->personFirstName_lineEdit->text() != "" || !databaseLastNames.contains(ui->personLastName_lineEdit->text()))
+        if (ui->personFirstName_lineEdit->text() != "" || nameCompletionIndex->findLastName(ui->personLastName_lineEdit->text()) < 0)
             ui->personLastName_lineEdit->setStyleSheet("QLineEdit { color: red; }");
-        if (ui->personLastName_lineEdit->text() != "" || !databaseFirstNames.contains(ui->personFirstName_lineEdit->text()))
+        if (ui->personLastName_lineEdit->text() != "" || nameCompletionIndex->findFirstName(ui->personFirstName_lineEdit->text()) < 0)
             ui->personFirstName_lineEdit->setStyleSheet("QLineEdit { color: red; }");
+
+        //Suggest similar persons after a short delay (see on_personSuggestionsTimerTimeout())
+        personSuggestionsTimer->start();
     }
     else
     {
@@ -2347,10 +2352,14 @@ bool ReportWindow::personUsedForBoatDrive(const QString& pIdent) const
  */
 bool ReportWindow::personUsedAsBoatman(const QString& pIdent) const
 {
-    //Check for person in all boat drives
-    for (const BoatDrive& tDrive : boatLogPtr->getDrives())
-        if (tDrive.getBoatman() == pIdent)
-            return true;
+    //Check for person in all boat drives (person cannot be used, if identifier was never interned)
+
+    PersonIdentPool::Handle tHandle;
+
+    if (PersonIdentPool::lookup(pIdent, tHandle))
+        for (const BoatDrive& tDrive : boatLogPtr->getDrives())
+            if (tDrive.isBoatman(tHandle))
+                return true;
 
     //Also check for person in unapplied changes of selected drive
     if (ui->boatDrives_tableWidget->currentRow() != -1 && unappliedBoatDriveChanges)
@@ -2371,10 +2380,13 @@ bool ReportWindow::personUsedAsBoatman(const QString& pIdent) const
  */
 bool ReportWindow::personUsedAsBoatCrewMember(const QString& pIdent) const
 {
-    //Check for person in all boat drives
-    for (const BoatDrive& tDrive : boatLogPtr->getDrives())
-        for (const auto& it : tDrive.crew())
-            if (it.first == pIdent)
+    //Check for person in all boat drives (person cannot be used, if identifier was never interned)
+
+    PersonIdentPool::Handle tHandle;
+
+    if (PersonIdentPool::lookup(pIdent, tHandle))
+        for (const BoatDrive& tDrive : boatLogPtr->getDrives())
+            if (tDrive.hasCrewMember(tHandle))
                 return true;
 
     //Also check for person in unapplied changes of selected drive
@@ -2743,6 +2755,227 @@ void ReportWindow::on_exportFailed()
     QMessageBox(QMessageBox::Warning, "Exportieren fehlgeschlagen", "Fehler beim Exportieren!", QMessageBox::Ok, this).exec();
 }
 
+/*!
+ * \brief Update the personnel name completions after external personnel database changes.
+ *
+ * See updateDatabasePersonNames().
+ */
+void ReportWindow::on_databasePersonnelChanged()
+{
+    updateDatabasePersonNames();
+}
+
+/*!
+ * \brief Update the selectable stations and boats after external configuration database changes.
+ *
+ * Refills the station and boat combo boxes (and their radio call name combo boxes) with the stations and boats
+ * from the re-loaded database cache. The report's station, boat and radio call names are thereby kept unchanged,
+ * i.e. a station or boat (or radio call name) removed from the database remains selectable (see loadReportData()).
+ */
+void ReportWindow::on_databaseConfigChanged()
+{
+    std::map<QString, Aux::Station> tStations;
+    std::map<QString, Aux::Boat> tBoats;
+
+    //Use station identifier instead of 'rowid' as key
+    for (auto it : DatabaseCache::stations())
+    {
+        QString tStationIdent;
+        Aux::stationIdentFromNameLocation(it.second.name, it.second.location, tStationIdent);
+        tStations.insert({std::move(tStationIdent), std::move(it.second)});
+    }
+
+    //Use boat name instead of 'rowid' as key
+    for (auto it : DatabaseCache::boats())
+        tBoats.insert({it.second.name, std::move(it.second)});
+
+    //Stations
+
+    if (tStations != stations)
+    {
+        stations.swap(tStations);
+
+        const QString tStation = report.getStation();
+        const QString tRadioCallName = report.getRadioCallName();
+
+        //Only restore current selection, which must not be changed
+        ui->station_comboBox->blockSignals(true);
+        ui->stationRadioCallName_comboBox->blockSignals(true);
+
+        ui->station_comboBox->clear();
+        ui->stationRadioCallName_comboBox->clear();
+
+        for (const auto& it : stations)
+            ui->station_comboBox->insertItem(ui->station_comboBox->count(), Aux::stationLabelFromIdent(it.first));
+
+        if (tStation != "")
+        {
+            //Keep station selectable, if (now) not in database
+            if (stations.find(tStation) == stations.end())
+            {
+                loadedStation = tStation;
+                loadedStationRadioCallName = tRadioCallName;
+
+                ui->station_comboBox->insertItem(ui->station_comboBox->count(), Aux::stationLabelFromIdent(tStation));
+            }
+            else
+            {
+                const Aux::Station& tStationData = stations.at(tStation);
+
+                ui->stationRadioCallName_comboBox->insertItem(0, tStationData.radioCallName);
+                ui->stationRadioCallName_comboBox->insertItem(1, tStationData.radioCallNameAlt);
+            }
+
+            if (tRadioCallName != "" && ui->stationRadioCallName_comboBox->findText(tRadioCallName) == -1)
+                ui->stationRadioCallName_comboBox->insertItem(ui->stationRadioCallName_comboBox->count(), tRadioCallName);
+
+            ui->station_comboBox->setCurrentIndex(ui->station_comboBox->findText(Aux::stationLabelFromIdent(tStation)));
+            ui->stationRadioCallName_comboBox->setCurrentIndex(ui->stationRadioCallName_comboBox->findText(tRadioCallName));
+        }
+        else
+            ui->station_comboBox->setCurrentIndex(-1);
+
+        ui->station_comboBox->blockSignals(false);
+        ui->stationRadioCallName_comboBox->blockSignals(false);
+    }
+
+    //Boats
+
+    if (tBoats != boats)
+    {
+        boats.swap(tBoats);
+
+        const QString tBoat = boatLogPtr->getBoat();
+        const QString tRadioCallName = boatLogPtr->getRadioCallName();
+
+        //Only restore current selection, which must not be changed
+        ui->boat_comboBox->blockSignals(true);
+        ui->boatRadioCallName_comboBox->blockSignals(true);
+
+        ui->boat_comboBox->clear();
+        ui->boatRadioCallName_comboBox->clear();
+
+        for (const auto& it : boats)
+            ui->boat_comboBox->insertItem(ui->boat_comboBox->count(), it.first);
+
+        if (tBoat != "")
+        {
+            //Keep boat selectable, if (now) not in database
+            if (boats.find(tBoat) == boats.end())
+            {
+                loadedBoat = tBoat;
+                loadedBoatRadioCallName = tRadioCallName;
+
+                ui->boat_comboBox->insertItem(ui->boat_comboBox->count(), tBoat);
+            }
+            else
+            {
+                const Aux::Boat& tBoatData = boats.at(tBoat);
+
+                ui->boatRadioCallName_comboBox->insertItem(0, tBoatData.radioCallName);
+                ui->boatRadioCallName_comboBox->insertItem(1, tBoatData.radioCallNameAlt);
+            }
+
+            if (tRadioCallName != "" && ui->boatRadioCallName_comboBox->findText(tRadioCallName) == -1)
+                ui->boatRadioCallName_comboBox->insertItem(ui->boatRadioCallName_comboBox->count(), tRadioCallName);
+
+            ui->boat_comboBox->setCurrentIndex(ui->boat_comboBox->findText(tBoat));
+            ui->boatRadioCallName_comboBox->setCurrentIndex(ui->boatRadioCallName_comboBox->findText(tRadioCallName));
+        }
+        else
+            ui->boat_comboBox->setCurrentIndex(-1);
+
+        ui->boat_comboBox->blockSignals(false);
+        ui->boatRadioCallName_comboBox->blockSignals(false);
+    }
+}
+
+/*!
+ * \brief Suggest persons similar to the entered name.
+ *
+ * Searches the personnel database for active persons similar to the currently entered last and first name
+ * (typo-tolerant, see PersonSearchIndex) and shows the best matches (that are not yet part of the report personnel)
+ * in a popup below the focused name line edit. Nothing is shown, if neither name line edit has focus or
+ * if the line edit's (exact prefix) name completions are already shown.
+ *
+ * See also on_personSuggestionActivated().
+ */
+void ReportWindow::on_personSuggestionsTimerTimeout()
+{
+    QLineEdit* tLineEdit = nullptr;
+
+    if (ui->personLastName_lineEdit->hasFocus())
+        tLineEdit = ui->personLastName_lineEdit;
+    else if (ui->personFirstName_lineEdit->hasFocus())
+        tLineEdit = ui->personFirstName_lineEdit;
+    else
+        return;
+
+    if (tLineEdit->completer() != nullptr && tLineEdit->completer()->popup()->isVisible())
+        return;
+
+    QString tQuery = ui->personLastName_lineEdit->text() + " " + ui->personFirstName_lineEdit->text();
+
+    //Keep index alive while using the matches
+    std::shared_ptr<const PersonSearchIndex> tSearchIndex = PersonSearchIndex::current();
+
+    QStringList tLabels;
+    personSuggestionsIdents.clear();
+
+    for (const PersonSearchIndex::Match& tMatch : tSearchIndex->search(tQuery, 10, true))
+    {
+        const Person& tPerson = *tMatch.person;
+
+        if (report.personExists(tPerson.getIdent()))
+            continue;
+
+        QString tLabel = tPerson.getLastName() + ", " + tPerson.getFirstName();
+
+        if (Person::isInternalIdent(tPerson.getIdent()))
+            tLabel.append(" (" + Person::extractMembershipNumber(tPerson.getIdent()) + ")");
+
+        tLabels.append(tLabel);
+        personSuggestionsIdents.push_back(tPerson.getIdent());
+    }
+
+    if (tLabels.isEmpty())
+        return;
+
+    personSuggestionsModel->setStringList(tLabels);
+
+    personSuggestionsCompleter->setWidget(tLineEdit);
+    personSuggestionsCompleter->complete();
+}
+
+/*!
+ * \brief Enter the name of a suggested person.
+ *
+ * Sets the last and first name line edits to the name of the suggested person at \p pIndex
+ * and selects the person's identifier (in case of ambiguous names).
+ *
+ * See also on_personSuggestionsTimerTimeout().
+ *
+ * \param pIndex Model index of the selected suggestion.
+ */
+void ReportWindow::on_personSuggestionActivated(const QModelIndex& pIndex)
+{
+    if (!pIndex.isValid() || pIndex.row() >= static_cast<int>(personSuggestionsIdents.size()))
+        return;
+
+    QString tIdent = personSuggestionsIdents.at(pIndex.row());
+
+    Person tPerson = Person::dummyPerson();
+    if (!DatabaseCache::getPerson(tPerson, tIdent))
+        return;
+
+    ui->personLastName_lineEdit->setText(tPerson.getLastName());
+    ui->personFirstName_lineEdit->setText(tPerson.getFirstName());
+
+    int tIdentIdx = ui->personIdent_comboBox->findText(tIdent);
+    if (tIdentIdx >= 0)
+        ui->personIdent_comboBox->setCurrentIndex(tIdentIdx);
+}
+
 //
 
 /*!
@@ -2775,7 +3008,7 @@ void ReportWindow::on_saveFileAs_action_triggered()
     //If saving for the first time, pre-fill file name with formatted report date according to configured preset
     if (report.getFileName() == "")
     {
-        QString fileNamePreset = SettingsCache::getStrSetting("app_default_reportFileNamePreset");
+        QString fileNamePreset = SettingsCache::getStrSetting(SettingsCache::StrSetting::_DEFAULT_REPORT_FILE_NAME_PRESET);
         if (fileNamePreset != "")
             fileDialog.selectFile(report.getDate().toString(fileNamePreset).append(".wbr"));
     }
@@ -2827,25 +3060,31 @@ void ReportWindow::on_exportAndOpenFile_action_triggered()
 /*!
  * \brief Load old report carryovers from a file.
  *
- * Asks for an old report file name and loads the report's carryovers from this old report (see Report::loadCarryovers()).
+ * Asks for an old report file name and loads the report's carryovers from this old report (see ReportArchiveIndex::loadCarryovers()).
+ * The file dialog preselects the latest known report of the report's station that precedes the report
+ * (see ReportArchiveIndex::previousReport()).
  * Updates the changed widget contents.
  */
 void ReportWindow::on_loadCarries_action_triggered()
 {
-    QString tFileName = QFileDialog::getOpenFileName(this, "[Überträge laden] Letzten Wachbericht öffnen", "", "Wachberichte (*.wbr)");
+    QString tPreselectedFileName = "";
+
+    ReportArchiveIndex::Entry tPreviousEntry;
+    if (report.getStation() != "" && ReportArchiveIndex::previousReport(report, tPreviousEntry))
+        tPreselectedFileName = tPreviousEntry.fileName;
+
+    QString tFileName = QFileDialog::getOpenFileName(this, "[Überträge laden] Letzten Wachbericht öffnen", tPreselectedFileName,
+                                                     "Wachberichte (*.wbr)");
 
     if (tFileName == "")
         return;
 
-    Report oldReport;
-    if (!oldReport.open(tFileName))
+    if (!ReportArchiveIndex::loadCarryovers(tFileName, report))
     {
         QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Laden des letzten Wachberichts!", QMessageBox::Ok, this).exec();
         return;
     }
 
-    report.loadCarryovers(oldReport);
-
     setSerialNumber(report.getNumber());
 
     setPersonnelHoursCarry(report.getPersonnelMinutesCarry());
@@ -4652,7 +4891,7 @@ void ReportWindow::on_boatDrives_tableWidget_currentCellChanged(const int curren
 {
     if (unappliedBoatDriveChanges)
     {
-        if (SettingsCache::getBoolSetting("app_reportWindow_autoApplyBoatDriveChanges"))
+        if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES))
             applyBoatDriveChanges(previousRow);
         else
         {
@@ -4788,7 +5027,7 @@ void ReportWindow::on_addBoatDrive_pushButton_pressed()
 {
     if (unappliedBoatDriveChanges)
     {
-        if (SettingsCache::getBoolSetting("app_reportWindow_autoApplyBoatDriveChanges"))
+        if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES))
             on_applyBoatDriveChanges_pushButton_pressed();
         else
         {
@@ -4883,7 +5122,7 @@ void ReportWindow::on_moveBoatDriveUp_pushButton_pressed()
 
     if (unappliedBoatDriveChanges)
     {
-        if (SettingsCache::getBoolSetting("app_reportWindow_autoApplyBoatDriveChanges"))
+        if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES))
             on_applyBoatDriveChanges_pushButton_pressed();
         else
         {
@@ -4929,7 +5168,7 @@ void ReportWindow::on_moveBoatDriveDown_pushButton_pressed()
 
     if (unappliedBoatDriveChanges)
     {
-        if (SettingsCache::getBoolSetting("app_reportWindow_autoApplyBoatDriveChanges"))
+        if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES))
             on_applyBoatDriveChanges_pushButton_pressed();
         else
         {
@@ -5002,7 +5241,7 @@ void ReportWindow::on_splitBoatDrive_pushButton_pressed()
 
     if (unappliedBoatDriveChanges)
     {
-        if (SettingsCache::getBoolSetting("app_reportWindow_autoApplyBoatDriveChanges"))
+        if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES))
             on_applyBoatDriveChanges_pushButton_pressed();
         else
         {
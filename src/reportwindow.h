@@ -24,9 +24,12 @@
 #define REPORTWINDOW_H
 
 #include "auxil.h"
+#include "namecompletionindex.h"
+#include "namecompletionmodel.h"
 #include "report.h"
 
 #include <QCloseEvent>
+#include <QCompleter>
 #include <QDate>
 #include <QDragEnterEvent>
 #include <QDropEvent>
@@ -34,12 +37,15 @@
 #include <QLabel>
 #include <QLineEdit>
 #include <QMainWindow>
+#include <QModelIndex>
 #include <QPushButton>
 #include <QSpinBox>
 #include <QString>
 #include <QStringList>
+#include <QStringListModel>
 #include <QTime>
 #include <QTimeEdit>
+#include <QTimer>
 #include <QWidget>
 
 #include <atomic>
@@ -116,6 +122,7 @@ private:
     bool checkImplausibleValues();                          ///< Check for valid but improbable or forgotten values.
     //
     void updateWindowTitle();                               ///< Update the window title.
+    void updateDatabasePersonNames();                       ///< Collect first and last names from personnel database for the name completions.
     void updatePersonLastNameCompletions();                 ///< Update last name completions according to currently entered first name.
     void updatePersonFirstNameCompletions();                ///< Update first name completions according to currently entered last name.
     void updateTotalPersonnelHours();                       ///< Update the total (carry + new) personnel hours display.
@@ -164,6 +171,12 @@ private slots:
     void on_autoSaveTimerTimeout();                                                 ///< Auto-save the report.
     void on_findPersonShortcutActivated();                                          ///< Select all personnel matching the entered name.
     void on_exportFailed();                                                         ///< Show message box explaining that export failed.
+    void on_databasePersonnelChanged();                                             ///< \brief Update the personnel name completions
+                                                                                    ///  after external personnel database changes.
+    void on_databaseConfigChanged();                                                ///< \brief Update the selectable stations and boats
+                                                                                    ///  after external configuration database changes.
+    void on_personSuggestionsTimerTimeout();                                        ///< Suggest persons similar to the entered name.
+    void on_personSuggestionActivated(const QModelIndex& pIndex);                   ///< Enter the name of a suggested person.
     //
     void on_saveFile_action_triggered();                                            ///< Save the report to (the same) file.
     void on_saveFileAs_action_triggered();                                          ///< Save the report to a (different) file.
@@ -350,8 +363,14 @@ private:
     //
     QString selectedBoatmanIdent;           //Person identifier of currently selected boatman combo box item
     //
-    QStringList databaseLastNames;          //All distinct last names present in personnel database
-    QStringList databaseFirstNames;         //All distinct first names present in personnel database
+    std::shared_ptr<const NameCompletionIndex> nameCompletionIndex; //Distinct names present in personnel database (shared)
+    NameCompletionModel* lastNameCompletionModel;                   //Completion model for person last name line edit
+    NameCompletionModel* firstNameCompletionModel;                  //Completion model for person first name line edit
+    //
+    QTimer* personSuggestionsTimer;                 //Delays similar person suggestions until typing paused
+    QCompleter* personSuggestionsCompleter;         //Popup for similar person suggestions (if entered name matches no person)
+    QStringListModel* personSuggestionsModel;       //Labels of suggested persons
+    std::vector<QString> personSuggestionsIdents;   //Identifiers of suggested persons (same order as labels)
 };
 
 #endif // REPORTWINDOW_H
@@ -29,38 +29,49 @@
 #include <QMessageBox>
 #include <QStringList>
 
+#include <atomic>
 #include <stdexcept>
 
 //Initialize static class members
 
 bool SettingsCache::populated = false;
+std::atomic_bool SettingsCache::messageBoxesDisabled = false;
 //
-const std::map<QString, std::pair<std::function<int(bool)>, std::function<bool(int)>>> SettingsCache::availableIntSettings =
-        {{"app_export_autoOnSave", {SettingsCache::getAutoExportOnSave, SettingsCache::setAutoExportOnSave}},
-         {"app_export_autoOnSave_askForFileName", {SettingsCache::getAutoExportOnSaveAskFileName,
-                                                   SettingsCache::setAutoExportOnSaveAskFileName}},
-         {"app_export_twoSidedPrint", {SettingsCache::getTwoSidedPrint, SettingsCache::setTwoSidedPrint}},
-         {"app_boatLog_disabled", {SettingsCache::getDisableBoatLog, SettingsCache::setDisableBoatLog}},
-         {"app_reportWindow_autoApplyBoatDriveChanges", {SettingsCache::getAutoApplyBoatDriveChanges,
-                                                         SettingsCache::setAutoApplyBoatDriveChanges}},
-         {"app_singleInstance", {SettingsCache::getSingleApplicationInstance, SettingsCache::setSingleApplicationInstance}},
-         {"app_default_station", {SettingsCache::getDefaultStation, SettingsCache::setDefaultStation}},
-         {"app_default_boat", {SettingsCache::getDefaultBoat, SettingsCache::setDefaultBoat}}};
-const std::map<QString, std::pair<std::function<double(bool)>, std::function<bool(double)>>> SettingsCache::availableDblSettings =
-        {};
-const std::map<QString, std::pair<std::function<QString(bool)>, std::function<bool(const QString&)>>>
-        SettingsCache::availableStrSettings =
-        {{"app_default_dutyTimeBegin", {SettingsCache::getDutyTimeBegin, SettingsCache::setDutyTimeBegin}},
-         {"app_default_dutyTimeEnd", {SettingsCache::getDutyTimeEnd, SettingsCache::setDutyTimeEnd}},
-         {"app_default_fileDialogDir", {SettingsCache::getDefaultDirectory, SettingsCache::setDefaultDirectory}},
-         {"app_default_reportFileNamePreset", {SettingsCache::getReportFileNamePreset, SettingsCache::setReportFileNamePreset}},
-         {"app_export_xelatexPath", {SettingsCache::getXeLaTeXPath, SettingsCache::setXeLaTeXPath}},
-         {"app_export_customLogoPath", {SettingsCache::getCustomLogoPath, SettingsCache::setCustomLogoPath}},
-         {"app_export_fontFamily", {SettingsCache::getPDFFont, SettingsCache::setPDFFont}},
-         {"app_auth_hash", {SettingsCache::getPasswordHash, SettingsCache::setPasswordHash}},
-         {"app_auth_salt", {SettingsCache::getPasswordSalt, SettingsCache::setPasswordSalt}},
-         {"app_documentLinks_documentList", {SettingsCache::getDocumentLinkList, SettingsCache::setDocumentLinkList}},
-         {"app_personnel_minQualis_boatman", {SettingsCache::getBoatmanRequiredLicense, SettingsCache::setBoatmanRequiredLicense}}};
+const std::array<SettingsCache::IntSettingEntry, SettingsCache::intSettingsCount> SettingsCache::intSettings =
+        {{{"app_export_autoOnSave", SettingsCache::getAutoExportOnSave, SettingsCache::setAutoExportOnSave},
+          {"app_export_autoOnSave_askForFileName", SettingsCache::getAutoExportOnSaveAskFileName,
+                                                   SettingsCache::setAutoExportOnSaveAskFileName},
+          {"app_export_twoSidedPrint", SettingsCache::getTwoSidedPrint, SettingsCache::setTwoSidedPrint},
+          {"app_boatLog_disabled", SettingsCache::getDisableBoatLog, SettingsCache::setDisableBoatLog},
+          {"app_reportWindow_autoApplyBoatDriveChanges", SettingsCache::getAutoApplyBoatDriveChanges,
+                                                         SettingsCache::setAutoApplyBoatDriveChanges},
+          {"app_singleInstance", SettingsCache::getSingleApplicationInstance, SettingsCache::setSingleApplicationInstance},
+          {"app_database_concurrentAccess", SettingsCache::getConcurrentDatabaseAccess, SettingsCache::setConcurrentDatabaseAccess},
+          {"app_default_station", SettingsCache::getDefaultStation, SettingsCache::setDefaultStation},
+          {"app_default_boat", SettingsCache::getDefaultBoat, SettingsCache::setDefaultBoat}}};
+const std::array<SettingsCache::StrSettingEntry, SettingsCache::strSettingsCount> SettingsCache::strSettings =
+        {{{"app_default_dutyTimeBegin", SettingsCache::getDutyTimeBegin, SettingsCache::setDutyTimeBegin},
+          {"app_default_dutyTimeEnd", SettingsCache::getDutyTimeEnd, SettingsCache::setDutyTimeEnd},
+          {"app_default_fileDialogDir", SettingsCache::getDefaultDirectory, SettingsCache::setDefaultDirectory},
+          {"app_default_reportFileNamePreset", SettingsCache::getReportFileNamePreset, SettingsCache::setReportFileNamePreset},
+          {"app_export_xelatexPath", SettingsCache::getXeLaTeXPath, SettingsCache::setXeLaTeXPath},
+          {"app_export_customLogoPath", SettingsCache::getCustomLogoPath, SettingsCache::setCustomLogoPath},
+          {"app_export_fontFamily", SettingsCache::getPDFFont, SettingsCache::setPDFFont},
+          {"app_auth_hash", SettingsCache::getPasswordHash, SettingsCache::setPasswordHash},
+          {"app_auth_salt", SettingsCache::getPasswordSalt, SettingsCache::setPasswordSalt},
+          {"app_documentLinks_documentList", SettingsCache::getDocumentLinkList, SettingsCache::setDocumentLinkList},
+          {"app_personnel_minQualis_boatman", SettingsCache::getBoatmanRequiredLicense, SettingsCache::setBoatmanRequiredLicense}}};
+//
+static_assert(static_cast<std::size_t>(SettingsCache::IntSetting::_DEFAULT_BOAT) + 1 == SettingsCache::intSettingsCount,
+              "Number of integer settings does not match 'IntSetting'.");
+static_assert(static_cast<std::size_t>(SettingsCache::StrSetting::_BOATMAN_REQUIRED_LICENSE) + 1 == SettingsCache::strSettingsCount,
+              "Number of string settings does not match 'StrSetting'.");
+//
+std::mutex SettingsCache::valuesMutex;
+std::array<int, SettingsCache::intSettingsCount> SettingsCache::intValues {};
+std::array<uint64_t, SettingsCache::intSettingsCount> SettingsCache::intValueGenerations {};
+std::array<QString, SettingsCache::strSettingsCount> SettingsCache::strValues;
+std::array<uint64_t, SettingsCache::strSettingsCount> SettingsCache::strValueGenerations {};
 
 //Public
 
@@ -88,16 +99,27 @@ bool SettingsCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
     populated = DatabaseCache::populate(pConfLockFile, pPersLockFile, pForce);
 
     //Ensure that new settings are added to database by once calling getter for every setting
-    for (const auto& it : availableIntSettings)
-        it.second.first(false);
-    for (const auto& it : availableDblSettings)
-        it.second.first(false);
-    for (const auto& it : availableStrSettings)
-        it.second.first(false);
+    for (const IntSettingEntry& tEntry : intSettings)
+        tEntry.getter(false);
+    for (const StrSettingEntry& tEntry : strSettings)
+        tEntry.getter(false);
 
     return populated;
 }
 
+/*!
+ * \brief Globally suppress warning message boxes.
+ *
+ * If \p pDisabled is true, all getters behave as if called with pNoMsgBox set to true. This is required
+ * when running without QApplication (see CommandLineInterface), where creating a message box would abort the program.
+ *
+ * \param pDisabled Suppress all warning message boxes?
+ */
+void SettingsCache::setMessageBoxesDisabled(const bool pDisabled)
+{
+    messageBoxesDisabled.store(pDisabled);
+}
+
 //
 
 /*!
@@ -106,6 +128,175 @@ bool SettingsCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
  * Gets the integer value stored for setting \p pSetting from the database cache.
  * If no value is set, a pre-defined default value is first written to the database and then this value is returned.
  *
+ * The value is remembered and returned directly by subsequent calls until any setting
+ * in the database cache changes (see DatabaseCache::settingsGeneration()).
+ *
+ * \param pSetting The setting.
+ * \param pNoMsgBox Suppress warning message boxes.
+ * \return Value of the setting.
+ */
+int SettingsCache::getIntSetting(const IntSetting pSetting, const bool pNoMsgBox)
+{
+    const std::size_t tIdx = static_cast<std::size_t>(pSetting);
+
+    //Need to remember generation before calling getter, which may itself change the setting
+    const uint64_t tGeneration = DatabaseCache::settingsGeneration();
+
+    {
+        const std::lock_guard<std::mutex> tLock(valuesMutex);
+
+        if (intValueGenerations[tIdx] == tGeneration)
+            return intValues[tIdx];
+    }
+
+    int tValue = intSettings[tIdx].getter(pNoMsgBox);
+
+    const std::lock_guard<std::mutex> tLock(valuesMutex);
+
+    intValues[tIdx] = tValue;
+    intValueGenerations[tIdx] = tGeneration;
+
+    return tValue;
+}
+
+/*!
+ * \brief Set an integer type setting.
+ *
+ * Sets the integer value stored for setting \p pSetting in the database cache,
+ * which also writes the value to the configuration database.
+ *
+ * If writing to the database fails, the cached value will not be changed.
+ *
+ * \param pSetting The setting.
+ * \param pValue New value for the setting.
+ * \return If writing to database was successful.
+ */
+bool SettingsCache::setIntSetting(const IntSetting pSetting, const int pValue)
+{
+    return intSettings[static_cast<std::size_t>(pSetting)].setter(pValue);
+}
+
+/*!
+ * \brief Get a string type setting.
+ *
+ * Gets the string value stored for setting \p pSetting from the database cache.
+ * If no value is set, a pre-defined default value is first written to the database and then this value is returned.
+ *
+ * The value is remembered and returned directly by subsequent calls until any setting
+ * in the database cache changes (see DatabaseCache::settingsGeneration()).
+ *
+ * \param pSetting The setting.
+ * \param pNoMsgBox Suppress warning message boxes.
+ * \return Value of the setting.
+ */
+QString SettingsCache::getStrSetting(const StrSetting pSetting, const bool pNoMsgBox)
+{
+    const std::size_t tIdx = static_cast<std::size_t>(pSetting);
+
+    //Need to remember generation before calling getter, which may itself change the setting
+    const uint64_t tGeneration = DatabaseCache::settingsGeneration();
+
+    {
+        const std::lock_guard<std::mutex> tLock(valuesMutex);
+
+        if (strValueGenerations[tIdx] == tGeneration)
+            return strValues[tIdx];
+    }
+
+    QString tValue = strSettings[tIdx].getter(pNoMsgBox);
+
+    const std::lock_guard<std::mutex> tLock(valuesMutex);
+
+    strValues[tIdx] = tValue;
+    strValueGenerations[tIdx] = tGeneration;
+
+    return tValue;
+}
+
+/*!
+ * \brief Set a string type setting.
+ *
+ * Sets the string value stored for setting \p pSetting in the database cache,
+ * which also writes the value to the configuration database.
+ *
+ * If writing to the database fails, the cached value will not be changed.
+ *
+ * \param pSetting The setting.
+ * \param pValue New value for the setting.
+ * \return If writing to database was successful.
+ */
+bool SettingsCache::setStrSetting(const StrSetting pSetting, const QString& pValue)
+{
+    return strSettings[static_cast<std::size_t>(pSetting)].setter(pValue);
+}
+
+//
+
+/*!
+ * \brief Get an integer-valued setting as boolean.
+ *
+ * Gets the integer (sic!) value for setting \p pSetting via
+ * getIntSetting() and returns false if the value is 0 and true else.
+ *
+ * (If no value is set, the default value provided by getIntSetting() is used for the boolean conversion.)
+ *
+ * \param pSetting The setting.
+ * \param pNoMsgBox Suppress warning message boxes.
+ * \return Boolean equivalent of the integer value of the setting.
+ */
+bool SettingsCache::getBoolSetting(const IntSetting pSetting, const bool pNoMsgBox)
+{
+    return (getIntSetting(pSetting, pNoMsgBox) == 0 ? false : true);
+}
+
+/*!
+ * \brief Set an integer-valued setting as boolean.
+ *
+ * Sets the integer (sic!) value stored for setting \p pSetting in the database cache using setIntSetting().
+ * It is set to 1 if \p pValue is true and 0 else. This also writes the value to the configuration database.
+ *
+ * If writing to the database fails, the cached value will not be changed.
+ *
+ * \param pSetting The setting.
+ * \param pValue New boolean(!) value for the integer(!) setting.
+ * \return If writing to database was successful.
+ */
+bool SettingsCache::setBoolSetting(const IntSetting pSetting, const bool pValue)
+{
+    return setIntSetting(pSetting, pValue ? 1 : 0);
+}
+
+//
+
+/*!
+ * \brief Get the database name of an integer type setting.
+ *
+ * \param pSetting The setting.
+ * \return Name of the setting.
+ */
+QString SettingsCache::settingName(const IntSetting pSetting)
+{
+    return intSettings[static_cast<std::size_t>(pSetting)].name;
+}
+
+/*!
+ * \brief Get the database name of a string type setting.
+ *
+ * \param pSetting The setting.
+ * \return Name of the setting.
+ */
+QString SettingsCache::settingName(const StrSetting pSetting)
+{
+    return strSettings[static_cast<std::size_t>(pSetting)].name;
+}
+
+//
+
+/*!
+ * \brief Get an integer type setting.
+ *
+ * Looks up the setting with name \p pSetting and calls getIntSetting(IntSetting, bool).
+ *
  * Available integer settings are:
  * - app_export_autoOnSave
  * - app_export_autoOnSave_askForFileName
@@ -113,6 +304,7 @@ bool SettingsCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
  * - app_boatLog_disabled
  * - app_reportWindow_autoApplyBoatDriveChanges
  * - app_singleInstance
+ * - app_database_concurrentAccess
  * - app_default_station
  * - app_default_boat
  *
@@ -124,8 +316,9 @@ bool SettingsCache::populate(const std::shared_ptr<QLockFile> pConfLockFile, con
  */
 int SettingsCache::getIntSetting(const QString& pSetting, const bool pNoMsgBox)
 {
-    if (availableIntSettings.find(pSetting) != availableIntSettings.end())
-        return availableIntSettings.at(pSetting).first(pNoMsgBox);
+    IntSetting tSetting = IntSetting::_EXPORT_AUTO_ON_SAVE;
+    if (findSetting(pSetting, tSetting))
+        return getIntSetting(tSetting, pNoMsgBox);
     else
         throw std::invalid_argument("Invalid integer type setting \"" + pSetting.toStdString() + "\"");
 }
@@ -133,12 +326,9 @@ int SettingsCache::getIntSetting(const QString& pSetting, const bool pNoMsgBox)
 /*!
  * \brief Set an integer type setting.
  *
- * Sets the integer value stored for setting \p pSetting in the database cache,
- * which also writes the value to the configuration database.
- *
- * If writing to the database fails, the cached value will not be changed.
+ * Looks up the setting with name \p pSetting and calls setIntSetting(IntSetting, int).
  *
- * For available integer settings, see getIntSetting().
+ * For available integer settings, see getIntSetting(const QString&, bool).
  *
  * \param pSetting Name of the setting.
  * \param pValue New value for the setting.
@@ -148,8 +338,9 @@ int SettingsCache::getIntSetting(const QString& pSetting, const bool pNoMsgBox)
  */
 bool SettingsCache::setIntSetting(const QString& pSetting, const int pValue)
 {
-    if (availableIntSettings.find(pSetting) != availableIntSettings.end())
-        return availableIntSettings.at(pSetting).second(pValue);
+    IntSetting tSetting = IntSetting::_EXPORT_AUTO_ON_SAVE;
+    if (findSetting(pSetting, tSetting))
+        return setIntSetting(tSetting, pValue);
     else
         throw std::invalid_argument("Invalid integer type setting \"" + pSetting.toStdString() + "\"");
 }
@@ -157,55 +348,38 @@ bool SettingsCache::setIntSetting(const QString& pSetting, const int pValue)
 /*!
  * \brief Get a floating-point type setting.
  *
- * Gets the floating-point value stored for setting \p pSetting from the database cache.
- * If no value is set, a pre-defined default value is first written to the database and then this value is returned.
- *
  * Available floating-point settings are:
  * NONE
  *
  * \param pSetting Name of the setting.
- * \param pNoMsgBox Suppress warning message boxes.
  * \return Value of the setting.
  *
  * \throws std::invalid_argument Floating-point type setting \p pSetting does not exist.
  */
-double SettingsCache::getDblSetting(const QString& pSetting, const bool pNoMsgBox)
+double SettingsCache::getDblSetting(const QString& pSetting, bool)
 {
-    if (availableDblSettings.find(pSetting) != availableDblSettings.end())
-        return availableDblSettings.at(pSetting).first(pNoMsgBox);
-    else
-        throw std::invalid_argument("Invalid floating-point type setting \"" + pSetting.toStdString() + "\"");
+    throw std::invalid_argument("Invalid floating-point type setting \"" + pSetting.toStdString() + "\"");
 }
 
 /*!
  * \brief Set a floating-point type setting.
  *
- * Sets the floating-point value stored for setting \p pSetting in the database cache,
- * which also writes the value to the configuration database.
- *
- * If writing to the database fails, the cached value will not be changed.
- *
  * For available floating-point settings, see getDblSetting().
  *
  * \param pSetting Name of the setting.
- * \param pValue New value for the setting.
  * \return If writing to database was successful.
  *
  * \throws std::invalid_argument Floating-point type setting \p pSetting does not exist.
  */
-bool SettingsCache::setDblSetting(const QString& pSetting, const double pValue)
+bool SettingsCache::setDblSetting(const QString& pSetting, double)
 {
-    if (availableDblSettings.find(pSetting) != availableDblSettings.end())
-        return availableDblSettings.at(pSetting).second(pValue);
-    else
-        throw std::invalid_argument("Invalid floating-point type setting \"" + pSetting.toStdString() + "\"");
+    throw std::invalid_argument("Invalid floating-point type setting \"" + pSetting.toStdString() + "\"");
 }
 
 /*!
  * \brief Get a string type setting.
  *
- * Gets the string value stored for setting \p pSetting from the database cache.
- * If no value is set, a pre-defined default value is first written to the database and then this value is returned.
+ * Looks up the setting with name \p pSetting and calls getStrSetting(StrSetting, bool).
  *
  * Available string settings are:
  * - app_default_dutyTimeBegin
@@ -228,8 +402,9 @@ bool SettingsCache::setDblSetting(const QString& pSetting, const double pValue)
  */
 QString SettingsCache::getStrSetting(const QString& pSetting, const bool pNoMsgBox)
 {
-    if (availableStrSettings.find(pSetting) != availableStrSettings.end())
-        return availableStrSettings.at(pSetting).first(pNoMsgBox);
+    StrSetting tSetting = StrSetting::_DEFAULT_DUTY_TIME_BEGIN;
+    if (findSetting(pSetting, tSetting))
+        return getStrSetting(tSetting, pNoMsgBox);
     else
         throw std::invalid_argument("Invalid string type setting \"" + pSetting.toStdString() + "\"");
 }
@@ -237,12 +412,9 @@ QString SettingsCache::getStrSetting(const QString& pSetting, const bool pNoMsgB
 /*!
  * \brief Set a string type setting.
  *
- * Sets the string value stored for setting \p pSetting in the database cache,
- * which also writes the value to the configuration database.
- *
- * If writing to the database fails, the cached value will not be changed.
+ * Looks up the setting with name \p pSetting and calls setStrSetting(StrSetting, const QString&).
  *
- * For available string settings, see getStrSetting().
+ * For available string settings, see getStrSetting(const QString&, bool).
  *
  * \param pSetting Name of the setting.
  * \param pValue New value for the setting.
@@ -252,8 +424,9 @@ QString SettingsCache::getStrSetting(const QString& pSetting, const bool pNoMsgB
  */
 bool SettingsCache::setStrSetting(const QString& pSetting, const QString& pValue)
 {
-    if (availableStrSettings.find(pSetting) != availableStrSettings.end())
-        return availableStrSettings.at(pSetting).second(pValue);
+    StrSetting tSetting = StrSetting::_DEFAULT_DUTY_TIME_BEGIN;
+    if (findSetting(pSetting, tSetting))
+        return setStrSetting(tSetting, pValue);
     else
         throw std::invalid_argument("Invalid string type setting \"" + pSetting.toStdString() + "\"");
 }
@@ -263,12 +436,9 @@ bool SettingsCache::setStrSetting(const QString& pSetting, const QString& pValue
 /*!
  * \brief Get an integer-valued setting as boolean.
  *
- * Gets the integer (sic!) value for setting \p pSetting via
- * getIntSetting() and returns false if the value is 0 and true else.
+ * Looks up the setting with name \p pSetting and calls getBoolSetting(IntSetting, bool).
  *
- * (If no value is set, the default value provided by getIntSetting() is used for the boolean conversion.)
- *
- * For available integer settings, see getIntSetting().
+ * For available integer settings, see getIntSetting(const QString&, bool).
  *
  * \param pSetting Name of the setting.
  * \param pNoMsgBox Suppress warning message boxes.
@@ -284,12 +454,9 @@ bool SettingsCache::getBoolSetting(const QString& pSetting, const bool pNoMsgBox
 /*!
  * \brief Set an integer-valued setting as boolean.
  *
- * Sets the integer (sic!) value stored for setting \p pSetting in the database cache using getIntSetting().
- * It is set to 1 if \p pValue is true and 0 else. This also writes the value to the configuration database.
+ * Looks up the setting with name \p pSetting and calls setBoolSetting(IntSetting, bool).
  *
- * If writing to the database fails, the cached value will not be changed.
- *
- * For available integer settings, see getIntSetting().
+ * For available integer settings, see getIntSetting(const QString&, bool).
  *
  * \param pSetting Name of the setting.
  * \param pValue New boolean(!) value for the integer(!) setting.
@@ -304,6 +471,51 @@ bool SettingsCache::setBoolSetting(const QString& pSetting, const bool pValue)
 
 //Private
 
+/*!
+ * \brief Find the integer type setting with a database name.
+ *
+ * \param pName Name of the setting.
+ * \param pSetting Destination for the found setting.
+ * \return If an integer type setting named \p pName exists.
+ */
+bool SettingsCache::findSetting(const QString& pName, IntSetting& pSetting)
+{
+    for (std::size_t i = 0; i < intSettings.size(); ++i)
+    {
+        if (pName == QLatin1String(intSettings[i].name))
+        {
+            pSetting = static_cast<IntSetting>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*!
+ * \brief Find the string type setting with a database name.
+ *
+ * \param pName Name of the setting.
+ * \param pSetting Destination for the found setting.
+ * \return If a string type setting named \p pName exists.
+ */
+bool SettingsCache::findSetting(const QString& pName, StrSetting& pSetting)
+{
+    for (std::size_t i = 0; i < strSettings.size(); ++i)
+    {
+        if (pName == QLatin1String(strSettings[i].name))
+        {
+            pSetting = static_cast<StrSetting>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//
+
+
 /*!
  * \brief Read "app_export_autoOnSave" setting from database cache (defines default value).
  *
@@ -319,7 +531,7 @@ int SettingsCache::getAutoExportOnSave(const bool pNoMsgBox)
     int tValue = 0;
     if (!DatabaseCache::getSetting("app_export_autoOnSave", tValue, 0, true))   //Default: disabled
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -356,7 +568,7 @@ int SettingsCache::getAutoExportOnSaveAskFileName(const bool pNoMsgBox)
     int tValue = 0;
     if (!DatabaseCache::getSetting("app_export_autoOnSave_askForFileName", tValue, 0, true))    //Default: disabled
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -393,7 +605,7 @@ int SettingsCache::getTwoSidedPrint(const bool pNoMsgBox)
     int tValue = 0;
     if (!DatabaseCache::getSetting("app_export_twoSidedPrint", tValue, 0, true))    //Default: one-sided
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -432,7 +644,7 @@ int SettingsCache::getDisableBoatLog(const bool pNoMsgBox)
     int tValue = 0;
     if (!DatabaseCache::getSetting("app_boatLog_disabled", tValue, 0, true))    //Default: enabled boat log
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -469,7 +681,7 @@ int SettingsCache::getAutoApplyBoatDriveChanges(const bool pNoMsgBox)
     int tValue = 0;
     if (!DatabaseCache::getSetting("app_reportWindow_autoApplyBoatDriveChanges", tValue, 1, true))  //Default: auto-apply changes
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -508,7 +720,7 @@ int SettingsCache::getSingleApplicationInstance(const bool pNoMsgBox)
     int tValue = 0;
     if (!DatabaseCache::getSetting("app_singleInstance", tValue, 0, true))  //Default: allow multiple instances
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -532,6 +744,45 @@ bool SettingsCache::setSingleApplicationInstance(const int pValue)
 
 //
 
+/*!
+ * \brief Read "app_database_concurrentAccess" setting from database cache (defines default value).
+ *
+ * Sets (and returns) default value of 0, if setting is not set.
+ *
+ * Shows a warning message box, if writing not set setting to database fails.
+ *
+ * \param pNoMsgBox Suppress warning message boxes.
+ * \return Value of the setting.
+ */
+int SettingsCache::getConcurrentDatabaseAccess(const bool pNoMsgBox)
+{
+    int tValue = 0;
+    if (!DatabaseCache::getSetting("app_database_concurrentAccess", tValue, 0, true))   //Default: single writing instance
+    {
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
+        {
+            QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
+        }
+    }
+    return tValue;
+}
+
+/*!
+ * \brief Write "app_database_concurrentAccess" setting to database cache.
+ *
+ * Sets the cached value and also writes it to the configuration database.
+ * If writing to the database fails, the cached value will not be changed.
+ *
+ * \param pValue New value for the setting.
+ * \return If writing to database was successful.
+ */
+bool SettingsCache::setConcurrentDatabaseAccess(const int pValue)
+{
+    return DatabaseCache::setSetting("app_database_concurrentAccess", pValue);
+}
+
+//
+
 /*!
  * \brief Read "app_default_station" setting from database cache (defines default value).
  *
@@ -547,7 +798,7 @@ int SettingsCache::getDefaultStation(const bool pNoMsgBox)
     int tValue = 0;
     if (!DatabaseCache::getSetting("app_default_station", tValue, -1, true))    //Default: no default station
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -584,7 +835,7 @@ int SettingsCache::getDefaultBoat(const bool pNoMsgBox)
     int tValue = 0;
     if (!DatabaseCache::getSetting("app_default_boat", tValue, -1, true))   //Default: no default boat
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -625,14 +876,14 @@ QString SettingsCache::getDutyTimeBegin(const bool pNoMsgBox)
     QString tValue;
     if (!DatabaseCache::getSetting("app_default_dutyTimeBegin", tValue, "10:00", true))
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
     }
     if (!QTime::fromString(tValue, "hh:mm").isValid())
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Warning, "Warnung", "Ungültige Zeitangabe! Setze auf 10:00.", QMessageBox::Ok).exec();
         }
@@ -675,14 +926,14 @@ QString SettingsCache::getDutyTimeEnd(const bool pNoMsgBox)
     QString tValue = "";
     if (!DatabaseCache::getSetting("app_default_dutyTimeEnd", tValue, "18:00", true))   //Default: end at 18:00
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
     }
     if (!QTime::fromString(tValue, "hh:mm").isValid())
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Warning, "Warnung", "Ungültige Zeitangabe! Setze auf 18:00.", QMessageBox::Ok).exec();
         }
@@ -727,14 +978,14 @@ QString SettingsCache::getDefaultDirectory(const bool pNoMsgBox)
     QString tValue;
     if (!DatabaseCache::getSetting("app_default_fileDialogDir", tValue, "", true))  //Default: empty path
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
     }
     if (tValue != "" && !QDir(tValue).exists())
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Warning, "Warnung", "Standard-Pfad existiert nicht!", QMessageBox::Ok).exec();
         }
@@ -777,7 +1028,7 @@ QString SettingsCache::getReportFileNamePreset(const bool pNoMsgBox)
     QString tValue;
     if (!DatabaseCache::getSetting("app_default_reportFileNamePreset", tValue, "", true))   //Default: empty (no pre-set file name)
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -818,14 +1069,14 @@ QString SettingsCache::getXeLaTeXPath(const bool pNoMsgBox)
     QString tValue;
     if (!DatabaseCache::getSetting("app_export_xelatexPath", tValue, "", true)) //Default: empty path
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
     }
     if (tValue != "" && !QFileInfo::exists(tValue))
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Warning, "Warnung", "XeLaTeX-Pfad existiert nicht!", QMessageBox::Ok).exec();
         }
@@ -870,14 +1121,14 @@ QString SettingsCache::getCustomLogoPath(const bool pNoMsgBox)
     QString tValue;
     if (!DatabaseCache::getSetting("app_export_customLogoPath", tValue, "", true))  //Default: empty path
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
     }
     if (tValue != "" && !QFileInfo::exists(tValue))
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Warning, "Warnung", "Logo-Datei existiert nicht!", QMessageBox::Ok).exec();
         }
@@ -922,14 +1173,14 @@ QString SettingsCache::getPDFFont(const bool pNoMsgBox)
     QString tValue;
     if (!DatabaseCache::getSetting("app_export_fontFamily", tValue, "CMU", true))   //Default: Computer Modern font
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
     }
     if (tValue == "")
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Warning, "Warnung", "Schriftart nicht gesetzt! Setze auf \"CMU\".", QMessageBox::Ok).exec();
         }
@@ -987,7 +1238,7 @@ QString SettingsCache::getPasswordHash(const bool pNoMsgBox)
         QString tValue2;
         if (DatabaseCache::getSetting("app_auth_salt", tValue2, "", false) && tValue2 != "")
         {
-            if (!pNoMsgBox)
+            if (!pNoMsgBox && !messageBoxesDisabled.load())
             {
                 QMessageBox(QMessageBox::Warning, "Warnung", "Passwort nicht korrekt gesetzt!", QMessageBox::Ok).exec();
             }
@@ -999,7 +1250,7 @@ QString SettingsCache::getPasswordHash(const bool pNoMsgBox)
         if (DatabaseCache::getSetting("app_auth_salt", tValue2, "", false) &&
                 ((tValue != "" && tValue2 == "") || (tValue == "" && tValue2 != "")))
         {
-            if (!pNoMsgBox)
+            if (!pNoMsgBox && !messageBoxesDisabled.load())
             {
                 QMessageBox(QMessageBox::Warning, "Warnung", "Passwort nicht korrekt gesetzt!", QMessageBox::Ok).exec();
             }
@@ -1046,7 +1297,7 @@ QString SettingsCache::getPasswordSalt(const bool pNoMsgBox)
         QString tValue2;
         if (DatabaseCache::getSetting("app_auth_hash", tValue2, "", false) && tValue2 != "")
         {
-            if (!pNoMsgBox)
+            if (!pNoMsgBox && !messageBoxesDisabled.load())
             {
                 QMessageBox(QMessageBox::Warning, "Warnung", "Passwort nicht korrekt gesetzt!", QMessageBox::Ok).exec();
             }
@@ -1058,7 +1309,7 @@ QString SettingsCache::getPasswordSalt(const bool pNoMsgBox)
         if (DatabaseCache::getSetting("app_auth_hash", tValue2, "", false) &&
                 ((tValue != "" && tValue2 == "") || (tValue == "" && tValue2 != "")))
         {
-            if (!pNoMsgBox)
+            if (!pNoMsgBox && !messageBoxesDisabled.load())
             {
                 QMessageBox(QMessageBox::Warning, "Warnung", "Passwort nicht korrekt gesetzt!", QMessageBox::Ok).exec();
             }
@@ -1098,7 +1349,7 @@ QString SettingsCache::getDocumentLinkList(const bool pNoMsgBox)
     QString tValue;
     if (!DatabaseCache::getSetting("app_documentLinks_documentList", tValue, "", true)) //Default: no documents
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
@@ -1139,14 +1390,14 @@ QString SettingsCache::getBoatmanRequiredLicense(const bool pNoMsgBox)
     QString tValue;
     if (!DatabaseCache::getSetting("app_personnel_minQualis_boatman", tValue, "A", true))   //Default: DLRG boating license A (inland)
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Schreiben der Konfigurations-Datenbank!", QMessageBox::Ok).exec();
         }
     }
     if (tValue == "" || !QStringList({"A", "B", "A&B", "A|B"}).contains(tValue))
     {
-        if (!pNoMsgBox)
+        if (!pNoMsgBox && !messageBoxesDisabled.load())
         {
             QMessageBox(QMessageBox::Warning, "Warnung", "Benötigter Bootsführerschein nicht gesetzt! Setze auf \"A (Binnen)\".",
                         QMessageBox::Ok).exec();
@@ -26,10 +26,11 @@
 #include <QLockFile>
 #include <QString>
 
-#include <functional>
-#include <map>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <utility>
+#include <mutex>
 
 /*!
  * \brief Wrapper class to access settings from DatabaseCache.
@@ -41,19 +42,75 @@
  * and provides default values in case a setting has not yet been set
  * (a new configuration database will not contain any settings entries).
  *
+ * Settings should be accessed via the IntSetting and StrSetting enums (e.g. getIntSetting(IntSetting, bool)),
+ * such that misspelled or mistyped settings are already rejected by the compiler. The settings are registered
+ * in arrays indexed by these enums and their values are kept in (equally indexed) arrays until any setting in the
+ * DatabaseCache changes (see DatabaseCache::settingsGeneration()), so repeated reads are simple array accesses.
+ * The functions taking the setting name as a string remain available for compatibility and only map the name to the enum.
+ *
  * Before using the SettingsCache, populate() should be called.
  * This in turn calls DatabaseCache::populate(), which loads the
  * settings values from the database into the DatabaseCache.
  */
 class SettingsCache
 {
+public:
+    /*!
+     * \brief Available integer type settings.
+     */
+    enum class IntSetting : int8_t
+    {
+        _EXPORT_AUTO_ON_SAVE = 0,               ///< "app_export_autoOnSave"
+        _EXPORT_AUTO_ON_SAVE_ASK_FILE_NAME = 1, ///< "app_export_autoOnSave_askForFileName"
+        _EXPORT_TWO_SIDED_PRINT = 2,            ///< "app_export_twoSidedPrint"
+        _BOAT_LOG_DISABLED = 3,                 ///< "app_boatLog_disabled"
+        _AUTO_APPLY_BOAT_DRIVE_CHANGES = 4,     ///< "app_reportWindow_autoApplyBoatDriveChanges"
+        _SINGLE_INSTANCE = 5,                   ///< "app_singleInstance"
+        _DATABASE_CONCURRENT_ACCESS = 6,        ///< "app_database_concurrentAccess"
+        _DEFAULT_STATION = 7,                   ///< "app_default_station"
+        _DEFAULT_BOAT = 8,                      ///< "app_default_boat"
+    };
+    /*!
+     * \brief Available string type settings.
+     */
+    enum class StrSetting : int8_t
+    {
+        _DEFAULT_DUTY_TIME_BEGIN = 0,           ///< "app_default_dutyTimeBegin"
+        _DEFAULT_DUTY_TIME_END = 1,             ///< "app_default_dutyTimeEnd"
+        _DEFAULT_FILE_DIALOG_DIR = 2,           ///< "app_default_fileDialogDir"
+        _DEFAULT_REPORT_FILE_NAME_PRESET = 3,   ///< "app_default_reportFileNamePreset"
+        _EXPORT_XELATEX_PATH = 4,               ///< "app_export_xelatexPath"
+        _EXPORT_CUSTOM_LOGO_PATH = 5,           ///< "app_export_customLogoPath"
+        _EXPORT_FONT_FAMILY = 6,                ///< "app_export_fontFamily"
+        _AUTH_HASH = 7,                         ///< "app_auth_hash"
+        _AUTH_SALT = 8,                         ///< "app_auth_salt"
+        _DOCUMENT_LINK_LIST = 9,                ///< "app_documentLinks_documentList"
+        _BOATMAN_REQUIRED_LICENSE = 10,         ///< "app_personnel_minQualis_boatman"
+    };
+    //
+    static constexpr std::size_t intSettingsCount = 9;  ///< Number of available integer type settings.
+    static constexpr std::size_t strSettingsCount = 11; ///< Number of available string type settings.
+
 public:
     SettingsCache() = delete;   ///< Deleted constructor.
     //
     static bool populate(std::shared_ptr<QLockFile> pConfLockFile, std::shared_ptr<QLockFile> pPersLockFile,
                          bool pForce = false);                                          ///< \brief Fill settings cache with program
                                                                                         ///  settings from configuration database.
+    static void setMessageBoxesDisabled(bool pDisabled);                            ///< Globally suppress warning message boxes.
+    //
+    static int getIntSetting(IntSetting pSetting, bool pNoMsgBox = false);          ///< Get an integer type setting.
+    static bool setIntSetting(IntSetting pSetting, int pValue);                     ///< Set an integer type setting.
+    static QString getStrSetting(StrSetting pSetting, bool pNoMsgBox = false);      ///< Get a string type setting.
+    static bool setStrSetting(StrSetting pSetting, const QString& pValue);          ///< Set a string type setting.
+    //Boolean aliases
+    static bool getBoolSetting(IntSetting pSetting, bool pNoMsgBox = false);        ///< Get an integer-valued setting as boolean.
+    static bool setBoolSetting(IntSetting pSetting, bool pValue);                   ///< Set an integer-valued setting as boolean.
+    //
+    static QString settingName(IntSetting pSetting);    ///< Get the database name of an integer type setting.
+    static QString settingName(StrSetting pSetting);    ///< Get the database name of a string type setting.
     //
+    //Compatibility interface using setting names
     static int getIntSetting(const QString& pSetting, bool pNoMsgBox = false);      ///< Get an integer type setting.
     static bool setIntSetting(const QString& pSetting, int pValue);                 ///< Set an integer type setting.
     static double getDblSetting(const QString& pSetting, bool pNoMsgBox = false);   ///< Get a floating-point type setting.
@@ -64,6 +121,10 @@ public:
     static bool getBoolSetting(const QString& pSetting, bool pNoMsgBox = false);    ///< Get an integer-valued setting as boolean.
     static bool setBoolSetting(const QString& pSetting, bool pValue);               ///< Set an integer-valued setting as boolean.
 
+private:
+    static bool findSetting(const QString& pName, IntSetting& pSetting);    ///< Find the integer type setting with a database name.
+    static bool findSetting(const QString& pName, StrSetting& pSetting);    ///< Find the string type setting with a database name.
+    //
 private:
     static int getAutoExportOnSave(bool pNoMsgBox = false);             ///< \brief Read "app_export_autoOnSave" setting
                                                                         ///  from database cache (defines default value).
@@ -87,6 +148,10 @@ private:
     static int getSingleApplicationInstance(bool pNoMsgBox = false);    ///< \brief Read "app_singleInstance" setting
                                                                         ///  from database cache (defines default value).
     static bool setSingleApplicationInstance(int pValue);               ///< Write "app_singleInstance" setting to database cache.
+    static int getConcurrentDatabaseAccess(bool pNoMsgBox = false);     ///< \brief Read "app_database_concurrentAccess" setting
+                                                                        ///  from database cache (defines default value).
+    static bool setConcurrentDatabaseAccess(int pValue);                ///< \brief Write "app_database_concurrentAccess" setting
+                                                                        ///  to database cache.
     //
     static int getDefaultStation(bool pNoMsgBox = false);   ///< \brief Read "app_default_station" setting from database cache
                                                             ///  (defines default value).
@@ -135,18 +200,38 @@ private:
     static bool setBoatmanRequiredLicense(const QString& pValue);       ///< \brief Write "app_personnel_minQualis_boatman"
                                                                         ///  setting to database cache.
 
+private:
+    /*!
+     * \brief Registry entry of an integer type setting.
+     */
+    struct IntSettingEntry
+    {
+        const char* name;           ///< Name of the setting in the database.
+        int (*getter)(bool);        ///< Function reading the setting from database cache (defines default value).
+        bool (*setter)(int);        ///< Function writing the setting to database cache.
+    };
+    /*!
+     * \brief Registry entry of a string type setting.
+     */
+    struct StrSettingEntry
+    {
+        const char* name;                   ///< Name of the setting in the database.
+        QString (*getter)(bool);            ///< Function reading the setting from database cache (defines default value).
+        bool (*setter)(const QString&);     ///< Function writing the setting to database cache.
+    };
+
 private:
     static bool populated;  //Program settings loaded into cache from database by populate()?
+    static std::atomic_bool messageBoxesDisabled;   //Behave as if all getters were called with 'pNoMsgBox' set?
+    //
+    static const std::array<IntSettingEntry, intSettingsCount> intSettings;     //Integer settings with getters and setters
+    static const std::array<StrSettingEntry, strSettingsCount> strSettings;     //String settings with getters and setters
     //
-    static const std::map<QString,
-                    std::pair<std::function<int(bool)>,
-                              std::function<bool(int)>>> availableIntSettings;      //Integer settings with getters and setters
-    static const std::map<QString,
-                    std::pair<std::function<double(bool)>,
-                              std::function<bool(double)>>> availableDblSettings;   //Floating-point settings with getters and setters
-    static const std::map<QString,
-                    std::pair<std::function<QString(bool)>,
-                              std::function<bool(const QString&)>>> availableStrSettings;   //String settings with getters and setters
+    static std::mutex valuesMutex;                                          //Lock for access to cached values
+    static std::array<int, intSettingsCount> intValues;                     //Cached values of integer settings
+    static std::array<uint64_t, intSettingsCount> intValueGenerations;      //Settings generation of cached values (0 if not cached)
+    static std::array<QString, strSettingsCount> strValues;                 //Cached values of string settings
+    static std::array<uint64_t, strSettingsCount> strValueGenerations;      //Settings generation of cached values (0 if not cached)
 };
 
 #endif // SETTINGSCACHE_H
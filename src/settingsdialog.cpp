@@ -24,6 +24,7 @@
 #include "ui_settingsdialog.h"
 
 #include "databasecache.h"
+#include "databasewatcher.h"
 #include "settingscache.h"
 
 #include <QAbstractButton>
@@ -125,8 +126,8 @@ SettingsDialog::SettingsDialog(QWidget *const pParent) :
 
     //Ask for password
 
-    QString hash = SettingsCache::getStrSetting("app_auth_hash");
-    QString salt = SettingsCache::getStrSetting("app_auth_salt");
+    QString hash = SettingsCache::getStrSetting(SettingsCache::StrSetting::_AUTH_HASH);
+    QString salt = SettingsCache::getStrSetting(SettingsCache::StrSetting::_AUTH_SALT);
 
     //Note: this is not intended to be secure...
     if (hash != "" && salt != "")
@@ -169,6 +170,10 @@ SettingsDialog::SettingsDialog(QWidget *const pParent) :
 
     //Load settings from database and fill input widgets
     readDatabase();
+
+    //Update stations and boats whenever the configuration database is changed by another application instance
+    if (DatabaseWatcher* databaseWatcher = DatabaseWatcher::instance())
+        connect(databaseWatcher, &DatabaseWatcher::configChanged, this, &SettingsDialog::on_databaseConfigChanged);
 }
 
 /*!
@@ -188,36 +193,44 @@ SettingsDialog::~SettingsDialog()
  */
 void SettingsDialog::readDatabase()
 {
+    //Remember read values to only write changed settings later (see writeDatabase())
+    loadedIntSettings.clear();
+    loadedStrSettings.clear();
+
     //General settings
 
-    int defaultStationRowId = SettingsCache::getIntSetting("app_default_station");  //Checks further below
-    int defaultBoatRowId = SettingsCache::getIntSetting("app_default_boat");        //Checks further below
+    int defaultStationRowId = readIntSetting(SettingsCache::IntSetting::_DEFAULT_STATION);  //Checks further below
+    int defaultBoatRowId = readIntSetting(SettingsCache::IntSetting::_DEFAULT_BOAT);        //Checks further below
 
-    ui->defaultDutyTimesBegin_timeEdit->setTime(QTime::fromString(SettingsCache::getStrSetting("app_default_dutyTimeBegin"), "hh:mm"));
-    ui->defaultDutyTimesEnd_timeEdit->setTime(QTime::fromString(SettingsCache::getStrSetting("app_default_dutyTimeEnd"), "hh:mm"));
+    ui->defaultDutyTimesBegin_timeEdit->setTime(QTime::fromString(readStrSetting(SettingsCache::StrSetting::_DEFAULT_DUTY_TIME_BEGIN),
+                                                                  "hh:mm"));
+    ui->defaultDutyTimesEnd_timeEdit->setTime(QTime::fromString(readStrSetting(SettingsCache::StrSetting::_DEFAULT_DUTY_TIME_END),
+                                                                "hh:mm"));
 
-    ui->defaultFilePath_lineEdit->setText(SettingsCache::getStrSetting("app_default_fileDialogDir"));
+    ui->defaultFilePath_lineEdit->setText(readStrSetting(SettingsCache::StrSetting::_DEFAULT_FILE_DIALOG_DIR));
 
-    QString fileNamePreset = SettingsCache::getStrSetting("app_default_reportFileNamePreset");
+    QString fileNamePreset = readStrSetting(SettingsCache::StrSetting::_DEFAULT_REPORT_FILE_NAME_PRESET);
     if (ui->fileNamePreset_comboBox->findText(fileNamePreset) != -1)
         ui->fileNamePreset_comboBox->setCurrentIndex(ui->fileNamePreset_comboBox->findText(fileNamePreset));
     else
         ui->fileNamePreset_comboBox->setCurrentText(fileNamePreset);
 
-    ui->xelatexPath_lineEdit->setText(SettingsCache::getStrSetting("app_export_xelatexPath"));
-    ui->logoPath_lineEdit->setText(SettingsCache::getStrSetting("app_export_customLogoPath"));
-    ui->font_lineEdit->setText(SettingsCache::getStrSetting("app_export_fontFamily"));
+    ui->xelatexPath_lineEdit->setText(readStrSetting(SettingsCache::StrSetting::_EXPORT_XELATEX_PATH));
+    ui->logoPath_lineEdit->setText(readStrSetting(SettingsCache::StrSetting::_EXPORT_CUSTOM_LOGO_PATH));
+    ui->font_lineEdit->setText(readStrSetting(SettingsCache::StrSetting::_EXPORT_FONT_FAMILY));
 
-    ui->autoExport_checkBox->setChecked(SettingsCache::getBoolSetting("app_export_autoOnSave"));
-    ui->autoExportAskFilename_checkBox->setChecked(SettingsCache::getBoolSetting("app_export_autoOnSave_askForFileName"));
-    ui->twoSidedPrint_checkBox->setChecked(SettingsCache::getBoolSetting("app_export_twoSidedPrint"));
+    ui->autoExport_checkBox->setChecked(readBoolSetting(SettingsCache::IntSetting::_EXPORT_AUTO_ON_SAVE));
+    ui->autoExportAskFilename_checkBox->setChecked(
+                readBoolSetting(SettingsCache::IntSetting::_EXPORT_AUTO_ON_SAVE_ASK_FILE_NAME));
+    ui->twoSidedPrint_checkBox->setChecked(readBoolSetting(SettingsCache::IntSetting::_EXPORT_TWO_SIDED_PRINT));
 
     //Extended settings
 
-    ui->disableBoatLog_checkBox->setChecked(SettingsCache::getBoolSetting("app_boatLog_disabled"));
-    ui->boatDriveAutoApplyChanges_checkBox->setChecked(SettingsCache::getBoolSetting("app_reportWindow_autoApplyBoatDriveChanges"));
+    ui->disableBoatLog_checkBox->setChecked(readBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED));
+    ui->boatDriveAutoApplyChanges_checkBox->setChecked(
+                readBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES));
 
-    QString boatmanRequiredLicense = SettingsCache::getStrSetting("app_personnel_minQualis_boatman");
+    QString boatmanRequiredLicense = readStrSetting(SettingsCache::StrSetting::_BOATMAN_REQUIRED_LICENSE);
 
     ui->boatingLicenseA_radioButton->setChecked(true);
     if (boatmanRequiredLicense == "B")
@@ -227,12 +240,13 @@ void SettingsDialog::readDatabase()
     else if (boatmanRequiredLicense == "A|B")
         ui->boatingLicenseAny_radioButton->setChecked(true);
 
-    ui->singleInstance_checkBox->setChecked(SettingsCache::getBoolSetting("app_singleInstance"));
+    ui->singleInstance_checkBox->setChecked(readBoolSetting(SettingsCache::IntSetting::_SINGLE_INSTANCE));
+    ui->concurrentAccess_checkBox->setChecked(readBoolSetting(SettingsCache::IntSetting::_DATABASE_CONCURRENT_ACCESS));
 
     //Password
 
-    QString hash = SettingsCache::getStrSetting("app_auth_hash");
-    QString salt = SettingsCache::getStrSetting("app_auth_salt");
+    QString hash = readStrSetting(SettingsCache::StrSetting::_AUTH_HASH);
+    QString salt = readStrSetting(SettingsCache::StrSetting::_AUTH_SALT);
 
     //Set some string (EchoMode::Password) to indicate that password is set
     if (hash != "" && salt != "")
@@ -268,6 +282,9 @@ void SettingsDialog::readDatabase()
             tDefaultBoatOk = true;
     }
 
+    loadedStations = stations;
+    loadedBoats = boats;
+
     //Reset default station/boat, if does not exist
     if (!tDefaultStationOk)
         defaultStationRowId = -1;
@@ -321,7 +338,7 @@ void SettingsDialog::readDatabase()
     //Important document shortcuts
 
     std::vector<std::pair<QString, QString>> tDocs = Aux::parseDocumentListString(
-                                                         SettingsCache::getStrSetting("app_documentLinks_documentList"));
+                                                         readStrSetting(SettingsCache::StrSetting::_DOCUMENT_LINK_LIST));
 
     ui->documents_tableWidget->setRowCount(0);
     ui->documents_tableWidget->setRowCount(tDocs.size());
@@ -342,7 +359,9 @@ void SettingsDialog::readDatabase()
 /*!
  * \brief Write the settings to database.
  *
- * Writes all settings to the database (cache).
+ * Writes all changed settings (see writeSettings()) as well as the stations and boats (if changed) to the database (cache).
+ * The settings are thereby written within a single database transaction (see DatabaseCache::flushSettings()).
+ * Stations and boats are written even if writing the settings failed.
  *
  * Returns immediately, if database read-only.
  *
@@ -353,6 +372,112 @@ bool SettingsDialog::writeDatabase() const
     if (DatabaseCache::isConfigReadOnly())
         return false;
 
+    //Only update settings cache first and then write all changed settings at once in a single transaction
+
+    const bool tWriteBehind = DatabaseCache::settingsWriteBehind();
+
+    //If deferring is not possible, settings are simply written one by one
+    DatabaseCache::setSettingsWriteBehind(true);
+
+    bool tSuccess = writeSettings();
+
+    //Also write deferred settings if above failed, such that cache and database do not diverge
+    if (!DatabaseCache::flushSettings())
+        tSuccess = false;
+
+    if (!tWriteBehind)
+        DatabaseCache::setSettingsWriteBehind(false);
+
+    //Stations and boats (write them even if writing settings failed; they are independent of the settings)
+
+    //Another program instance may have changed stations or boats since readDatabase() (see DatabaseCache::setConcurrentAccess()),
+    //so refresh the cache and only apply the changes made in this dialog to the current stations and boats
+
+    if (stations != loadedStations || boats != loadedBoats)
+        DatabaseCache::reloadConfig();
+
+    if (stations != loadedStations)
+    {
+        std::map<QString, Aux::Station> tCurrentStations;
+
+        for (auto it : DatabaseCache::stations())
+        {
+            QString tStationIdent;
+            Aux::stationIdentFromNameLocation(it.second.name, it.second.location, tStationIdent);
+
+            tCurrentStations.insert({std::move(tStationIdent), std::move(it.second)});
+        }
+
+        applyChanges(loadedStations, stations, tCurrentStations);
+
+        std::vector<Aux::Station> tStations;
+        for (const auto& it : tCurrentStations)
+            tStations.push_back(it.second);
+
+        if (!DatabaseCache::updateStations(tStations))
+            tSuccess = false;
+    }
+
+    if (boats != loadedBoats)
+    {
+        std::map<QString, Aux::Boat> tCurrentBoats;
+
+        for (auto it : DatabaseCache::boats())
+            tCurrentBoats.insert({it.second.name, std::move(it.second)});
+
+        applyChanges(loadedBoats, boats, tCurrentBoats);
+
+        std::vector<Aux::Boat> tBoats;
+        for (const auto& it : tCurrentBoats)
+            tBoats.push_back(it.second);
+
+        if (!DatabaseCache::updateBoats(tBoats))
+            tSuccess = false;
+    }
+
+    return tSuccess;
+}
+
+/*!
+ * \brief Apply the changes made in the dialog to the current stations or boats.
+ *
+ * Removes all entries from \p pCurrent that were removed from \p pLoaded to get \p pEdited
+ * and adds or replaces all entries that were added or changed in \p pEdited compared to \p pLoaded.
+ * Entries not touched in the dialog are kept as they are in \p pCurrent.
+ *
+ * \param pLoaded Entries as read by readDatabase().
+ * \param pEdited Entries as edited in the dialog.
+ * \param pCurrent Current entries from the database cache (with the same keys as \p pLoaded and \p pEdited).
+ */
+template <typename T>
+void SettingsDialog::applyChanges(const std::map<QString, T>& pLoaded, const std::map<QString, T>& pEdited,
+                                  std::map<QString, T>& pCurrent)
+{
+    for (const auto& it : pLoaded)
+    {
+        if (pEdited.find(it.first) == pEdited.end())
+            pCurrent.erase(it.first);
+    }
+
+    for (const auto& it : pEdited)
+    {
+        auto loadedIt = pLoaded.find(it.first);
+
+        if (loadedIt == pLoaded.end() || loadedIt->second != it.second)
+            pCurrent[it.first] = it.second;
+    }
+}
+
+/*!
+ * \brief Write the changed settings to database (cache).
+ *
+ * Writes only those settings to the database (cache), whose values in the dialog
+ * differ from the values read by readDatabase() (see e.g. writeIntSetting()).
+ *
+ * \return If all write operations were successful.
+ */
+bool SettingsDialog::writeSettings() const
+{
     //General settings
 
     //Write default station, if stations map keys have not changed
@@ -365,7 +490,7 @@ bool SettingsDialog::writeDatabase() const
             DatabaseCache::stationRowIdFromNameLocation(tDefaultStation.name, tDefaultStation.location, tDefaultStRowId);
         }
 
-        if (!SettingsCache::setIntSetting("app_default_station", tDefaultStRowId))
+        if (!writeIntSetting(SettingsCache::IntSetting::_DEFAULT_STATION, tDefaultStRowId))
             return false;
     }
 
@@ -379,61 +504,66 @@ bool SettingsDialog::writeDatabase() const
             DatabaseCache::boatRowIdFromName(tDefaultBoat.name, tDefaultBtRowId);
         }
 
-        if (!SettingsCache::setIntSetting("app_default_boat", tDefaultBtRowId))
+        if (!writeIntSetting(SettingsCache::IntSetting::_DEFAULT_BOAT, tDefaultBtRowId))
             return false;
     }
 
-    if (!SettingsCache::setStrSetting("app_default_dutyTimeBegin", ui->defaultDutyTimesBegin_timeEdit->time().toString("hh:mm")))
+    if (!writeStrSetting(SettingsCache::StrSetting::_DEFAULT_DUTY_TIME_BEGIN,
+                         ui->defaultDutyTimesBegin_timeEdit->time().toString("hh:mm")))
         return false;
 
-    if (!SettingsCache::setStrSetting("app_default_dutyTimeEnd", ui->defaultDutyTimesEnd_timeEdit->time().toString("hh:mm")))
+    if (!writeStrSetting(SettingsCache::StrSetting::_DEFAULT_DUTY_TIME_END,
+                         ui->defaultDutyTimesEnd_timeEdit->time().toString("hh:mm")))
         return false;
 
-    if (!SettingsCache::setStrSetting("app_default_fileDialogDir", ui->defaultFilePath_lineEdit->text()))
+    if (!writeStrSetting(SettingsCache::StrSetting::_DEFAULT_FILE_DIALOG_DIR, ui->defaultFilePath_lineEdit->text()))
         return false;
 
-    if (!SettingsCache::setStrSetting("app_default_reportFileNamePreset", ui->fileNamePreset_comboBox->currentText()))
+    if (!writeStrSetting(SettingsCache::StrSetting::_DEFAULT_REPORT_FILE_NAME_PRESET, ui->fileNamePreset_comboBox->currentText()))
         return false;
 
-    if (!SettingsCache::setStrSetting("app_export_xelatexPath", ui->xelatexPath_lineEdit->text()))
+    if (!writeStrSetting(SettingsCache::StrSetting::_EXPORT_XELATEX_PATH, ui->xelatexPath_lineEdit->text()))
         return false;
 
-    if (!SettingsCache::setStrSetting("app_export_customLogoPath", ui->logoPath_lineEdit->text()))
+    if (!writeStrSetting(SettingsCache::StrSetting::_EXPORT_CUSTOM_LOGO_PATH, ui->logoPath_lineEdit->text()))
         return false;
 
-    if (!SettingsCache::setStrSetting("app_export_fontFamily", ui->font_lineEdit->text()))
+    if (!writeStrSetting(SettingsCache::StrSetting::_EXPORT_FONT_FAMILY, ui->font_lineEdit->text()))
         return false;
 
-    if (!SettingsCache::setBoolSetting("app_export_autoOnSave", ui->autoExport_checkBox->isChecked()))
+    if (!writeBoolSetting(SettingsCache::IntSetting::_EXPORT_AUTO_ON_SAVE, ui->autoExport_checkBox->isChecked()))
         return false;
 
-    if (!SettingsCache::setBoolSetting("app_export_autoOnSave_askForFileName", ui->autoExportAskFilename_checkBox->isChecked()))
+    if (!writeBoolSetting(SettingsCache::IntSetting::_EXPORT_AUTO_ON_SAVE_ASK_FILE_NAME,
+                          ui->autoExportAskFilename_checkBox->isChecked()))
         return false;
 
-    if (!SettingsCache::setBoolSetting("app_export_twoSidedPrint", ui->twoSidedPrint_checkBox->isChecked()))
+    if (!writeBoolSetting(SettingsCache::IntSetting::_EXPORT_TWO_SIDED_PRINT, ui->twoSidedPrint_checkBox->isChecked()))
         return false;
 
     //Extended settings
 
-    if (!SettingsCache::setBoolSetting("app_boatLog_disabled", ui->disableBoatLog_checkBox->isChecked()))
+    if (!writeBoolSetting(SettingsCache::IntSetting::_BOAT_LOG_DISABLED, ui->disableBoatLog_checkBox->isChecked()))
         return false;
 
-    if (!SettingsCache::setBoolSetting("app_reportWindow_autoApplyBoatDriveChanges",
-                                       ui->boatDriveAutoApplyChanges_checkBox->isChecked()))
+    if (!writeBoolSetting(SettingsCache::IntSetting::_AUTO_APPLY_BOAT_DRIVE_CHANGES,
+                          ui->boatDriveAutoApplyChanges_checkBox->isChecked()))
     {
         return false;
     }
 
     if (ui->boatingLicenseA_radioButton->isChecked())
-        SettingsCache::setStrSetting("app_personnel_minQualis_boatman", "A");
+        writeStrSetting(SettingsCache::StrSetting::_BOATMAN_REQUIRED_LICENSE, "A");
     else if (ui->boatingLicenseB_radioButton->isChecked())
-        SettingsCache::setStrSetting("app_personnel_minQualis_boatman", "B");
+        writeStrSetting(SettingsCache::StrSetting::_BOATMAN_REQUIRED_LICENSE, "B");
     else if (ui->boatingLicenseAB_radioButton->isChecked())
-        SettingsCache::setStrSetting("app_personnel_minQualis_boatman", "A&B");
+        writeStrSetting(SettingsCache::StrSetting::_BOATMAN_REQUIRED_LICENSE, "A&B");
     else if (ui->boatingLicenseAny_radioButton->isChecked())
-        SettingsCache::setStrSetting("app_personnel_minQualis_boatman", "A|B");
+        writeStrSetting(SettingsCache::StrSetting::_BOATMAN_REQUIRED_LICENSE, "A|B");
 
-    if (!SettingsCache::setBoolSetting("app_singleInstance", ui->singleInstance_checkBox->isChecked()))
+    if (!writeBoolSetting(SettingsCache::IntSetting::_SINGLE_INSTANCE, ui->singleInstance_checkBox->isChecked()))
+        return false;
+    if (!writeBoolSetting(SettingsCache::IntSetting::_DATABASE_CONCURRENT_ACCESS, ui->concurrentAccess_checkBox->isChecked()))
         return false;
 
     //Password
@@ -445,8 +575,11 @@ bool SettingsDialog::writeDatabase() const
         if (phrase == "")
         {
             //Reset password
-            if (!SettingsCache::setStrSetting("app_auth_hash", "") || !SettingsCache::setStrSetting("app_auth_salt", ""))
+            if (!SettingsCache::setStrSetting(SettingsCache::StrSetting::_AUTH_HASH, "") ||
+                !SettingsCache::setStrSetting(SettingsCache::StrSetting::_AUTH_SALT, ""))
+            {
                 return false;
+            }
         }
         else
         {
@@ -454,25 +587,14 @@ bool SettingsDialog::writeDatabase() const
             QString newHash, newSalt;
             Aux::generatePasswordHash(phrase, newHash, newSalt);
 
-            if (!SettingsCache::setStrSetting("app_auth_hash", newHash) || !SettingsCache::setStrSetting("app_auth_salt", newSalt))
+            if (!SettingsCache::setStrSetting(SettingsCache::StrSetting::_AUTH_HASH, newHash) ||
+                !SettingsCache::setStrSetting(SettingsCache::StrSetting::_AUTH_SALT, newSalt))
+            {
                 return false;
+            }
         }
     }
 
-    //Stations and boats
-
-    std::vector<Aux::Station> tStations;
-    for (const auto& it : stations)
-        tStations.push_back(it.second);
-
-    DatabaseCache::updateStations(tStations);
-
-    std::vector<Aux::Boat> tBoats;
-    for (const auto& it : boats)
-        tBoats.push_back(it.second);
-
-    DatabaseCache::updateBoats(tBoats);
-
     //Important document shortcuts
 
     std::vector<std::pair<QString, QString>> tDocs;
@@ -486,7 +608,7 @@ bool SettingsDialog::writeDatabase() const
         tDocs.push_back({std::move(tDocName), std::move(tDocFile)});
     }
 
-    if (!SettingsCache::setStrSetting("app_documentLinks_documentList", Aux::createDocumentListString(tDocs)))
+    if (!writeStrSetting(SettingsCache::StrSetting::_DOCUMENT_LINK_LIST, Aux::createDocumentListString(tDocs)))
         return false;
 
     return true;
@@ -494,6 +616,109 @@ bool SettingsDialog::writeDatabase() const
 
 //
 
+/*!
+ * \brief Read an integer setting and remember its value.
+ *
+ * Reads the setting via SettingsCache::getIntSetting() and remembers the value for writeIntSetting().
+ *
+ * \param pSetting The setting.
+ * \return Value of the setting.
+ */
+int SettingsDialog::readIntSetting(const SettingsCache::IntSetting pSetting)
+{
+    int tValue = SettingsCache::getIntSetting(pSetting);
+    loadedIntSettings[pSetting] = tValue;
+    return tValue;
+}
+
+/*!
+ * \brief Read an integer setting as boolean and remember its value.
+ *
+ * Reads the setting via SettingsCache::getIntSetting() and remembers the value for writeBoolSetting().
+ *
+ * \param pSetting The setting.
+ * \return Boolean equivalent of the integer value of the setting.
+ */
+bool SettingsDialog::readBoolSetting(const SettingsCache::IntSetting pSetting)
+{
+    return readIntSetting(pSetting) != 0;
+}
+
+/*!
+ * \brief Read a string setting and remember its value.
+ *
+ * Reads the setting via SettingsCache::getStrSetting() and remembers the value for writeStrSetting().
+ *
+ * \param pSetting The setting.
+ * \return Value of the setting.
+ */
+QString SettingsDialog::readStrSetting(const SettingsCache::StrSetting pSetting)
+{
+    QString tValue = SettingsCache::getStrSetting(pSetting);
+    loadedStrSettings[pSetting] = tValue;
+    return tValue;
+}
+
+/*!
+ * \brief Write an integer setting, if changed.
+ *
+ * Writes the setting via SettingsCache::setIntSetting(), if \p pValue differs from the value read by readIntSetting().
+ *
+ * \param pSetting The setting.
+ * \param pValue New value for the setting.
+ * \return If writing was successful or not needed.
+ */
+bool SettingsDialog::writeIntSetting(const SettingsCache::IntSetting pSetting, const int pValue) const
+{
+    auto it = loadedIntSettings.find(pSetting);
+
+    if (it != loadedIntSettings.end() && it->second == pValue)
+        return true;
+
+    return SettingsCache::setIntSetting(pSetting, pValue);
+}
+
+/*!
+ * \brief Write an integer setting as boolean, if changed.
+ *
+ * Writes the setting via SettingsCache::setBoolSetting(), if \p pValue differs
+ * from the boolean equivalent of the value read by readBoolSetting().
+ *
+ * \param pSetting The setting.
+ * \param pValue New boolean(!) value for the integer(!) setting.
+ * \return If writing was successful or not needed.
+ */
+bool SettingsDialog::writeBoolSetting(const SettingsCache::IntSetting pSetting, const bool pValue) const
+{
+    auto it = loadedIntSettings.find(pSetting);
+
+    if (it != loadedIntSettings.end() && (it->second != 0) == pValue)
+        return true;
+
+    return SettingsCache::setBoolSetting(pSetting, pValue);
+}
+
+/*!
+ * \brief Write a string setting, if changed.
+ *
+ * Writes the setting via SettingsCache::setStrSetting(), if \p pValue differs from the value read by readStrSetting().
+ *
+ * \param pSetting The setting.
+ * \param pValue New value for the setting.
+ * \return If writing was successful or not needed.
+ */
+bool SettingsDialog::writeStrSetting(const SettingsCache::StrSetting pSetting, const QString& pValue) const
+{
+    auto it = loadedStrSettings.find(pSetting);
+
+    if (it != loadedStrSettings.end() && it->second == pValue)
+        return true;
+
+    return SettingsCache::setStrSetting(pSetting, pValue);
+}
+
+//
+
 /*!
  * \brief Update the entries of station/boat combo boxes.
  *
@@ -768,6 +993,66 @@ void SettingsDialog::accept()
 
 //
 
+/*!
+ * \brief Update stations and boats after the configuration database was changed externally.
+ *
+ * Replaces the stations and boats by those from the re-loaded database cache (see DatabaseWatcher::configChanged())
+ * and applies all station and boat changes made in the dialog so far to them again (see applyChanges()).
+ *
+ * Since row IDs may have changed, the default station/boat selection is disabled (see disableDefaultStationSelection()
+ * and disableDefaultBoatSelection()), if the stations/boats in the database have changed.
+ */
+void SettingsDialog::on_databaseConfigChanged()
+{
+    //Use station identifier instead of 'rowid' as key
+    std::map<QString, Aux::Station> tReloadedStations;
+    for (auto it : DatabaseCache::stations())
+    {
+        QString tStationIdent;
+        Aux::stationIdentFromNameLocation(it.second.name, it.second.location, tStationIdent);
+
+        tReloadedStations.insert({std::move(tStationIdent), std::move(it.second)});
+    }
+
+    //Use boat name instead of 'rowid' as key
+    std::map<QString, Aux::Boat> tReloadedBoats;
+    for (auto it : DatabaseCache::boats())
+        tReloadedBoats.insert({it.second.name, std::move(it.second)});
+
+    if (tReloadedStations == loadedStations && tReloadedBoats == loadedBoats)
+        return;
+
+    if (tReloadedStations != loadedStations)
+    {
+        std::map<QString, Aux::Station> tCurrentStations = tReloadedStations;
+        applyChanges(loadedStations, stations, tCurrentStations);
+
+        loadedStations = std::move(tReloadedStations);
+        stations = std::move(tCurrentStations);
+
+        disableDefaultStationSelection();
+    }
+
+    if (tReloadedBoats != loadedBoats)
+    {
+        std::map<QString, Aux::Boat> tCurrentBoats = tReloadedBoats;
+        applyChanges(loadedBoats, boats, tCurrentBoats);
+
+        loadedBoats = std::move(tReloadedBoats);
+        boats = std::move(tCurrentBoats);
+
+        disableDefaultBoatSelection();
+    }
+
+    updateStationsBoatsComboBoxes();
+
+    //Selected entries may have changed without changing combo box index
+    updateStationsInputs();
+    updateBoatsInputs();
+}
+
+//
+
 /*!
  * \brief If documents tab selected, fit table to contents.
  *
@@ -1460,9 +1745,26 @@ void SettingsDialog::on_documents_tableWidget_cellChanged(const int row, const i
  */
 void SettingsDialog::on_singleInstance_checkBox_stateChanged(const int arg1)
 {
-    if ((arg1 == Qt::CheckState::Checked) && !SettingsCache::getBoolSetting("app_singleInstance"))
+    if ((arg1 == Qt::CheckState::Checked) && !SettingsCache::getBoolSetting(SettingsCache::IntSetting::_SINGLE_INSTANCE))
     {
         QMessageBox(QMessageBox::Information, "Nur eine Instanz erlauben",
                     "Damit diese Änderung wirksam wird, muss das Programm neu gestartet werden!", QMessageBox::Ok, this).exec();
     }
 }
+
+/*!
+ * \brief Show restart hint when changing concurrent database access.
+ *
+ * Shows a message box asking the user to restart the application in order for the changed database access mode to become active.
+ *
+ * \param arg1 Check box check state.
+ */
+void SettingsDialog::on_concurrentAccess_checkBox_stateChanged(const int arg1)
+{
+    if ((arg1 == Qt::CheckState::Checked) != SettingsCache::getBoolSetting(SettingsCache::IntSetting::_DATABASE_CONCURRENT_ACCESS))
+    {
+        QMessageBox(QMessageBox::Information, "Gleichzeitig schreiben erlauben",
+                    "Damit diese Änderung wirksam wird, muss das Programm (in allen Instanzen) neu gestartet werden!",
+                    QMessageBox::Ok, this).exec();
+    }
+}
@@ -24,6 +24,7 @@
 #define SETTINGSDIALOG_H
 
 #include "auxil.h"
+#include "settingscache.h"
 
 #include <QDialog>
 #include <QString>
@@ -56,6 +57,21 @@ public:
 private:
     void readDatabase();                    ///< Read the settings from database.
     bool writeDatabase() const;             ///< Write the settings to database.
+    bool writeSettings() const;             ///< Write the changed settings to database (cache).
+    //
+    template <typename T>
+    static void applyChanges(const std::map<QString, T>& pLoaded, const std::map<QString, T>& pEdited,
+                             std::map<QString, T>& pCurrent);   ///< \brief Apply the changes made in the dialog
+                                                                ///  to the current stations or boats.
+    //
+    int readIntSetting(SettingsCache::IntSetting pSetting);             ///< Read an integer setting and remember its value.
+    bool readBoolSetting(SettingsCache::IntSetting pSetting);           ///< Read an integer setting as boolean and remember its value.
+    QString readStrSetting(SettingsCache::StrSetting pSetting);         ///< Read a string setting and remember its value.
+    bool writeIntSetting(SettingsCache::IntSetting pSetting, int pValue) const;             ///< \brief Write an integer setting,
+                                                                                            ///  if changed.
+    bool writeBoolSetting(SettingsCache::IntSetting pSetting, bool pValue) const;           ///< \brief Write an integer setting
+                                                                                            ///  as boolean, if changed.
+    bool writeStrSetting(SettingsCache::StrSetting pSetting, const QString& pValue) const;  ///< Write a string setting, if changed.
     //
     void updateStationsBoatsComboBoxes();   ///< Update the entries of station/boat combo boxes.
     void updateStationsInputs();            ///< Update the station inputs according to the selected station combo box entry.
@@ -71,6 +87,9 @@ private:
 private slots:
     void accept() override;                                                     ///< Reimplementation of QDialog::accept().
     //
+    void on_databaseConfigChanged();                                            ///< \brief Update stations and boats after the
+                                                                                ///  configuration database was changed externally.
+    //
     void on_settings_tabWidget_currentChanged(int index);                       ///< If documents tab selected, fit table to contents.
     //
     void on_chooseDefaultFilePath_pushButton_pressed();                         ///< Set default file path using a file dialog.
@@ -107,6 +126,7 @@ private slots:
                                                                                 ///  used to separate documents and names/paths.
     //
     void on_singleInstance_checkBox_stateChanged(int arg1);         ///< Show restart hint when newly activating single instance mode.
+    void on_concurrentAccess_checkBox_stateChanged(int arg1);       ///< Show restart hint when changing concurrent database access.
 
 private:
     Ui::SettingsDialog* ui;                     //UI
@@ -117,6 +137,11 @@ private:
     //
     std::map<QString, Aux::Station> stations;   //Map of loaded/added/edited stations with station identifier as key
     std::map<QString, Aux::Boat> boats;         //Map of loaded/added/edited boats with boat name as key
+    //
+    std::map<SettingsCache::IntSetting, int> loadedIntSettings;     //Integer settings as read from database (to detect changes)
+    std::map<SettingsCache::StrSetting, QString> loadedStrSettings; //String settings as read from database (to detect changes)
+    std::map<QString, Aux::Station> loadedStations;                 //Stations as read from database (to detect changes)
+    std::map<QString, Aux::Boat> loadedBoats;                       //Boats as read from database (to detect changes)
 };
 
 #endif // SETTINGSDIALOG_H
@@ -22,8 +22,14 @@
 
 #include "singleinstancesynchronizer.h"
 
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QMetaObject>
+#include <QObject>
+
 #include <chrono>
-#include <string>
+#include <iostream>
 #include <thread>
 
 //Initialize static class members
@@ -31,21 +37,21 @@
 bool SingleInstanceSynchronizer::initialized = false;
 bool SingleInstanceSynchronizer::master = false;
 //
-QSharedMemory SingleInstanceSynchronizer::shmCtrl = QSharedMemory("wd.mgr-sync-bus-ctrl");
-QSharedMemory SingleInstanceSynchronizer::shmData = QSharedMemory("wd.mgr-sync-bus-data");
+QSharedMemory SingleInstanceSynchronizer::shmMaster = QSharedMemory("wd.mgr-sync-bus-ctrl");
+QLocalServer* SingleInstanceSynchronizer::server = nullptr;
 //
-const std::size_t SingleInstanceSynchronizer::shmDataLength = 4096;
+const QString SingleInstanceSynchronizer::serverName = "wd.mgr-sync-bus";
 
 //Public
 
 /*!
  * \brief Initialize the bus connection and determine if master or slave instance.
  *
- * Tries to attach to the shared memory segments used for the bus connection.
- * If no other instance has been attached yet then this instance is going to be
+ * Tries to create the shared memory segment used to determine the master instance.
+ * If no other instance has created it yet then this instance is going to be
  * the master instance (isMaster() returns true) and is going to be a slave instance
- * otherwise. In case of the master instance the bus signals will be initialized to
- * be in the idle state. If no error occured then isInitialized() will return true.
+ * otherwise. The master instance must then call listen() to actually process requests.
+ * If no error occured then isInitialized() will return true.
  *
  * Returns true immediately if already initialized before (and detach() not called since then).
  *
@@ -58,46 +64,12 @@ bool SingleInstanceSynchronizer::init()
 
     initialized = false;
 
-    //Try to create the two shared memory segments required for the bus operation
-    bool masterCtrl = shmCtrl.create(1, QSharedMemory::AccessMode::ReadWrite);
-    bool masterData = shmData.create(shmDataLength*sizeof(wchar_t), QSharedMemory::AccessMode::ReadWrite);
-
-    //Either both segments should already exist (use "slave" mode) or not exist (use "master" mode)
-    if (masterCtrl != masterData)
-        return false;
+    //Try to create the shared memory segment; if it already exists use "slave" mode
+    master = shmMaster.create(1, QSharedMemory::AccessMode::ReadWrite);
 
-    if (!masterCtrl && shmCtrl.error() != QSharedMemory::AlreadyExists)
+    if (!master && shmMaster.error() != QSharedMemory::AlreadyExists)
         return false;
 
-    master = masterCtrl;
-
-    //Initialize bus signals if master or simply attach to bus otherwise
-
-    if (master)
-    {
-        if (!shmCtrl.lock())
-            return false;
-
-        *(static_cast<int8_t*>(shmCtrl.data())) = static_cast<int8_t>(BusCtrlSymbol::_IDLE);
-
-        if (!shmCtrl.unlock())
-            return false;
-
-        if (!shmData.lock())
-            return false;
-
-        //Set data to empty string
-        std::wcsncpy(static_cast<wchar_t*>(shmData.data()), std::wstring(shmDataLength, L'\0').data(), shmDataLength);
-
-        if (!shmData.unlock())
-            return false;
-    }
-    else
-    {
-        if (!shmCtrl.attach(QSharedMemory::AccessMode::ReadWrite) || !shmData.attach(QSharedMemory::AccessMode::ReadWrite))
-            return false;
-    }
-
     initialized = true;
 
     return initialized;
@@ -106,7 +78,8 @@ bool SingleInstanceSynchronizer::init()
 /*!
  * \brief Disconnect the instance from the bus.
  *
- * Disconnects from the bus by detaching the instance from the shared memory segments.
+ * Disconnects from the bus by stopping to listen for requests (if master instance)
+ * and by detaching the instance from the shared memory segment.
  * In the following, isInitialized() will return false.
  *
  * \return If successful (or false if not initialized).
@@ -118,10 +91,18 @@ bool SingleInstanceSynchronizer::detach()
 
     initialized = false;
 
-    bool success = shmCtrl.detach();
-    success &= shmData.detach();
+    //Stop processing requests; this also closes and deletes all open connections to slave instances
+    if (server != nullptr)
+    {
+        server->close();
+        delete server;
+        server = nullptr;
+    }
 
-    return success;
+    if (!master)
+        return true;
+
+    return shmMaster.detach();
 }
 
 //
@@ -156,8 +137,7 @@ bool SingleInstanceSynchronizer::isMaster()
 /*!
  * \brief Send request to start a new report to the master instance via the bus.
  *
- * Waits until the bus is idle and then sends the request to the master instance
- * by setting the bus' control signal accordingly. Returns in case of an error.
+ * Sends the request to the master instance (see sendRequests()). Returns in case of an error.
  *
  * Returns immediately if bus not initialized or if isMaster().
  */
@@ -170,37 +150,14 @@ void SingleInstanceSynchronizer::sendNewReport()
     if (master)
         return;
 
-    //Wait until bus is idle and then send new report request by changing control signal accordingly
-    while (true)
-    {
-        if (!shmCtrl.lock())
-            return;
-
-        int8_t& ctrlVal = *(static_cast<int8_t*>(shmCtrl.data()));
-
-        if (ctrlVal == static_cast<int8_t>(BusCtrlSymbol::_IDLE))
-        {
-            ctrlVal = static_cast<int8_t>(BusCtrlSymbol::_NEW_REPORT);
-            break;
-        }
-
-        if (!shmCtrl.unlock())
-            return;
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
-
-    shmCtrl.unlock();
+    sendRequests(BusCtrlSymbol::_NEW_REPORT, {""});
 }
 
 /*!
  * \brief Send request to open existing report to the master instance via the bus.
  *
- * Waits until the bus is idle and then sends the request to the master instance by
- * setting the bus' control signal accordingly and setting the bus' data signal
- * to the report's file name \p pFileName. Returns in case of an error.
- *
- * \p pFileName can be 4096 'wchar_t's long (number not including null termination).
+ * Sends the request together with the report's file name \p pFileName to the master instance
+ * (see sendRequests()). Returns in case of an error. Use sendOpenReports() to open many reports.
  *
  * Returns immediately if bus not initialized or if isMaster().
  *
@@ -215,124 +172,203 @@ void SingleInstanceSynchronizer::sendOpenReport(const QString& pFileName)
     if (master)
         return;
 
-    //Wait until bus is idle and then send open report request by changing control signal accordingly
-    //and setting data signal to the report's file name before releasing the control signal lock
-
-    while (true)
-    {
-        if (!shmCtrl.lock())
-            return;
-
-        int8_t& ctrlVal = *(static_cast<int8_t*>(shmCtrl.data()));
-
-        if (ctrlVal == static_cast<int8_t>(BusCtrlSymbol::_IDLE))
-        {
-            ctrlVal = static_cast<int8_t>(BusCtrlSymbol::_OPEN_REPORT);
-            break;
-        }
-
-        if (!shmCtrl.unlock())
-            return;
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
+    sendRequests(BusCtrlSymbol::_OPEN_REPORT, {pFileName});
+}
 
-    if (!shmData.lock())
+/*!
+ * \brief Send requests to open many existing reports to the master instance via the bus at once.
+ *
+ * Like sendOpenReport() but sends the requests for all reports' file names \p pFileNames
+ * as a single message over a single connection (see sendRequests()), which is much faster
+ * than calling sendOpenReport() for each report. Returns in case of an error.
+ *
+ * Returns immediately if bus not initialized or if isMaster().
+ *
+ * \param pFileNames File names of the reports.
+ */
+void SingleInstanceSynchronizer::sendOpenReports(const QStringList& pFileNames)
+{
+    if (!initialized)
         return;
 
-    std::wstring fileNameWStr = pFileName.toStdWString();
-    fileNameWStr.resize(shmDataLength);
-
-    std::wcsncpy(static_cast<wchar_t*>(shmData.data()), fileNameWStr.c_str(), shmDataLength);
+    //Only send requests from "slave" to "master"
+    if (master)
+        return;
 
-    shmData.unlock();
+    if (pFileNames.isEmpty())
+        return;
 
-    shmCtrl.unlock();
+    sendRequests(BusCtrlSymbol::_OPEN_REPORT, pFileNames);
 }
 
 //
 
 /*!
- * \brief Control the bus and continuously process all incoming requests.
+ * \brief Start processing all incoming requests in the master instance.
  *
- * Starts an infinite loop to process incoming events. In each loop iteration, waits until the bus is
- * not idle (incoming request) and then reads the request type and additional information (file name)
- * from the bus' control and data signals, respectively. Finally, resets the bus to its idle state and,
- * depending on the request type, uses \p pStartupWindow to create a report or open the specified report
+ * Starts a local server that accepts connections from slave instances. Requests are processed by the
+ * application's event loop whenever data arrive on a connection, i.e. without any polling. Depending
+ * on the request type, \p pStartupWindow is used to create a report or open the specified report
  * (see StartupWindow::emitOpenAnotherReportRequested(); see also sendNewReport() and sendOpenReport()).
  *
- * When \p pStopListening becomes true the processing of the current request is completed and then the function returns.
+ * Requests are processed until detach() is called. This function must be called from the main thread.
  *
  * Returns immediately if bus not initialized or if not isMaster().
  *
- * Returns as soon as reading or writing of a bus signal fails.
- *
  * \param pStartupWindow StartupWindow that shall be used to open the report windows.
- * \param pStopListening Control variable for stopping the infinite loop.
+ * \return If the local server could be started (or was already started).
  */
-void SingleInstanceSynchronizer::listen(StartupWindow& pStartupWindow, const std::atomic_bool& pStopListening)
+bool SingleInstanceSynchronizer::listen(StartupWindow& pStartupWindow)
 {
     if (!initialized)
-        return;
+        return false;
 
     //Only receive requests from "slave"s by "master"
     if (!master)
-        return;
+        return false;
 
-    //Repeatedly check bus control signal for requests as long as 'pStopListening' is false;
-    //in case of a request, process it using request type from the control signal and additional
-    //information from the data signal; reset control and data signals after processing each request
+    if (server != nullptr)
+        return true;
 
-    while (true)
+    server = new QLocalServer();
+    server->setSocketOptions(QLocalServer::UserAccessOption);
+
+    //A previous master instance may have crashed and left its socket behind; this instance is the master now anyway
+    QLocalServer::removeServer(serverName);
+
+    if (!server->listen(serverName))
     {
-        //Wait until a request arrived on the bus; return from this function immediately if 'pStopListening' becomes true
-        while (true)
-        {
-            if (pStopListening.load() == true)
-                return;
+        std::cerr<<"ERROR: Could not start local server for application instance synchronization!"<<std::endl;
+
+        delete server;
+        server = nullptr;
+
+        return false;
+    }
+
+    QObject::connect(server, &QLocalServer::newConnection, server, [&pStartupWindow]() -> void
+                     {
+                         while (server->hasPendingConnections())
+                         {
+                             QLocalSocket* tSocket = server->nextPendingConnection();
+
+                             QObject::connect(tSocket, &QLocalSocket::readyRead, tSocket, [tSocket, &pStartupWindow]() -> void
+                                              {
+                                                  processRequests(*tSocket, pStartupWindow);
+                                              });
+                             QObject::connect(tSocket, &QLocalSocket::disconnected, tSocket, &QLocalSocket::deleteLater);
+
+                             //Data may have arrived already together with the connection
+                             processRequests(*tSocket, pStartupWindow);
+                         }
+                     });
 
-            if (!shmCtrl.lock())
-                return;
+    return true;
+}
+
+//Private
+
+/*!
+ * \brief Send requests to the master instance.
+ *
+ * Connects to the master instance's local server and sends one request of type \p pSymbol for each file name
+ * from \p pFileNames. All requests are sent together as a single message over the same connection, such that
+ * the master instance receives and processes them at once. Since the master instance might still be starting up,
+ * connecting is retried for some time (see 'connectTimeout').
+ *
+ * \param pSymbol Request type.
+ * \param pFileNames Additional file names for the requests (may be empty strings).
+ * \return If the requests were completely sent.
+ */
+bool SingleInstanceSynchronizer::sendRequests(const BusCtrlSymbol pSymbol, const QStringList& pFileNames)
+{
+    QLocalSocket tSocket;
 
-            int8_t ctrlVal = *(static_cast<const int8_t*>(shmCtrl.constData()));
+    const auto tDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(connectTimeout);
 
-            if (ctrlVal != static_cast<int8_t>(BusCtrlSymbol::_IDLE))
-                break;
+    while (true)
+    {
+        tSocket.connectToServer(serverName);
 
-            if (!shmCtrl.unlock())
-                return;
+        if (tSocket.waitForConnected(connectTimeout))
+            break;
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (std::chrono::steady_clock::now() >= tDeadline)
+        {
+            std::cerr<<"ERROR: Could not connect to master application instance!"<<std::endl;
+            return false;
         }
 
-        //Read request type from control signal and additional information from data signal
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
 
-        if (!shmData.lock())
-            return;
+    QByteArray tData;
+    QDataStream tStream(&tData, QIODevice::WriteOnly);
+    tStream.setVersion(QDataStream::Qt_6_0);
 
-        std::wstring wStr(static_cast<const wchar_t*>(shmData.constData()), shmDataLength);
+    for (const QString& tFileName : pFileNames)
+        tStream<<static_cast<qint8>(pSymbol)<<tFileName;
 
-        wStr.resize(std::wcslen(wStr.c_str()));
+    tSocket.write(tData);
+
+    //Disconnecting writes all pending data first
+    tSocket.disconnectFromServer();
+
+    if (tSocket.state() != QLocalSocket::UnconnectedState && !tSocket.waitForDisconnected(connectTimeout))
+    {
+        std::cerr<<"ERROR: Could not send requests to master application instance!"<<std::endl;
+        return false;
+    }
+
+    return true;
+}
 
-        //Reset data to empty string
-        std::wcsncpy(static_cast<wchar_t*>(shmData.data()), std::wstring(shmDataLength, L'\0').data(), shmDataLength);
+/*!
+ * \brief Process all completely received requests from a slave instance.
+ *
+ * Reads all complete requests from \p pSocket and forwards them to \p pStartupWindow (see listen()).
+ * An incomplete request is left in \p pSocket until its remaining data arrive.
+ *
+ * The requests are forwarded through the event loop such that dialogs opened by \p pStartupWindow
+ * do not block reading from \p pSocket.
+ *
+ * \param pSocket Connection to a slave instance.
+ * \param pStartupWindow StartupWindow that shall be used to open the report windows.
+ */
+void SingleInstanceSynchronizer::processRequests(QLocalSocket& pSocket, StartupWindow& pStartupWindow)
+{
+    QDataStream tStream(&pSocket);
+    tStream.setVersion(QDataStream::Qt_6_0);
 
-        int8_t ctrlVal = *(static_cast<const int8_t*>(shmCtrl.constData()));
+    while (true)
+    {
+        tStream.startTransaction();
 
-        //Reset control signal to idle state (i.e. no current request)
-        *(static_cast<int8_t*>(shmCtrl.data())) = static_cast<int8_t>(BusCtrlSymbol::_IDLE);
+        qint8 tSymbol = 0;
+        QString tFileName;
 
-        //Forward processed request to 'pStartupWindow'
+        tStream>>tSymbol>>tFileName;
 
-        if (ctrlVal == static_cast<int8_t>(BusCtrlSymbol::_NEW_REPORT))
-            pStartupWindow.emitOpenAnotherReportRequested("");
-        else if (ctrlVal == static_cast<int8_t>(BusCtrlSymbol::_OPEN_REPORT))
-            pStartupWindow.emitOpenAnotherReportRequested(QString::fromStdWString(wStr));
+        if (!tStream.commitTransaction())
+        {
+            //Drop connection on invalid data, otherwise wait for remaining data of the request
+            if (tStream.status() == QDataStream::ReadCorruptData)
+                pSocket.abort();
 
-        if (!shmData.unlock())
             return;
+        }
 
-        if (!shmCtrl.unlock())
-            return;
+        if (tSymbol == static_cast<qint8>(BusCtrlSymbol::_NEW_REPORT))
+            tFileName = "";
+        else if (tSymbol != static_cast<qint8>(BusCtrlSymbol::_OPEN_REPORT))
+        {
+            std::cerr<<"WARNING: Received invalid request from other application instance!"<<std::endl;
+            continue;
+        }
+
+        QMetaObject::invokeMethod(&pStartupWindow, [&pStartupWindow, tFileName]() -> void
+                                  {
+                                      pStartupWindow.emitOpenAnotherReportRequested(tFileName);
+                                  }, Qt::QueuedConnection);
     }
 }
@@ -25,22 +25,28 @@
 
 #include "startupwindow.h"
 
+#include <QLocalServer>
+#include <QLocalSocket>
 #include <QSharedMemory>
 #include <QString>
+#include <QStringList>
 
-#include <atomic>
-#include <cwchar>
+#include <cstdint>
 
 /*!
  * \brief Interface between a single "master" application instance and multiple "slave" instances that automatically exit again.
  *
  * Implements a virtual "bus" for communicating requests from multiple application instances to execute different
- * tasks in a main ("master") instance instead of the instance that sends the request ("slave"). The bus is based
- * on shared memory segments and is initialized by init(). The first of all instances that calls init() initially
- * creates the shared memory segments and becomes the master instance (see also isMaster()), which has to control
- * the bus and process the requests (see listen()). If a master instance is already running then init() simply attaches
- * to the bus and the instance becomes a slave instance. A slave instance can send requests to create a new Report in
- * the master instance (see sendNewReport()) or to open an existing Report in the master instance (see sendOpenReport()).
+ * tasks in a main ("master") instance instead of the instance that sends the request ("slave"). The bus is initialized
+ * by init(). The first of all instances that calls init() initially creates a shared memory segment and becomes the
+ * master instance (see also isMaster()), which has to listen for and process the requests (see listen()). If a master
+ * instance is already running then the instance becomes a slave instance. A slave instance can send requests to create
+ * a new Report in the master instance (see sendNewReport()) or to open existing Reports in the master instance
+ * (see sendOpenReport() and sendOpenReports()).
+ *
+ * The requests themselves are transferred via a local socket (QLocalServer/QLocalSocket) rather than via shared memory.
+ * Hence the master instance is woken up by the event loop only when a request actually arrives and does not need
+ * to poll the bus, and slave instances do not need to wait for the bus to become idle.
  *
  * Note: If a slave instance does not need to send further requests (or a master instance does not want to be
  * one but rather exit) but still has to keep running for some reason then it can use detach() to detach from
@@ -59,36 +65,37 @@ public:
     //
     static void sendNewReport();                            ///< Send request to start a new report to the master instance via the bus.
     static void sendOpenReport(const QString& pFileName);   ///< Send request to open existing report to the master instance via the bus.
+    static void sendOpenReports(const QStringList& pFileNames); ///< \brief Send requests to open many existing reports to the master
+                                                                ///  instance via the bus at once.
     //
-    static void listen(StartupWindow& pStartupWindow, const std::atomic_bool& pStopListening);  ///< \brief Control the bus and
-                                                                                                ///  continuously process all
-                                                                                                ///  incoming requests.
+    static bool listen(StartupWindow& pStartupWindow);      ///< Start processing all incoming requests in the master instance.
 
 private:
     /*!
-     * \brief Symbols that can be used for the bus control signal.
+     * \brief Symbols that identify the different request types sent via the bus.
      *
-     * The values define different states of the bus. If the bus is BusCtrlSymbol::_IDLE then the master
-     * instance is waiting for requests from slave instances (see listen()). In the idle state slave instances
-     * can send requests on the bus if they can acquire the lock for the control signal. The request is sent
-     * by setting the control signal to a symbol different from BusCtrlSymbol::_IDLE and releasing the lock.
-     * Additional data that need to be sent via the data signal must be set before releasing the control lock.
+     * Each request is sent as one of these symbols followed by additional data (a file name, possibly empty).
      */
     enum class BusCtrlSymbol : int8_t
     {
-        _IDLE = 0,          ///< Idle state.
         _NEW_REPORT = 1,    ///< Create a new report and show it in another report window. See also sendNewReport().
         _OPEN_REPORT = 2    ///< Open an existing report in another report window. See also sendOpenReport().
     };
 
+private:
+    static bool sendRequests(BusCtrlSymbol pSymbol, const QStringList& pFileNames);    ///< Send requests to the master instance.
+    static void processRequests(QLocalSocket& pSocket, StartupWindow& pStartupWindow); ///< \brief Process all completely received
+                                                                                        ///  requests from a slave instance.
+
 private:
     static bool initialized;        //Shared memory set up and master/slave mode determined
     static bool master;             //Operate in master or slave mode
     //
-    static QSharedMemory shmCtrl;   //Shared memory segment for the "control signal" of a "bus" for communication between instances
-    static QSharedMemory shmData;   //Shared memory segment for the "data signal" of a "bus" for communication between instances
+    static QSharedMemory shmMaster; //Shared memory segment that is created by (and hence determines) the master instance
+    static QLocalServer* server;    //Local server of the master instance for receiving the requests of slave instances
     //
-    static const std::size_t shmDataLength; //Maximum number of wide characters to be stored in the "data signal" shared memory segment
+    static const QString serverName;        //Name of the local server (i.e. of the "bus")
+    static constexpr int connectTimeout = 5000; //Time in milliseconds to wait for the master instance to accept a request
 };
 
 #endif // SINGLEINSTANCESYNCHRONIZER_H
@@ -0,0 +1,256 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "startupprofiler.h"
+
+#include "auxil.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
+
+#include <cstdlib>
+#include <iostream>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#else
+#include <ctime>
+#endif
+
+//Initialize static class members
+
+bool StartupProfiler::enabled = false;
+QString StartupProfiler::fileName;
+//
+QElapsedTimer StartupProfiler::wallTimer;
+double StartupProfiler::cpuTimeAtInitMs = 0.0;
+//
+std::vector<StartupProfiler::Phase> StartupProfiler::phases;
+bool StartupProfiler::phaseOpen = false;
+bool StartupProfiler::written = false;
+
+//Public
+
+/*!
+ * \brief Destructor.
+ *
+ * Writes the trace file, if not written yet (see StartupProfiler::write()).
+ */
+StartupProfiler::ScopedWriter::~ScopedWriter()
+{
+    StartupProfiler::write();
+}
+
+//
+
+/*!
+ * \brief Enable profiling, if requested by environment variable.
+ *
+ * Enables profiling, if the environment variable WACHDIENST_MANAGER_STARTUP_PROFILE is set to a (non-empty)
+ * file name, to which the trace will be written. Starts the wall-clock timer and remembers the CPU time
+ * consumed by the process so far (mainly static initialization). Should be called at the very beginning of main().
+ */
+void StartupProfiler::init()
+{
+    const char* tEnvFileName = std::getenv("WACHDIENST_MANAGER_STARTUP_PROFILE");
+
+    if (tEnvFileName == nullptr || QString(tEnvFileName).trimmed() == "")
+        return;
+
+    enabled = true;
+    fileName = QString(tEnvFileName).trimmed();
+
+    cpuTimeAtInitMs = cpuTimeMs();
+    wallTimer.start();
+}
+
+/*!
+ * \brief Check if profiling is enabled.
+ *
+ * \return If profiling was enabled by init().
+ */
+bool StartupProfiler::isEnabled()
+{
+    return enabled;
+}
+
+//
+
+/*!
+ * \brief End the current phase and begin a new phase.
+ *
+ * \param pName Name of the new phase.
+ */
+void StartupProfiler::beginPhase(const QString& pName)
+{
+    if (!enabled)
+        return;
+
+    endPhase();
+
+    phases.push_back({pName, wallTimer.nsecsElapsed() / 1000, 0, cpuTimeMs(), 0.0});
+    phaseOpen = true;
+}
+
+/*!
+ * \brief End the current phase.
+ *
+ * Does nothing, if no phase is running.
+ */
+void StartupProfiler::endPhase()
+{
+    if (!enabled || !phaseOpen)
+        return;
+
+    Phase& tPhase = phases.back();
+    tPhase.endUs = wallTimer.nsecsElapsed() / 1000;
+    tPhase.cpuEndMs = cpuTimeMs();
+
+    phaseOpen = false;
+}
+
+//
+
+/*!
+ * \brief End the current phase and write the trace file, if not written yet.
+ *
+ * Writes all recorded phases as complete ("X") events in Chrome's trace event format to the file specified by
+ * the environment variable (see init()). Each event contains the phase's wall-clock begin and duration as well
+ * as the consumed process CPU time (argument "cpuMs"). The CPU time spent before main() is added as
+ * "Static initialization" instant event. Note that the CPU time includes all threads of the process.
+ *
+ * Does nothing, if the trace file was already written (or tried to be written) before.
+ *
+ * \return If profiling is disabled, trace file already written or writing was successful.
+ */
+bool StartupProfiler::write()
+{
+    if (!enabled || written)
+        return true;
+
+    written = true;
+
+    endPhase();
+
+    QJsonArray tEvents;
+
+    QJsonObject tProcessNameEvent;
+    tProcessNameEvent.insert("name", "process_name");
+    tProcessNameEvent.insert("ph", "M");
+    tProcessNameEvent.insert("pid", 1);
+    tProcessNameEvent.insert("tid", 1);
+    tProcessNameEvent.insert("args", QJsonObject{{"name", "Wachdienst-Manager " + Aux::programVersionString}});
+    tEvents.append(tProcessNameEvent);
+
+    QJsonObject tStaticInitEvent;
+    tStaticInitEvent.insert("name", "Static initialization");
+    tStaticInitEvent.insert("cat", "startup");
+    tStaticInitEvent.insert("ph", "i");
+    tStaticInitEvent.insert("s", "p");
+    tStaticInitEvent.insert("ts", 0);
+    tStaticInitEvent.insert("pid", 1);
+    tStaticInitEvent.insert("tid", 1);
+    tStaticInitEvent.insert("args", QJsonObject{{"cpuMs", cpuTimeAtInitMs}});
+    tEvents.append(tStaticInitEvent);
+
+    for (const Phase& tPhase : phases)
+    {
+        QJsonObject tEvent;
+        tEvent.insert("name", tPhase.name);
+        tEvent.insert("cat", "startup");
+        tEvent.insert("ph", "X");
+        tEvent.insert("ts", tPhase.beginUs);
+        tEvent.insert("dur", tPhase.endUs - tPhase.beginUs);
+        tEvent.insert("pid", 1);
+        tEvent.insert("tid", 1);
+        tEvent.insert("args", QJsonObject{{"cpuMs", tPhase.cpuEndMs - tPhase.cpuBeginMs}});
+        tEvents.append(tEvent);
+    }
+
+    QJsonObject tTrace;
+    tTrace.insert("traceEvents", tEvents);
+    tTrace.insert("displayTimeUnit", "ms");
+    tTrace.insert("otherData", QJsonObject{{"programVersion", Aux::programVersionString},
+                                           {"totalWallMs", static_cast<double>(wallTimer.nsecsElapsed()) / 1e6},
+                                           {"totalCpuMs", cpuTimeMs()}});
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(QJsonDocument(tTrace).toJson()) == -1)
+    {
+        file.close();
+        std::cerr<<"ERROR: Could not write startup profile to \""<<fileName.toStdString()<<"\"!"<<std::endl;
+        return false;
+    }
+
+    file.close();
+
+    return true;
+}
+
+/*!
+ * \brief Write the trace file as soon as the event loop is idle.
+ *
+ * Begins a last phase "Event loop start" (covering e.g. showing the first window), which is ended
+ * as soon as the event loop has processed all pending events. The trace file is then written (see write()).
+ */
+void StartupProfiler::writeWhenIdle()
+{
+    if (!enabled || written)
+        return;
+
+    beginPhase("Event loop start");
+
+    QTimer::singleShot(0, []() -> void { StartupProfiler::write(); });
+}
+
+//Private
+
+/*!
+ * \brief Get the CPU time consumed by the process so far.
+ *
+ * \return Process CPU time (user and system, all threads) in milliseconds.
+ */
+double StartupProfiler::cpuTimeMs()
+{
+#if defined(Q_OS_WIN)
+    FILETIME tCreationTime, tExitTime, tKernelTime, tUserTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &tCreationTime, &tExitTime, &tKernelTime, &tUserTime))
+        return 0.0;
+
+    ULARGE_INTEGER tKernel, tUser;
+    tKernel.LowPart = tKernelTime.dwLowDateTime;
+    tKernel.HighPart = tKernelTime.dwHighDateTime;
+    tUser.LowPart = tUserTime.dwLowDateTime;
+    tUser.HighPart = tUserTime.dwHighDateTime;
+
+    return static_cast<double>(tKernel.QuadPart + tUser.QuadPart) / 1e4;    //Units of 100 ns
+#else
+    timespec tTime;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &tTime) != 0)
+        return 0.0;
+
+    return static_cast<double>(tTime.tv_sec) * 1e3 + static_cast<double>(tTime.tv_nsec) / 1e6;
+#endif
+}
@@ -0,0 +1,104 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef STARTUPPROFILER_H
+#define STARTUPPROFILER_H
+
+#include <QElapsedTimer>
+#include <QString>
+
+#include <vector>
+
+/*!
+ * \brief Measure the duration of the application startup phases.
+ *
+ * Records wall-clock and process CPU time for consecutive, named phases of the application startup (see beginPhase())
+ * and writes them as a trace file in Chrome's trace event format (JSON), which can be opened e.g. with
+ * chrome://tracing or https://ui.perfetto.dev (see write() and writeWhenIdle()). The CPU time already spent
+ * before entering main() (i.e. for static initialization) is recorded as well.
+ *
+ * Profiling is disabled by default and enabled by setting the environment variable
+ * WACHDIENST_MANAGER_STARTUP_PROFILE to the path of the trace file to be written (see init()).
+ * All functions do nothing, if profiling is disabled. The trace file is written only once. In order to also
+ * write it when returning early (e.g. on errors or after batch operations), use a ScopedWriter.
+ *
+ * Note: The profiler must only be used from the main thread.
+ */
+class StartupProfiler
+{
+public:
+    /*!
+     * \brief Write the trace file when leaving the scope.
+     *
+     * Calls write() on destruction, if the trace file was not written yet.
+     */
+    class ScopedWriter
+    {
+    public:
+        ScopedWriter() = default;                                   ///< Default constructor.
+        ~ScopedWriter();                                            ///< Destructor.
+        //
+        ScopedWriter(const ScopedWriter&) = delete;                 ///< Deleted copy constructor.
+        ScopedWriter& operator=(const ScopedWriter&) = delete;      ///< Deleted copy assignment operator.
+    };
+
+public:
+    StartupProfiler() = delete;     ///< Deleted constructor.
+    //
+    static void init();                                 ///< Enable profiling, if requested by environment variable.
+    static bool isEnabled();                            ///< Check if profiling is enabled.
+    //
+    static void beginPhase(const QString& pName);       ///< End the current phase and begin a new phase.
+    static void endPhase();                             ///< End the current phase.
+    //
+    static bool write();                                ///< End the current phase and write the trace file, if not written yet.
+    static void writeWhenIdle();                        ///< Write the trace file as soon as the event loop is idle.
+
+private:
+    static double cpuTimeMs();                          ///< Get the CPU time consumed by the process so far.
+
+private:
+    /*!
+     * \brief A recorded startup phase.
+     */
+    struct Phase
+    {
+        QString name;               ///< Name of the phase.
+        qint64 beginUs;             ///< Wall-clock begin time in microseconds (relative to init()).
+        qint64 endUs;               ///< Wall-clock end time in microseconds (relative to init()).
+        double cpuBeginMs;          ///< Process CPU time at begin in milliseconds.
+        double cpuEndMs;            ///< Process CPU time at end in milliseconds.
+    };
+
+private:
+    static bool enabled;                    //Profiling enabled?
+    static QString fileName;                //Trace file to write
+    //
+    static QElapsedTimer wallTimer;         //Wall-clock time since init()
+    static double cpuTimeAtInitMs;          //Process CPU time at init() (i.e. spent before main())
+    //
+    static std::vector<Phase> phases;       //Recorded phases
+    static bool phaseOpen;                  //Is the last phase still running?
+    static bool written;                    //Trace file already written?
+};
+
+#endif // STARTUPPROFILER_H
@@ -25,11 +25,14 @@
 
 #include "aboutdialog.h"
 #include "auxil.h"
+#include "databasecache.h"
 #include "newreportdialog.h"
 #include "personneldatabasedialog.h"
+#include "reportarchiveindex.h"
 #include "settingscache.h"
 #include "settingsdialog.h"
 
+#include <QApplication>
 #include <QDialog>
 #include <QFileDialog>
 #include <QKeySequence>
@@ -90,7 +93,7 @@ StartupWindow::StartupWindow(QWidget *const pParent) :
     setAcceptDrops(true);
 
     //React on "slave" application instances' requests to open existing or new reports in other report windows
-    if (SettingsCache::getBoolSetting("app_singleInstance"))
+    if (SettingsCache::getBoolSetting(SettingsCache::IntSetting::_SINGLE_INSTANCE))
     {
         connect(this, &StartupWindow::openAnotherReportRequested, this,
                 [this](const QString& pFileName) -> void {              //Use lambda expression to enable use of slot's default argument
@@ -117,6 +120,10 @@ StartupWindow::~StartupWindow()
  */
 void StartupWindow::newReport()
 {
+    //Report window needs the personnel database
+    if (!waitForPersonnelCache())
+        return;
+
     //Hide startup window before showing new report assistant dialog (clean startup with "-n" command line argument)
     hide();
 
@@ -140,12 +147,17 @@ void StartupWindow::newReport()
  * \brief Open report from file and show it in report window.
  *
  * Loads a report from \p pFileName and, if successful, shows it in a newly created report window after hiding this window.
+ * The report is also added to the report archive index (see ReportArchiveIndex::updateReport()).
  *
  * \param pFileName File name of the report.
  * \return If successful.
  */
 bool StartupWindow::openReport(const QString& pFileName)
 {
+    //Report window needs the personnel database
+    if (!waitForPersonnelCache())
+        return false;
+
     Report report;
     if (!report.open(pFileName))
     {
@@ -153,6 +165,9 @@ bool StartupWindow::openReport(const QString& pFileName)
         return false;
     }
 
+    //Keep report archive index up to date with each opened report
+    ReportArchiveIndex::updateReport(report);
+
     showReportWindow(std::move(report));
 
     return true;
@@ -261,6 +276,34 @@ void StartupWindow::showReportWindow(Report&& pReport)
     reportWindowPtrs.insert(std::move(reportWindowPtr));
 }
 
+//
+
+/*!
+ * \brief Wait until the personnel cache is filled.
+ *
+ * The personnel database is loaded in the background during startup (see DatabaseCache::populateAsync()).
+ * Blocks (showing a wait cursor) until loading has finished and shows an error message, if loading failed.
+ *
+ * \return If the personnel cache is available.
+ */
+bool StartupWindow::waitForPersonnelCache()
+{
+    if (!DatabaseCache::isPersonnelReady())
+    {
+        QApplication::setOverrideCursor(Qt::WaitCursor);
+        DatabaseCache::waitForPersonnel();
+        QApplication::restoreOverrideCursor();
+    }
+
+    if (!DatabaseCache::waitForPersonnel())
+    {
+        QMessageBox(QMessageBox::Critical, "Fehler", "Fehler beim Füllen des Datenbank-Caches!", QMessageBox::Ok, this).exec();
+        return false;
+    }
+
+    return true;
+}
+
 //Private slots
 
 /*!
@@ -353,6 +396,9 @@ void StartupWindow::on_loadReport_pushButton_pressed()
  */
 void StartupWindow::on_personnel_pushButton_pressed()
 {
+    if (!waitForPersonnelCache())
+        return;
+
     PersonnelDatabaseDialog personnelDialog(this);
     personnelDialog.exec();
 }
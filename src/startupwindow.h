@@ -63,6 +63,8 @@ private:
     void dropEvent(QDropEvent* pEvent) override;            ///< Reimplementation of QMainWindow::dropEvent().
     //
     void showReportWindow(Report&& pReport);                ///< Hide this window and create and show a new report window.
+    //
+    bool waitForPersonnelCache();                           ///< Wait until the personnel cache is filled.
 
 private slots:
     void on_reportWindowClosed(const ReportWindow* pWindow);                                ///< \brief Destroy and remove the pointer
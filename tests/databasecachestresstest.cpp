@@ -0,0 +1,321 @@
+/*
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of Wachdienst-Manager, a program to manage DLRG watch duty reports.
+//  Copyright (C) 2021–2024 M. Frohne
+//
+//  Wachdienst-Manager is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Wachdienst-Manager is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Wachdienst-Manager. If not, see <https://www.gnu.org/licenses/>.
+//
+/////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "databasecache.h"
+#include "databasecreator.h"
+#include "person.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QLockFile>
+#include <QString>
+#include <QTemporaryDir>
+#include <QtSql/QSqlDatabase>
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/*
+ * Stress test for the reader-writer locking of DatabaseCache (build with option WDM_BUILD_TSAN_TESTS).
+ *
+ * Several threads continuously call the (thread-safe) personnel readers of DatabaseCache, while the main thread
+ * adds, updates and removes persons and repeatedly reloads the whole personnel cache from the database,
+ * either directly or by re-populating the whole cache in the background (see DatabaseCache::populateAsync()).
+ * Data races are reported by ThreadSanitizer, which makes the test fail. The test itself additionally fails,
+ * if a reader observes an inconsistent cache or if the final cache does not match the expected personnel.
+ * Before, the databases are re-loaded in the background while concurrent database access is enabled, as on startup.
+ * Personnel verification is enabled (see DatabaseCache::setPersonnelVerification()), such that the test also fails,
+ * if the incrementally updated personnel cache differs from the personnel freshly loaded from the database after any edit.
+ */
+
+namespace
+{
+
+constexpr int initialPersonsCount = 200;    //Number of persons in database before starting the readers
+constexpr int editRounds = 300;             //Number of edit rounds of the main thread
+constexpr int reloadInterval = 10;          //Reload the whole personnel cache every this many edit rounds
+constexpr int repopulateInterval = 25;      //Re-populate the whole cache in the background every this many edit rounds
+constexpr int readerThreadsCount = 4;       //Number of concurrent reader threads
+
+/*
+ * Create a name from letters only (see Aux::personNamesValidator).
+ */
+QString nameFromNumber(int pNumber)
+{
+    QString tName = "Muster";
+
+    do
+    {
+        tName.append(QChar('a' + pNumber % 26));
+        pNumber /= 26;
+    }
+    while (pNumber > 0);
+
+    return tName;
+}
+
+/*
+ * Create test person number 'pNumber' with qualifications depending on 'pVariant'.
+ */
+Person createPerson(const int pNumber, const int pVariant)
+{
+    const QString tLastName = nameFromNumber(pNumber);
+    const QString tFirstName = "Erika";
+    const QString tMmbNr = QString::number(100000 + pNumber);
+
+    return Person(tLastName, tFirstName, Person::createInternalIdent(tLastName, tFirstName, tMmbNr),
+                  Person::Qualifications(pVariant % 2 == 0 ? "EH,DRSA-S" : "EH,DRSA-S,BF-A"), pVariant % 3 != 0);
+}
+
+/*
+ * Repeatedly call all personnel readers until 'pStop' is set. Returns false in 'pConsistent' on inconsistent results.
+ * 'pRepopulations' is odd while the cache is re-populated in the background (i.e. while it may be empty or incomplete).
+ */
+void readPersonnel(const std::atomic_bool& pStop, std::atomic_bool& pConsistent, const std::atomic_int& pRepopulations)
+{
+    int tRound = 0;
+
+    while (!pStop.load())
+    {
+        const int tNumber = tRound++ % initialPersonsCount;
+
+        const Person tExpected = createPerson(tNumber, 0);
+        const QString tMmbNr = Person::extractMembershipNumber(tExpected.getIdent());
+
+        const int tRepopulationsBefore = pRepopulations.load();
+
+        //Initial persons are never removed, so they must still be cached, unless the cache was re-populated meanwhile
+        std::shared_ptr<const std::vector<Person>> tSnapshot = DatabaseCache::personnel();
+        bool tSnapshotResolved = true;
+
+        for (const Person& tPerson : *tSnapshot)
+        {
+            if (tPerson.getIdent().isEmpty())
+                pConsistent.store(false);
+            else if (Person::extractMembershipNumber(tPerson.getIdent()).toInt() < 100000 + initialPersonsCount)
+            {
+                Person tCachedPerson = Person::dummyPerson();
+
+                if (!DatabaseCache::personExists(tPerson.getIdent()) ||
+                    !DatabaseCache::getPerson(tCachedPerson, tPerson.getIdent()) || tCachedPerson.getIdent() != tPerson.getIdent())
+                {
+                    tSnapshotResolved = false;
+                }
+            }
+        }
+
+        if (!tSnapshotResolved && tRepopulationsBefore % 2 == 0 && pRepopulations.load() == tRepopulationsBefore)
+            pConsistent.store(false);
+
+        Person tPerson = Person::dummyPerson();
+
+        if (DatabaseCache::getPerson(tPerson, tExpected.getIdent()) && tPerson.getIdent() != tExpected.getIdent())
+            pConsistent.store(false);
+
+        DatabaseCache::getPerson(tPerson, tExpected.getLastName(), tExpected.getFirstName(), tMmbNr);
+        DatabaseCache::personExists(tExpected.getIdent());
+        DatabaseCache::memberNumExists(tMmbNr);
+
+        std::vector<Person> tPersons;
+        DatabaseCache::getPersons(tPersons, tExpected.getLastName(), tExpected.getFirstName());
+
+        if (tPersons.size() > 1)
+            pConsistent.store(false);
+
+        DatabaseCache::getPersonnel(tPersons);
+    }
+}
+
+/*
+ * Open a new, empty pair of configuration and personnel databases in 'pDirName' and populate the cache.
+ */
+bool setUpDatabases(const QString& pDirName, const std::shared_ptr<QLockFile>& pLockFile)
+{
+    QSqlDatabase confDatabase = QSqlDatabase::addDatabase("QSQLITE", "configDb");
+    confDatabase.setDatabaseName(QDir(pDirName).filePath("config.sqlite3"));
+
+    QSqlDatabase personnelDatabase = QSqlDatabase::addDatabase("QSQLITE", "personnelDb");
+    personnelDatabase.setDatabaseName(QDir(pDirName).filePath("personnel.sqlite3"));
+
+    if (!confDatabase.open() || !personnelDatabase.open())
+    {
+        std::cerr<<"ERROR: Could not open databases!"<<std::endl;
+        return false;
+    }
+
+    if (!DatabaseCreator::createConfigDatabase() || !DatabaseCreator::createPersonnelDatabase())
+    {
+        std::cerr<<"ERROR: Could not create databases!"<<std::endl;
+        return false;
+    }
+
+    if (!pLockFile->tryLock(1000))
+    {
+        std::cerr<<"ERROR: Could not lock databases!"<<std::endl;
+        return false;
+    }
+
+    return DatabaseCache::populate(pLockFile, pLockFile);
+}
+
+/*
+ * Start loading the databases in the background and directly enable concurrent access, as done on startup.
+ * Switching the journal mode must wait for the background loaders instead of running into the busy timeout.
+ */
+bool enableConcurrentAccessWhileLoading(const std::shared_ptr<QLockFile>& pLockFile)
+{
+    QElapsedTimer tTimer;
+    tTimer.start();
+
+    DatabaseCache::populateAsync(pLockFile, pLockFile);
+
+    if (!DatabaseCache::waitForConfig() || !DatabaseCache::setConcurrentAccess(true) || !DatabaseCache::waitForPersonnel())
+    {
+        std::cerr<<"ERROR: Could not enable concurrent access while loading databases!"<<std::endl;
+        return false;
+    }
+
+    if (tTimer.elapsed() >= 5000)
+    {
+        std::cerr<<"ERROR: Enabling concurrent access waited for the database busy timeout!"<<std::endl;
+        return false;
+    }
+
+    if (DatabaseCache::personnel()->size() != static_cast<std::size_t>(initialPersonsCount))
+    {
+        std::cerr<<"ERROR: Unexpected number of cached persons after loading databases!"<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QTemporaryDir tDir;
+
+    if (!tDir.isValid())
+    {
+        std::cerr<<"ERROR: Could not create temporary directory!"<<std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::shared_ptr<QLockFile> tLockFile = std::make_shared<QLockFile>(tDir.filePath("db.lock"));
+
+    if (!setUpDatabases(tDir.path(), tLockFile))
+        return EXIT_FAILURE;
+
+    std::vector<Person> tInitialPersons;
+
+    for (int i = 0; i < initialPersonsCount; ++i)
+        tInitialPersons.push_back(createPerson(i, 0));
+
+    std::vector<std::size_t> tInvalidPersons, tDuplicatePersons;
+
+    if (!DatabaseCache::addPersons(tInitialPersons, tInvalidPersons, tDuplicatePersons) ||
+        !tInvalidPersons.empty() || !tDuplicatePersons.empty())
+    {
+        std::cerr<<"ERROR: Could not add initial persons!"<<std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!enableConcurrentAccessWhileLoading(tLockFile))
+        return EXIT_FAILURE;
+
+    //Compare the cache with the database after each of the following edits
+    DatabaseCache::setPersonnelVerification(true);
+
+    //Start readers, then edit and reload personnel from the main thread (the only thread allowed to write)
+
+    std::atomic_bool tStop(false);
+    std::atomic_bool tConsistent(true);
+    std::atomic_int tRepopulations(0);
+
+    std::vector<std::thread> tReaders;
+
+    for (int i = 0; i < readerThreadsCount; ++i)
+        tReaders.emplace_back(readPersonnel, std::cref(tStop), std::ref(tConsistent), std::cref(tRepopulations));
+
+    bool tSuccess = true;
+
+    for (int i = 0; i < editRounds && tSuccess; ++i)
+    {
+        const int tNumber = i % initialPersonsCount;
+        const Person tPerson = createPerson(tNumber, 0);
+
+        tSuccess &= DatabaseCache::updatePerson(tPerson.getIdent(), createPerson(tNumber, i + 1));
+        tSuccess &= DatabaseCache::updatePerson(tPerson.getIdent(), tPerson);
+
+        //Add and remove an additional person
+        const Person tExtraPerson = createPerson(initialPersonsCount + i, i);
+
+        tSuccess &= DatabaseCache::addPerson(tExtraPerson);
+        tSuccess &= DatabaseCache::removePerson(tExtraPerson.getIdent());
+
+        if (i % reloadInterval == 0)
+            tSuccess &= DatabaseCache::reloadPersonnel();
+
+        //Re-populate in the background while the readers continue (no edits allowed until loading has finished)
+        if (i % repopulateInterval == 0)
+        {
+            tRepopulations.fetch_add(1);
+
+            DatabaseCache::populateAsync(tLockFile, tLockFile, true);
+
+            tSuccess &= DatabaseCache::waitForConfig();
+            tSuccess &= DatabaseCache::waitForPersonnel();
+
+            tRepopulations.fetch_add(1);
+        }
+    }
+
+    tStop.store(true);
+
+    for (std::thread& tReader : tReaders)
+        tReader.join();
+
+    if (!tSuccess)
+        std::cerr<<"ERROR: Could not edit personnel!"<<std::endl;
+
+    if (!tConsistent.load())
+    {
+        std::cerr<<"ERROR: Readers observed an inconsistent personnel cache!"<<std::endl;
+        tSuccess = false;
+    }
+
+    if (DatabaseCache::personnel()->size() != static_cast<std::size_t>(initialPersonsCount))
+    {
+        std::cerr<<"ERROR: Unexpected number of cached persons!"<<std::endl;
+        tSuccess = false;
+    }
+
+    return tSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}